@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/external
+# Build directory: /root/repo/_rel_build/external
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("miniupnpc")
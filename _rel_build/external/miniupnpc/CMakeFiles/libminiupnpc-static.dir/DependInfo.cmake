@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/miniupnpc/src/addr_is_reserved.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/addr_is_reserved.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/addr_is_reserved.c.o.d"
+  "/root/repo/external/miniupnpc/src/connecthostport.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/connecthostport.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/connecthostport.c.o.d"
+  "/root/repo/external/miniupnpc/src/igd_desc_parse.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/igd_desc_parse.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/igd_desc_parse.c.o.d"
+  "/root/repo/external/miniupnpc/src/minisoap.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/minisoap.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/minisoap.c.o.d"
+  "/root/repo/external/miniupnpc/src/minissdpc.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/minissdpc.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/minissdpc.c.o.d"
+  "/root/repo/external/miniupnpc/src/miniupnpc.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/miniupnpc.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/miniupnpc.c.o.d"
+  "/root/repo/external/miniupnpc/src/miniwget.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/miniwget.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/miniwget.c.o.d"
+  "/root/repo/external/miniupnpc/src/minixml.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/minixml.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/minixml.c.o.d"
+  "/root/repo/external/miniupnpc/src/portlistingparse.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/portlistingparse.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/portlistingparse.c.o.d"
+  "/root/repo/external/miniupnpc/src/receivedata.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/receivedata.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/receivedata.c.o.d"
+  "/root/repo/external/miniupnpc/src/upnpcommands.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnpcommands.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnpcommands.c.o.d"
+  "/root/repo/external/miniupnpc/src/upnpdev.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnpdev.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnpdev.c.o.d"
+  "/root/repo/external/miniupnpc/src/upnperrors.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnperrors.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnperrors.c.o.d"
+  "/root/repo/external/miniupnpc/src/upnpreplyparse.c" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnpreplyparse.c.o" "gcc" "external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/src/upnpreplyparse.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
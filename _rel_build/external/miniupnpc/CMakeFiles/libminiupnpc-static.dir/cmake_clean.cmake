@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libminiupnpc-static.dir/src/addr_is_reserved.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/addr_is_reserved.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/connecthostport.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/connecthostport.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/igd_desc_parse.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/igd_desc_parse.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/minisoap.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/minisoap.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/minissdpc.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/minissdpc.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/miniupnpc.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/miniupnpc.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/miniwget.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/miniwget.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/minixml.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/minixml.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/portlistingparse.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/portlistingparse.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/receivedata.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/receivedata.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnpcommands.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnpcommands.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnpdev.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnpdev.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnperrors.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnperrors.c.o.d"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnpreplyparse.c.o"
+  "CMakeFiles/libminiupnpc-static.dir/src/upnpreplyparse.c.o.d"
+  "libminiupnpc.a"
+  "libminiupnpc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libminiupnpc-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
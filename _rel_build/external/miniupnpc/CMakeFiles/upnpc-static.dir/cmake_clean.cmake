@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/upnpc-static.dir/src/upnpc.c.o"
+  "CMakeFiles/upnpc-static.dir/src/upnpc.c.o.d"
+  "upnpc-static"
+  "upnpc-static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/upnpc-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Common/Base58.cpp" "src/CMakeFiles/Common.dir/Common/Base58.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/Base58.cpp.o.d"
+  "/root/repo/src/Common/Base64.cpp" "src/CMakeFiles/Common.dir/Common/Base64.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/Base64.cpp.o.d"
+  "/root/repo/src/Common/BlockingQueue.cpp" "src/CMakeFiles/Common.dir/Common/BlockingQueue.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/BlockingQueue.cpp.o.d"
+  "/root/repo/src/Common/CommandLine.cpp" "src/CMakeFiles/Common.dir/Common/CommandLine.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/CommandLine.cpp.o.d"
+  "/root/repo/src/Common/ConsoleHandler.cpp" "src/CMakeFiles/Common.dir/Common/ConsoleHandler.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/ConsoleHandler.cpp.o.d"
+  "/root/repo/src/Common/ConsoleTools.cpp" "src/CMakeFiles/Common.dir/Common/ConsoleTools.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/ConsoleTools.cpp.o.d"
+  "/root/repo/src/Common/CountingOutputStream.cpp" "src/CMakeFiles/Common.dir/Common/CountingOutputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/CountingOutputStream.cpp.o.d"
+  "/root/repo/src/Common/DnsTools.cpp" "src/CMakeFiles/Common.dir/Common/DnsTools.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/DnsTools.cpp.o.d"
+  "/root/repo/src/Common/FileMappedVector.cpp" "src/CMakeFiles/Common.dir/Common/FileMappedVector.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/FileMappedVector.cpp.o.d"
+  "/root/repo/src/Common/IInputStream.cpp" "src/CMakeFiles/Common.dir/Common/IInputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/IInputStream.cpp.o.d"
+  "/root/repo/src/Common/IOutputStream.cpp" "src/CMakeFiles/Common.dir/Common/IOutputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/IOutputStream.cpp.o.d"
+  "/root/repo/src/Common/JsonValue.cpp" "src/CMakeFiles/Common.dir/Common/JsonValue.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/JsonValue.cpp.o.d"
+  "/root/repo/src/Common/Math.cpp" "src/CMakeFiles/Common.dir/Common/Math.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/Math.cpp.o.d"
+  "/root/repo/src/Common/MemoryInputStream.cpp" "src/CMakeFiles/Common.dir/Common/MemoryInputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/MemoryInputStream.cpp.o.d"
+  "/root/repo/src/Common/Metrics.cpp" "src/CMakeFiles/Common.dir/Common/Metrics.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/Metrics.cpp.o.d"
+  "/root/repo/src/Common/PathTools.cpp" "src/CMakeFiles/Common.dir/Common/PathTools.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/PathTools.cpp.o.d"
+  "/root/repo/src/Common/ScopeExit.cpp" "src/CMakeFiles/Common.dir/Common/ScopeExit.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/ScopeExit.cpp.o.d"
+  "/root/repo/src/Common/SignalHandler.cpp" "src/CMakeFiles/Common.dir/Common/SignalHandler.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/SignalHandler.cpp.o.d"
+  "/root/repo/src/Common/StdInputStream.cpp" "src/CMakeFiles/Common.dir/Common/StdInputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/StdInputStream.cpp.o.d"
+  "/root/repo/src/Common/StdOutputStream.cpp" "src/CMakeFiles/Common.dir/Common/StdOutputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/StdOutputStream.cpp.o.d"
+  "/root/repo/src/Common/StreamTools.cpp" "src/CMakeFiles/Common.dir/Common/StreamTools.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/StreamTools.cpp.o.d"
+  "/root/repo/src/Common/StringInputStream.cpp" "src/CMakeFiles/Common.dir/Common/StringInputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/StringInputStream.cpp.o.d"
+  "/root/repo/src/Common/StringOutputStream.cpp" "src/CMakeFiles/Common.dir/Common/StringOutputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/StringOutputStream.cpp.o.d"
+  "/root/repo/src/Common/StringTools.cpp" "src/CMakeFiles/Common.dir/Common/StringTools.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/StringTools.cpp.o.d"
+  "/root/repo/src/Common/StringView.cpp" "src/CMakeFiles/Common.dir/Common/StringView.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/StringView.cpp.o.d"
+  "/root/repo/src/Common/Util.cpp" "src/CMakeFiles/Common.dir/Common/Util.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/Util.cpp.o.d"
+  "/root/repo/src/Common/VectorOutputStream.cpp" "src/CMakeFiles/Common.dir/Common/VectorOutputStream.cpp.o" "gcc" "src/CMakeFiles/Common.dir/Common/VectorOutputStream.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ConcealWallet/ClientHelper.cpp" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/ClientHelper.cpp.o" "gcc" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/ClientHelper.cpp.o.d"
+  "/root/repo/src/ConcealWallet/ConcealWallet.cpp" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/ConcealWallet.cpp.o" "gcc" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/ConcealWallet.cpp.o.d"
+  "/root/repo/src/ConcealWallet/PasswordContainer.cpp" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/PasswordContainer.cpp.o" "gcc" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/PasswordContainer.cpp.o.d"
+  "/root/repo/src/ConcealWallet/TransferCmd.cpp" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/TransferCmd.cpp.o" "gcc" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/TransferCmd.cpp.o.d"
+  "/root/repo/src/ConcealWallet/main.cpp" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/main.cpp.o" "gcc" "src/CMakeFiles/ConcealWallet.dir/ConcealWallet/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/Wallet.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/NodeRpcProxy.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Transfers.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Rpc.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Http.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/CryptoNoteCore.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/System.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Logging.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Common.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/crypto.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Serialization.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Mnemonics.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/ClientHelper.cpp.o"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/ClientHelper.cpp.o.d"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/ConcealWallet.cpp.o"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/ConcealWallet.cpp.o.d"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/PasswordContainer.cpp.o"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/PasswordContainer.cpp.o.d"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/TransferCmd.cpp.o"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/TransferCmd.cpp.o.d"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/main.cpp.o"
+  "CMakeFiles/ConcealWallet.dir/ConcealWallet/main.cpp.o.d"
+  "concealwallet"
+  "concealwallet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ConcealWallet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/CryptoNoteCore/Account.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Account.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Account.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/BlockHeaderIndex.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockHeaderIndex.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockHeaderIndex.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/BlockIndex.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockIndex.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockIndex.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/Blockchain.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Blockchain.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Blockchain.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/BlockchainArchive.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainArchive.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainArchive.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/BlockchainIndices.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainIndices.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainIndices.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/BlockchainMessages.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainMessages.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainMessages.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/Checkpoints.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Checkpoints.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Checkpoints.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/Core.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Core.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Core.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/CoreConfig.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CoreConfig.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CoreConfig.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/CryptoNoteBasic.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasic.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasic.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/CryptoNoteBasicImpl.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasicImpl.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasicImpl.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/CryptoNoteFormatUtils.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteFormatUtils.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteFormatUtils.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/CryptoNoteSerialization.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteSerialization.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteSerialization.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/CryptoNoteTools.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteTools.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteTools.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/Currency.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Currency.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Currency.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/DepositIndex.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/DepositIndex.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/DepositIndex.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/Difficulty.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Difficulty.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Difficulty.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/IBlock.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/IBlock.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/IBlock.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/ITimeProvider.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/ITimeProvider.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/ITimeProvider.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/InvestmentIndex.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/InvestmentIndex.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/InvestmentIndex.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/Miner.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Miner.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Miner.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/MinerConfig.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/MinerConfig.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/MinerConfig.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/PoolJournal.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/PoolJournal.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/PoolJournal.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/SignatureCache.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SignatureCache.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SignatureCache.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/SwappedMap.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedMap.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedMap.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/SwappedVector.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedVector.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedVector.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/Transaction.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Transaction.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Transaction.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/TransactionExtra.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionExtra.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionExtra.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/TransactionPool.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPool.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPool.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/TransactionPrefixImpl.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPrefixImpl.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPrefixImpl.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/TransactionUtils.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionUtils.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionUtils.cpp.o.d"
+  "/root/repo/src/CryptoNoteCore/UpgradeDetector.cpp" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/UpgradeDetector.cpp.o" "gcc" "src/CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/UpgradeDetector.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Account.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Account.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockHeaderIndex.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockHeaderIndex.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockIndex.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockIndex.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Blockchain.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Blockchain.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainArchive.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainArchive.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainIndices.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainIndices.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainMessages.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/BlockchainMessages.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Checkpoints.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Checkpoints.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Core.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Core.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CoreConfig.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CoreConfig.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasic.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasic.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasicImpl.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteBasicImpl.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteFormatUtils.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteFormatUtils.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteSerialization.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteSerialization.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteTools.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/CryptoNoteTools.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Currency.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Currency.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/DepositIndex.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/DepositIndex.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Difficulty.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Difficulty.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/IBlock.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/IBlock.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/ITimeProvider.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/ITimeProvider.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/InvestmentIndex.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/InvestmentIndex.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Miner.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Miner.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/MinerConfig.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/MinerConfig.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/PoolJournal.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/PoolJournal.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SignatureCache.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SignatureCache.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedMap.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedMap.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedVector.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/SwappedVector.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Transaction.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/Transaction.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionExtra.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionExtra.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPool.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPool.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPrefixImpl.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionPrefixImpl.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionUtils.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/TransactionUtils.cpp.o.d"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/UpgradeDetector.cpp.o"
+  "CMakeFiles/CryptoNoteCore.dir/CryptoNoteCore/UpgradeDetector.cpp.o.d"
+  "libCryptoNoteCore.a"
+  "libCryptoNoteCore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CryptoNoteCore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
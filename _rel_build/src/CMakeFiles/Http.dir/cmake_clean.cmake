@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Http.dir/HTTP/HttpParser.cpp.o"
+  "CMakeFiles/Http.dir/HTTP/HttpParser.cpp.o.d"
+  "CMakeFiles/Http.dir/HTTP/HttpParserErrorCodes.cpp.o"
+  "CMakeFiles/Http.dir/HTTP/HttpParserErrorCodes.cpp.o.d"
+  "CMakeFiles/Http.dir/HTTP/HttpRequest.cpp.o"
+  "CMakeFiles/Http.dir/HTTP/HttpRequest.cpp.o.d"
+  "CMakeFiles/Http.dir/HTTP/HttpResponse.cpp.o"
+  "CMakeFiles/Http.dir/HTTP/HttpResponse.cpp.o.d"
+  "libHttp.a"
+  "libHttp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Http.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/InProcessNode.dir/InProcessNode/InProcessNode.cpp.o"
+  "CMakeFiles/InProcessNode.dir/InProcessNode/InProcessNode.cpp.o.d"
+  "CMakeFiles/InProcessNode.dir/InProcessNode/InProcessNodeErrors.cpp.o"
+  "CMakeFiles/InProcessNode.dir/InProcessNode/InProcessNodeErrors.cpp.o.d"
+  "libInProcessNode.a"
+  "libInProcessNode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/InProcessNode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
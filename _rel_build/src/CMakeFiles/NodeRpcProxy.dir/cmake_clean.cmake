@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NodeRpcProxy.dir/NodeRpcProxy/NodeErrors.cpp.o"
+  "CMakeFiles/NodeRpcProxy.dir/NodeRpcProxy/NodeErrors.cpp.o.d"
+  "CMakeFiles/NodeRpcProxy.dir/NodeRpcProxy/NodeRpcProxy.cpp.o"
+  "CMakeFiles/NodeRpcProxy.dir/NodeRpcProxy/NodeRpcProxy.cpp.o.d"
+  "libNodeRpcProxy.a"
+  "libNodeRpcProxy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NodeRpcProxy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
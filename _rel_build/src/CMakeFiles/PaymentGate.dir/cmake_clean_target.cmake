@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libPaymentGate.a"
+)
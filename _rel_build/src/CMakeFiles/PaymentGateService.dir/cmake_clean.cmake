@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/ConfigurationManager.cpp.o"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/ConfigurationManager.cpp.o.d"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/PaymentGateService.cpp.o"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/PaymentGateService.cpp.o.d"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/PaymentServiceConfiguration.cpp.o"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/PaymentServiceConfiguration.cpp.o.d"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/RpcNodeConfiguration.cpp.o"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/RpcNodeConfiguration.cpp.o.d"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/main.cpp.o"
+  "CMakeFiles/PaymentGateService.dir/PaymentGateService/main.cpp.o.d"
+  "walletd"
+  "walletd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PaymentGateService.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
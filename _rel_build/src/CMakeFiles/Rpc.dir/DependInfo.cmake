@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Rpc/HttpClient.cpp" "src/CMakeFiles/Rpc.dir/Rpc/HttpClient.cpp.o" "gcc" "src/CMakeFiles/Rpc.dir/Rpc/HttpClient.cpp.o.d"
+  "/root/repo/src/Rpc/HttpConnection.cpp" "src/CMakeFiles/Rpc.dir/Rpc/HttpConnection.cpp.o" "gcc" "src/CMakeFiles/Rpc.dir/Rpc/HttpConnection.cpp.o.d"
+  "/root/repo/src/Rpc/HttpServer.cpp" "src/CMakeFiles/Rpc.dir/Rpc/HttpServer.cpp.o" "gcc" "src/CMakeFiles/Rpc.dir/Rpc/HttpServer.cpp.o.d"
+  "/root/repo/src/Rpc/JsonRpc.cpp" "src/CMakeFiles/Rpc.dir/Rpc/JsonRpc.cpp.o" "gcc" "src/CMakeFiles/Rpc.dir/Rpc/JsonRpc.cpp.o.d"
+  "/root/repo/src/Rpc/RpcServer.cpp" "src/CMakeFiles/Rpc.dir/Rpc/RpcServer.cpp.o" "gcc" "src/CMakeFiles/Rpc.dir/Rpc/RpcServer.cpp.o.d"
+  "/root/repo/src/Rpc/RpcServerConfig.cpp" "src/CMakeFiles/Rpc.dir/Rpc/RpcServerConfig.cpp.o" "gcc" "src/CMakeFiles/Rpc.dir/Rpc/RpcServerConfig.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
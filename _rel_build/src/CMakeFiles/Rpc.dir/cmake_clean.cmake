@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Rpc.dir/Rpc/HttpClient.cpp.o"
+  "CMakeFiles/Rpc.dir/Rpc/HttpClient.cpp.o.d"
+  "CMakeFiles/Rpc.dir/Rpc/HttpConnection.cpp.o"
+  "CMakeFiles/Rpc.dir/Rpc/HttpConnection.cpp.o.d"
+  "CMakeFiles/Rpc.dir/Rpc/HttpServer.cpp.o"
+  "CMakeFiles/Rpc.dir/Rpc/HttpServer.cpp.o.d"
+  "CMakeFiles/Rpc.dir/Rpc/JsonRpc.cpp.o"
+  "CMakeFiles/Rpc.dir/Rpc/JsonRpc.cpp.o.d"
+  "CMakeFiles/Rpc.dir/Rpc/RpcServer.cpp.o"
+  "CMakeFiles/Rpc.dir/Rpc/RpcServer.cpp.o.d"
+  "CMakeFiles/Rpc.dir/Rpc/RpcServerConfig.cpp.o"
+  "CMakeFiles/Rpc.dir/Rpc/RpcServerConfig.cpp.o.d"
+  "libRpc.a"
+  "libRpc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Rpc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
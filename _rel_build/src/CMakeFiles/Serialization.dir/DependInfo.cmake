@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Serialization/BinaryInputStreamSerializer.cpp" "src/CMakeFiles/Serialization.dir/Serialization/BinaryInputStreamSerializer.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/BinaryInputStreamSerializer.cpp.o.d"
+  "/root/repo/src/Serialization/BinaryOutputStreamSerializer.cpp" "src/CMakeFiles/Serialization.dir/Serialization/BinaryOutputStreamSerializer.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/BinaryOutputStreamSerializer.cpp.o.d"
+  "/root/repo/src/Serialization/JsonInputStreamSerializer.cpp" "src/CMakeFiles/Serialization.dir/Serialization/JsonInputStreamSerializer.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/JsonInputStreamSerializer.cpp.o.d"
+  "/root/repo/src/Serialization/JsonInputValueSerializer.cpp" "src/CMakeFiles/Serialization.dir/Serialization/JsonInputValueSerializer.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/JsonInputValueSerializer.cpp.o.d"
+  "/root/repo/src/Serialization/JsonOutputStreamSerializer.cpp" "src/CMakeFiles/Serialization.dir/Serialization/JsonOutputStreamSerializer.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/JsonOutputStreamSerializer.cpp.o.d"
+  "/root/repo/src/Serialization/KVBinaryInputStreamSerializer.cpp" "src/CMakeFiles/Serialization.dir/Serialization/KVBinaryInputStreamSerializer.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/KVBinaryInputStreamSerializer.cpp.o.d"
+  "/root/repo/src/Serialization/KVBinaryOutputStreamSerializer.cpp" "src/CMakeFiles/Serialization.dir/Serialization/KVBinaryOutputStreamSerializer.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/KVBinaryOutputStreamSerializer.cpp.o.d"
+  "/root/repo/src/Serialization/MemoryStream.cpp" "src/CMakeFiles/Serialization.dir/Serialization/MemoryStream.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/MemoryStream.cpp.o.d"
+  "/root/repo/src/Serialization/SerializationOverloads.cpp" "src/CMakeFiles/Serialization.dir/Serialization/SerializationOverloads.cpp.o" "gcc" "src/CMakeFiles/Serialization.dir/Serialization/SerializationOverloads.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
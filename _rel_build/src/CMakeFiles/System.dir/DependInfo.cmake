@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Platform/Linux/System/Dispatcher.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/Dispatcher.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/Dispatcher.cpp.o.d"
+  "/root/repo/src/Platform/Linux/System/ErrorMessage.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/ErrorMessage.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/ErrorMessage.cpp.o.d"
+  "/root/repo/src/Platform/Linux/System/Ipv4Resolver.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/Ipv4Resolver.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/Ipv4Resolver.cpp.o.d"
+  "/root/repo/src/Platform/Linux/System/MemoryMappedFile.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/MemoryMappedFile.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/MemoryMappedFile.cpp.o.d"
+  "/root/repo/src/Platform/Linux/System/TcpConnection.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/TcpConnection.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/TcpConnection.cpp.o.d"
+  "/root/repo/src/Platform/Linux/System/TcpConnector.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/TcpConnector.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/TcpConnector.cpp.o.d"
+  "/root/repo/src/Platform/Linux/System/TcpListener.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/TcpListener.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/TcpListener.cpp.o.d"
+  "/root/repo/src/Platform/Linux/System/Timer.cpp" "src/CMakeFiles/System.dir/Platform/Linux/System/Timer.cpp.o" "gcc" "src/CMakeFiles/System.dir/Platform/Linux/System/Timer.cpp.o.d"
+  "/root/repo/src/System/AsyncResolver.cpp" "src/CMakeFiles/System.dir/System/AsyncResolver.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/AsyncResolver.cpp.o.d"
+  "/root/repo/src/System/ContextGroup.cpp" "src/CMakeFiles/System.dir/System/ContextGroup.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/ContextGroup.cpp.o.d"
+  "/root/repo/src/System/ContextGroupTimeout.cpp" "src/CMakeFiles/System.dir/System/ContextGroupTimeout.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/ContextGroupTimeout.cpp.o.d"
+  "/root/repo/src/System/DnsCache.cpp" "src/CMakeFiles/System.dir/System/DnsCache.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/DnsCache.cpp.o.d"
+  "/root/repo/src/System/Event.cpp" "src/CMakeFiles/System.dir/System/Event.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/Event.cpp.o.d"
+  "/root/repo/src/System/EventLock.cpp" "src/CMakeFiles/System.dir/System/EventLock.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/EventLock.cpp.o.d"
+  "/root/repo/src/System/InterruptedException.cpp" "src/CMakeFiles/System.dir/System/InterruptedException.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/InterruptedException.cpp.o.d"
+  "/root/repo/src/System/Ipv4Address.cpp" "src/CMakeFiles/System.dir/System/Ipv4Address.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/Ipv4Address.cpp.o.d"
+  "/root/repo/src/System/RemoteEventLock.cpp" "src/CMakeFiles/System.dir/System/RemoteEventLock.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/RemoteEventLock.cpp.o.d"
+  "/root/repo/src/System/TcpStream.cpp" "src/CMakeFiles/System.dir/System/TcpStream.cpp.o" "gcc" "src/CMakeFiles/System.dir/System/TcpStream.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
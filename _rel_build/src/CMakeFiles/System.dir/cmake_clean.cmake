@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/System.dir/Platform/Linux/System/Dispatcher.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/Dispatcher.cpp.o.d"
+  "CMakeFiles/System.dir/Platform/Linux/System/ErrorMessage.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/ErrorMessage.cpp.o.d"
+  "CMakeFiles/System.dir/Platform/Linux/System/Ipv4Resolver.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/Ipv4Resolver.cpp.o.d"
+  "CMakeFiles/System.dir/Platform/Linux/System/MemoryMappedFile.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/MemoryMappedFile.cpp.o.d"
+  "CMakeFiles/System.dir/Platform/Linux/System/TcpConnection.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/TcpConnection.cpp.o.d"
+  "CMakeFiles/System.dir/Platform/Linux/System/TcpConnector.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/TcpConnector.cpp.o.d"
+  "CMakeFiles/System.dir/Platform/Linux/System/TcpListener.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/TcpListener.cpp.o.d"
+  "CMakeFiles/System.dir/Platform/Linux/System/Timer.cpp.o"
+  "CMakeFiles/System.dir/Platform/Linux/System/Timer.cpp.o.d"
+  "CMakeFiles/System.dir/System/AsyncResolver.cpp.o"
+  "CMakeFiles/System.dir/System/AsyncResolver.cpp.o.d"
+  "CMakeFiles/System.dir/System/ContextGroup.cpp.o"
+  "CMakeFiles/System.dir/System/ContextGroup.cpp.o.d"
+  "CMakeFiles/System.dir/System/ContextGroupTimeout.cpp.o"
+  "CMakeFiles/System.dir/System/ContextGroupTimeout.cpp.o.d"
+  "CMakeFiles/System.dir/System/DnsCache.cpp.o"
+  "CMakeFiles/System.dir/System/DnsCache.cpp.o.d"
+  "CMakeFiles/System.dir/System/Event.cpp.o"
+  "CMakeFiles/System.dir/System/Event.cpp.o.d"
+  "CMakeFiles/System.dir/System/EventLock.cpp.o"
+  "CMakeFiles/System.dir/System/EventLock.cpp.o.d"
+  "CMakeFiles/System.dir/System/InterruptedException.cpp.o"
+  "CMakeFiles/System.dir/System/InterruptedException.cpp.o.d"
+  "CMakeFiles/System.dir/System/Ipv4Address.cpp.o"
+  "CMakeFiles/System.dir/System/Ipv4Address.cpp.o.d"
+  "CMakeFiles/System.dir/System/RemoteEventLock.cpp.o"
+  "CMakeFiles/System.dir/System/RemoteEventLock.cpp.o.d"
+  "CMakeFiles/System.dir/System/TcpStream.cpp.o"
+  "CMakeFiles/System.dir/System/TcpStream.cpp.o.d"
+  "libSystem.a"
+  "libSystem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/System.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Wallet/LegacyKeysImporter.cpp" "src/CMakeFiles/Wallet.dir/Wallet/LegacyKeysImporter.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/LegacyKeysImporter.cpp.o.d"
+  "/root/repo/src/Wallet/WalletAsyncContextCounter.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletAsyncContextCounter.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletAsyncContextCounter.cpp.o.d"
+  "/root/repo/src/Wallet/WalletCacheChunks.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletCacheChunks.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletCacheChunks.cpp.o.d"
+  "/root/repo/src/Wallet/WalletDecoyCache.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletDecoyCache.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletDecoyCache.cpp.o.d"
+  "/root/repo/src/Wallet/WalletErrors.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletErrors.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletErrors.cpp.o.d"
+  "/root/repo/src/Wallet/WalletGreen.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletGreen.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletGreen.cpp.o.d"
+  "/root/repo/src/Wallet/WalletRpcServer.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletRpcServer.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletRpcServer.cpp.o.d"
+  "/root/repo/src/Wallet/WalletSerializationV1.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletSerializationV1.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletSerializationV1.cpp.o.d"
+  "/root/repo/src/Wallet/WalletSerializationV2.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletSerializationV2.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletSerializationV2.cpp.o.d"
+  "/root/repo/src/Wallet/WalletTransactionPostings.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletTransactionPostings.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletTransactionPostings.cpp.o.d"
+  "/root/repo/src/Wallet/WalletUtils.cpp" "src/CMakeFiles/Wallet.dir/Wallet/WalletUtils.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/Wallet/WalletUtils.cpp.o.d"
+  "/root/repo/src/WalletLegacy/KeysStorage.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/KeysStorage.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/KeysStorage.cpp.o.d"
+  "/root/repo/src/WalletLegacy/WalletHelper.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletHelper.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletHelper.cpp.o.d"
+  "/root/repo/src/WalletLegacy/WalletLegacy.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletLegacy.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletLegacy.cpp.o.d"
+  "/root/repo/src/WalletLegacy/WalletLegacySerialization.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletLegacySerialization.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletLegacySerialization.cpp.o.d"
+  "/root/repo/src/WalletLegacy/WalletLegacySerializer.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletLegacySerializer.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletLegacySerializer.cpp.o.d"
+  "/root/repo/src/WalletLegacy/WalletTransactionSender.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletTransactionSender.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletTransactionSender.cpp.o.d"
+  "/root/repo/src/WalletLegacy/WalletUnconfirmedTransactions.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletUnconfirmedTransactions.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletUnconfirmedTransactions.cpp.o.d"
+  "/root/repo/src/WalletLegacy/WalletUserTransactionsCache.cpp" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletUserTransactionsCache.cpp.o" "gcc" "src/CMakeFiles/Wallet.dir/WalletLegacy/WalletUserTransactionsCache.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/crypto/chacha8.c" "src/CMakeFiles/crypto.dir/crypto/chacha8.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/chacha8.c.o.d"
+  "/root/repo/src/crypto/crypto-ops-data.c" "src/CMakeFiles/crypto.dir/crypto/crypto-ops-data.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/crypto-ops-data.c.o.d"
+  "/root/repo/src/crypto/crypto-ops.c" "src/CMakeFiles/crypto.dir/crypto/crypto-ops.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/crypto-ops.c.o.d"
+  "/root/repo/src/crypto/hash.c" "src/CMakeFiles/crypto.dir/crypto/hash.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/hash.c.o.d"
+  "/root/repo/src/crypto/keccak.c" "src/CMakeFiles/crypto.dir/crypto/keccak.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/keccak.c.o.d"
+  "/root/repo/src/crypto/pow_hash/aux_hash.c" "src/CMakeFiles/crypto.dir/crypto/pow_hash/aux_hash.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/pow_hash/aux_hash.c.o.d"
+  "/root/repo/src/crypto/random.c" "src/CMakeFiles/crypto.dir/crypto/random.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/random.c.o.d"
+  "/root/repo/src/crypto/tree-hash.c" "src/CMakeFiles/crypto.dir/crypto/tree-hash.c.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/tree-hash.c.o.d"
+  "/root/repo/src/crypto/crypto.cpp" "src/CMakeFiles/crypto.dir/crypto/crypto.cpp.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/crypto.cpp.o.d"
+  "/root/repo/src/crypto/cryptonight.cpp" "src/CMakeFiles/crypto.dir/crypto/cryptonight.cpp.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/cryptonight.cpp.o.d"
+  "/root/repo/src/crypto/pow_hash/cn_slow_hash_hard_arm.cpp" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_arm.cpp.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_arm.cpp.o.d"
+  "/root/repo/src/crypto/pow_hash/cn_slow_hash_hard_intel.cpp" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_intel.cpp.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_intel.cpp.o.d"
+  "/root/repo/src/crypto/pow_hash/cn_slow_hash_intel_avx2.cpp" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_intel_avx2.cpp.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_intel_avx2.cpp.o.d"
+  "/root/repo/src/crypto/pow_hash/cn_slow_hash_soft.cpp" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_soft.cpp.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_soft.cpp.o.d"
+  "/root/repo/src/crypto/scratchpad_pool.cpp" "src/CMakeFiles/crypto.dir/crypto/scratchpad_pool.cpp.o" "gcc" "src/CMakeFiles/crypto.dir/crypto/scratchpad_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
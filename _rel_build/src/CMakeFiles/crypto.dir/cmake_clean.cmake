@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/crypto.dir/crypto/chacha8.c.o"
+  "CMakeFiles/crypto.dir/crypto/chacha8.c.o.d"
+  "CMakeFiles/crypto.dir/crypto/crypto-ops-data.c.o"
+  "CMakeFiles/crypto.dir/crypto/crypto-ops-data.c.o.d"
+  "CMakeFiles/crypto.dir/crypto/crypto-ops.c.o"
+  "CMakeFiles/crypto.dir/crypto/crypto-ops.c.o.d"
+  "CMakeFiles/crypto.dir/crypto/crypto.cpp.o"
+  "CMakeFiles/crypto.dir/crypto/crypto.cpp.o.d"
+  "CMakeFiles/crypto.dir/crypto/cryptonight.cpp.o"
+  "CMakeFiles/crypto.dir/crypto/cryptonight.cpp.o.d"
+  "CMakeFiles/crypto.dir/crypto/hash.c.o"
+  "CMakeFiles/crypto.dir/crypto/hash.c.o.d"
+  "CMakeFiles/crypto.dir/crypto/keccak.c.o"
+  "CMakeFiles/crypto.dir/crypto/keccak.c.o.d"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/aux_hash.c.o"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/aux_hash.c.o.d"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_arm.cpp.o"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_arm.cpp.o.d"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_intel.cpp.o"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_hard_intel.cpp.o.d"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_intel_avx2.cpp.o"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_intel_avx2.cpp.o.d"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_soft.cpp.o"
+  "CMakeFiles/crypto.dir/crypto/pow_hash/cn_slow_hash_soft.cpp.o.d"
+  "CMakeFiles/crypto.dir/crypto/random.c.o"
+  "CMakeFiles/crypto.dir/crypto/random.c.o.d"
+  "CMakeFiles/crypto.dir/crypto/scratchpad_pool.cpp.o"
+  "CMakeFiles/crypto.dir/crypto/scratchpad_pool.cpp.o.d"
+  "CMakeFiles/crypto.dir/crypto/tree-hash.c.o"
+  "CMakeFiles/crypto.dir/crypto/tree-hash.c.o.d"
+  "libcrypto.a"
+  "libcrypto.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/crypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
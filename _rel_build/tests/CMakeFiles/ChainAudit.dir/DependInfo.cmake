@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/ChainAudit/ChainAudit.cpp" "tests/CMakeFiles/ChainAudit.dir/ChainAudit/ChainAudit.cpp.o" "gcc" "tests/CMakeFiles/ChainAudit.dir/ChainAudit/ChainAudit.cpp.o.d"
+  "/root/repo/tests/ChainAudit/main.cpp" "tests/CMakeFiles/ChainAudit.dir/ChainAudit/main.cpp.o" "gcc" "tests/CMakeFiles/ChainAudit.dir/ChainAudit/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/CryptoNoteCore.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Serialization.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/System.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Logging.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Common.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/crypto.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/BlockchainExplorer.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ChainAudit.dir/ChainAudit/ChainAudit.cpp.o"
+  "CMakeFiles/ChainAudit.dir/ChainAudit/ChainAudit.cpp.o.d"
+  "CMakeFiles/ChainAudit.dir/ChainAudit/main.cpp.o"
+  "CMakeFiles/ChainAudit.dir/ChainAudit/main.cpp.o.d"
+  "conceal-chain-audit"
+  "conceal-chain-audit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ChainAudit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
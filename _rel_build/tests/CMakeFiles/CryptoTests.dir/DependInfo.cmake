@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/crypto/crypto-ops-data.c" "tests/CMakeFiles/CryptoTests.dir/crypto/crypto-ops-data.c.o" "gcc" "tests/CMakeFiles/CryptoTests.dir/crypto/crypto-ops-data.c.o.d"
+  "/root/repo/tests/crypto/crypto-ops.c" "tests/CMakeFiles/CryptoTests.dir/crypto/crypto-ops.c.o" "gcc" "tests/CMakeFiles/CryptoTests.dir/crypto/crypto-ops.c.o.d"
+  "/root/repo/tests/crypto/hash.c" "tests/CMakeFiles/CryptoTests.dir/crypto/hash.c.o" "gcc" "tests/CMakeFiles/CryptoTests.dir/crypto/hash.c.o.d"
+  "/root/repo/tests/crypto/random.c" "tests/CMakeFiles/CryptoTests.dir/crypto/random.c.o" "gcc" "tests/CMakeFiles/CryptoTests.dir/crypto/random.c.o.d"
+  "/root/repo/tests/crypto/crypto.cpp" "tests/CMakeFiles/CryptoTests.dir/crypto/crypto.cpp.o" "gcc" "tests/CMakeFiles/CryptoTests.dir/crypto/crypto.cpp.o.d"
+  "/root/repo/tests/crypto/main.cpp" "tests/CMakeFiles/CryptoTests.dir/crypto/main.cpp.o" "gcc" "tests/CMakeFiles/CryptoTests.dir/crypto/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
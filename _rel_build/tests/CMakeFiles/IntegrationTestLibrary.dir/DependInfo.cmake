@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/IntegrationTestLib/BaseFunctionalTests.cpp" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/BaseFunctionalTests.cpp.o" "gcc" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/BaseFunctionalTests.cpp.o.d"
+  "/root/repo/tests/IntegrationTestLib/InProcTestNode.cpp" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/InProcTestNode.cpp.o" "gcc" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/InProcTestNode.cpp.o.d"
+  "/root/repo/tests/IntegrationTestLib/Logger.cpp" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/Logger.cpp.o" "gcc" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/Logger.cpp.o.d"
+  "/root/repo/tests/IntegrationTestLib/Process.cpp" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/Process.cpp.o" "gcc" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/Process.cpp.o.d"
+  "/root/repo/tests/IntegrationTestLib/RPCTestNode.cpp" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/RPCTestNode.cpp.o" "gcc" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/RPCTestNode.cpp.o.d"
+  "/root/repo/tests/IntegrationTestLib/TestNetwork.cpp" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/TestNetwork.cpp.o" "gcc" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/TestNetwork.cpp.o.d"
+  "/root/repo/tests/IntegrationTestLib/TestWalletLegacy.cpp" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/TestWalletLegacy.cpp.o" "gcc" "tests/CMakeFiles/IntegrationTestLibrary.dir/IntegrationTestLib/TestWalletLegacy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
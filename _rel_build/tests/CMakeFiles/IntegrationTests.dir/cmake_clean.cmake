@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/IntegrationTests.cpp.o"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/IntegrationTests.cpp.o.d"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/MultiVersion.cpp.o"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/MultiVersion.cpp.o.d"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/Node.cpp.o"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/Node.cpp.o.d"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/WalletLegacyTests.cpp.o"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/WalletLegacyTests.cpp.o.d"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/main.cpp.o"
+  "CMakeFiles/IntegrationTests.dir/IntegrationTests/main.cpp.o.d"
+  "integration_tests"
+  "integration_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IntegrationTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
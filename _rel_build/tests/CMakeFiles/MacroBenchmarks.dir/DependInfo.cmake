@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/MacroBenchmarks/SyntheticChain.cpp" "tests/CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/SyntheticChain.cpp.o" "gcc" "tests/CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/SyntheticChain.cpp.o.d"
+  "/root/repo/tests/MacroBenchmarks/main.cpp" "tests/CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/main.cpp.o" "gcc" "tests/CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/tests/CMakeFiles/TestGenerator.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Transfers.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/CryptoNoteCore.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Serialization.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/System.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Logging.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Common.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/crypto.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/BlockchainExplorer.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
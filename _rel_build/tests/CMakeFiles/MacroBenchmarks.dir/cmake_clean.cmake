@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/SyntheticChain.cpp.o"
+  "CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/SyntheticChain.cpp.o.d"
+  "CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/main.cpp.o"
+  "CMakeFiles/MacroBenchmarks.dir/MacroBenchmarks/main.cpp.o.d"
+  "macro_benchmarks"
+  "macro_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MacroBenchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/TransfersTests/TestNodeRpcProxy.cpp" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/TestNodeRpcProxy.cpp.o" "gcc" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/TestNodeRpcProxy.cpp.o.d"
+  "/root/repo/tests/TransfersTests/TestTxPoolSync.cpp" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/TestTxPoolSync.cpp.o" "gcc" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/TestTxPoolSync.cpp.o.d"
+  "/root/repo/tests/TransfersTests/Tests.cpp" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/Tests.cpp.o" "gcc" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/Tests.cpp.o.d"
+  "/root/repo/tests/TransfersTests/main.cpp" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/main.cpp.o" "gcc" "tests/CMakeFiles/TransfersTests.dir/TransfersTests/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/tests/CMakeFiles/IntegrationTestLibrary.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Wallet.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/external/gtest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/InProcessNode.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/NodeRpcProxy.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/P2P.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Rpc.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Http.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/BlockchainExplorer.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/CryptoNoteCore.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Serialization.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/System.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Logging.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Transfers.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/Common.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/CMakeFiles/crypto.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/external/miniupnpc/CMakeFiles/libminiupnpc-static.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/external/gtest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TransfersTests.dir/TransfersTests/TestNodeRpcProxy.cpp.o"
+  "CMakeFiles/TransfersTests.dir/TransfersTests/TestNodeRpcProxy.cpp.o.d"
+  "CMakeFiles/TransfersTests.dir/TransfersTests/TestTxPoolSync.cpp.o"
+  "CMakeFiles/TransfersTests.dir/TransfersTests/TestTxPoolSync.cpp.o.d"
+  "CMakeFiles/TransfersTests.dir/TransfersTests/Tests.cpp.o"
+  "CMakeFiles/TransfersTests.dir/TransfersTests/Tests.cpp.o.d"
+  "CMakeFiles/TransfersTests.dir/TransfersTests/main.cpp.o"
+  "CMakeFiles/TransfersTests.dir/TransfersTests/main.cpp.o.d"
+  "transfers_tests"
+  "transfers_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TransfersTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,135 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UnitTests.dir/ChainAudit/ChainAudit.cpp.o"
+  "CMakeFiles/UnitTests.dir/ChainAudit/ChainAudit.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/ArrayRefTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/ArrayRefTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/ArrayViewTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/ArrayViewTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/Base58.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/Base58.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/BlockReward.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/BlockReward.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/BlockingQueue.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/BlockingQueue.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/Chacha8.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/Chacha8.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/Checkpoints.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/Checkpoints.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/DecomposeAmountIntoDigits.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/DecomposeAmountIntoDigits.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/EventWaiter.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/EventWaiter.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/ICoreStub.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/ICoreStub.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/ICryptoNoteProtocolQueryStub.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/ICryptoNoteProtocolQueryStub.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/INodeStubs.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/INodeStubs.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/MulDiv.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/MulDiv.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/ParseAmount.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/ParseAmount.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/PaymentGateTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/PaymentGateTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/Serialization.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/Serialization.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/SerializationKV.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/SerializationKV.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/Shuffle.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/Shuffle.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/StringBufferTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/StringBufferTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/StringViewTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/StringViewTests.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBcS.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBcS.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockHeaderIndex.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockHeaderIndex.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainArchive.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainArchive.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainExplorer.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainExplorer.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainGenerator.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainGenerator.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainIndices.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestBlockchainIndices.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestChainAudit.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestChainAudit.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestCryptonoteBasic.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestCryptonoteBasic.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestCurrency.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestCurrency.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestDepositIndex.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestDepositIndex.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestFormatUtils.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestFormatUtils.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestHttpParser.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestHttpParser.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestInprocessNode.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestInprocessNode.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestJsonValue.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestJsonValue.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestL1MonetarySafety.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestL1MonetarySafety.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestMessageQueue.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestMessageQueue.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestMetrics.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestMetrics.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestPath.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestPath.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestPeerlist.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestPeerlist.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestPoolJournal.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestPoolJournal.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestProtocolPack.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestProtocolPack.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestScratchpadPool.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestScratchpadPool.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestSignatureCache.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestSignatureCache.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestSlowHashLanes.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestSlowHashLanes.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransactionPoolDetach.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransactionPoolDetach.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfers.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfers.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersConsumer.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersConsumer.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersContainer.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersContainer.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersContainerKeyImage.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersContainerKeyImage.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersSubscription.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestTransfersSubscription.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestUpgradeDetector.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestUpgradeDetector.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWallet.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWallet.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletCacheChunks.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletCacheChunks.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletDecoyCache.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletDecoyCache.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletLegacy.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletLegacy.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletService.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletService.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletTransactionPostings.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletTransactionPostings.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletUserTransactionsCache.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TestWalletUserTransactionsCache.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TransactionApi.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TransactionApi.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TransactionApiHelpers.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TransactionApiHelpers.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/TransactionPool.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/TransactionPool.cpp.o.d"
+  "CMakeFiles/UnitTests.dir/UnitTests/main.cpp.o"
+  "CMakeFiles/UnitTests.dir/UnitTests/main.cpp.o.d"
+  "unit_tests"
+  "unit_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_rel_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CoreTests "core_tests" "--generate_and_play_test_data")
+set_tests_properties(CoreTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;118;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CryptoTests "crypto_tests" "/root/repo/tests/crypto/tests.txt")
+set_tests_properties(CryptoTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;119;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(IntegrationTests "integration_tests")
+set_tests_properties(IntegrationTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;120;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(NodeRpcProxyTests "node_rpc_proxy_tests")
+set_tests_properties(NodeRpcProxyTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;121;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(PerformanceTests "performance_tests")
+set_tests_properties(PerformanceTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;122;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SystemTests "system_tests")
+set_tests_properties(SystemTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;123;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TransfersTests "transfers_tests")
+set_tests_properties(TransfersTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;124;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnitTests "unit_tests" "--gtest_filter=-WalletApi.*:WalletApi_makeTransaction.*:WalletApi_commitTransaction.*:WalletApi_rollbackUncommitedTransaction.*:tx_pool.TxPoolDoesNotAcceptInvalidFusionTransaction:TxPool_FillBlockTemplate.TxPoolAddsFusionTransactionsToBlockTemplateNoMoreThanLimit:TxPool_FillBlockTemplate.TxPoolContinuesToAddOrdinaryTransactionsUpTo125PerCentOfMedianAfterAddingFusionTransactions:WalletLegacyApi.sendSeveralTransactions")
+set_tests_properties(UnitTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;125;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DifficultyTests "difficulty_tests" "/root/repo/tests/Difficulty/data.txt")
+set_tests_properties(DifficultyTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;128;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HashTargetTests "hash_target_tests")
+set_tests_properties(HashTargetTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;129;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(hash-fast "hash_tests" "fast" "/root/repo/tests/Hash/tests-fast.txt")
+set_tests_properties(hash-fast PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;131;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(hash-slow "hash_tests" "slow" "/root/repo/tests/Hash/tests-slow.txt")
+set_tests_properties(hash-slow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;131;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(hash-tree "hash_tests" "tree" "/root/repo/tests/Hash/tests-tree.txt")
+set_tests_properties(hash-tree PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;131;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(hash-slow-2 "hash_tests" "slow-2" "/root/repo/tests/Hash/tests-slow.txt")
+set_tests_properties(hash-slow-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;134;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(hash-slow-4 "hash_tests" "slow-4" "/root/repo/tests/Hash/tests-slow.txt")
+set_tests_properties(hash-slow-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;134;add_test;/root/repo/tests/CMakeLists.txt;0;")
@@ -59,6 +59,7 @@ public:
   virtual bool getPaymentId(crypto::Hash& paymentId) const = 0;
   virtual bool getExtraNonce(BinaryArray& nonce) const = 0;
   virtual BinaryArray getExtra() const = 0;
+  virtual std::vector<std::string> getMessages(const crypto::SecretKey* recipientSecretKey) const = 0;
 
   // inputs
   virtual size_t getInputCount() const = 0;
@@ -112,6 +112,8 @@ namespace cn
     virtual size_t transactionsCount() const = 0;
     virtual uint64_t balance(uint32_t flags = IncludeDefault) const = 0;
     virtual void getOutputs(std::vector<TransactionOutputInformation> &transfers, uint32_t flags = IncludeDefault) const = 0;
+    // Appends up to count confirmed outputs matching flags with amount in [minAmount, maxAmount], ascending by amount
+    virtual void getOutputsByAmount(std::vector<TransactionOutputInformation> &transfers, uint32_t flags, uint64_t minAmount, uint64_t maxAmount, size_t count) const = 0;
     virtual bool getTransactionInformation(const crypto::Hash &transactionHash, TransactionInformation &info,
                                            uint64_t *amountIn = nullptr, uint64_t *amountOut = nullptr) const = 0;
     virtual std::vector<TransactionOutputInformation> getTransactionOutputs(const crypto::Hash &transactionHash, uint32_t flags = IncludeDefault) const = 0;
@@ -182,6 +182,20 @@ struct PaymentIdTransactions
   std::vector<WalletTransaction> transactions;
 };
 
+struct WalletTransactionFilter
+{
+  std::vector<std::string> addresses;
+  boost::optional<crypto::Hash> paymentId;
+  size_t limit = std::numeric_limits<size_t>::max();
+};
+
+// Position of the next transaction a filtered query returns
+struct WalletTransactionCursor
+{
+  uint32_t blockIndex = 0;
+  size_t transactionId = 0;
+};
+
 class TransactionOutputInformation;
 class IBlockchainSynchronizerObserver;
 
@@ -264,7 +278,10 @@ public:
 
   virtual std::vector<TransactionsInBlockInfo> getTransactions(const crypto::Hash &blockHash, size_t count) const = 0;
   virtual std::vector<TransactionsInBlockInfo> getTransactions(uint32_t blockIndex, size_t count) const = 0;
-
+  // Blocks holding the confirmed transactions that match the filter, starting at the cursor;
+  // the cursor is moved past the returned transactions
+  virtual std::vector<TransactionsInBlockInfo> getTransactions(const crypto::Hash &blockHash, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const = 0;
+  virtual std::vector<TransactionsInBlockInfo> getTransactions(uint32_t blockIndex, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const = 0;
 
 
   virtual std::vector<crypto::Hash> getBlockHashes(uint32_t blockIndex, size_t count) const = 0;
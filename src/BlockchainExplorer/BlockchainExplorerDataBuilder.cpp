@@ -39,13 +39,15 @@ bool BlockchainExplorerDataBuilder::getMixin(const Transaction& transaction, uin
 }
 
 bool BlockchainExplorerDataBuilder::getPaymentId(const Transaction& transaction, crypto::Hash& paymentId) {
-  std::vector<TransactionExtraField> txExtraFields;
-  parseTransactionExtra(transaction.extra, txExtraFields);
-  TransactionExtraNonce extraNonce;
-  if (!findTransactionExtraFieldByType(txExtraFields, extraNonce)) {
-    return false;
+  TransactionExtraReader reader(transaction.extra);
+  TransactionExtraFieldView field;
+  while (reader.next(field)) {
+    if (field.tag == TX_EXTRA_NONCE) {
+      std::vector<uint8_t> nonce(field.data, field.data + field.size);
+      return getPaymentIdFromTransactionExtraNonce(nonce, paymentId);
+    }
   }
-  return getPaymentIdFromTransactionExtraNonce(extraNonce.nonce, paymentId);
+  return false;
 }
 
 bool BlockchainExplorerDataBuilder::fillTxExtra(const std::vector<uint8_t>& rawExtra, TransactionExtraDetails& extraDetails) {
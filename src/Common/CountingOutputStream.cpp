@@ -0,0 +1,22 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "CountingOutputStream.h"
+
+namespace common {
+
+CountingOutputStream::CountingOutputStream() : count(0) {
+}
+
+size_t CountingOutputStream::writeSome(const void* data, size_t size) {
+  count += size;
+  return size;
+}
+
+uint64_t CountingOutputStream::size() const {
+  return count;
+}
+
+}
@@ -0,0 +1,24 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <cstdint>
+#include "IOutputStream.h"
+
+namespace common {
+
+// Discards the data and only counts the bytes, for computing serialized sizes without a buffer
+class CountingOutputStream : public IOutputStream {
+public:
+  CountingOutputStream();
+  size_t writeSome(const void* data, size_t size) override;
+  uint64_t size() const;
+
+private:
+  uint64_t count;
+};
+
+}
@@ -16,7 +16,12 @@ namespace common {
     MemoryInputStream(const void* buffer, size_t bufferSize);
     size_t getPosition() const;
     bool endOfStream() const;
-    
+
+    // Direct access for readers that decode in place instead of copying through readSome
+    const char* current() const { return buffer + position; }
+    size_t remaining() const { return bufferSize - position; }
+    void advance(size_t size) { position += size; }
+
     // IInputStream
     virtual size_t readSome(void* data, size_t size) override;
 
@@ -0,0 +1,178 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "Metrics.h"
+
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace common {
+
+namespace {
+
+void writeSeconds(std::ostream& out, uint64_t microseconds) {
+  out << microseconds / 1000000 << '.' << std::setw(6) << std::setfill('0') << microseconds % 1000000 << std::setfill(' ');
+}
+
+void writeName(std::ostream& out, const std::string& name, const char* suffix, const std::string& labels, const std::string& extraLabel) {
+  out << name << suffix;
+  if (labels.empty() && extraLabel.empty()) {
+    return;
+  }
+
+  out << '{' << labels;
+  if (!labels.empty() && !extraLabel.empty()) {
+    out << ',';
+  }
+  out << extraLabel << '}';
+}
+
+}
+
+const uint64_t MetricHistogram::BUCKET_BOUNDS[MetricHistogram::BUCKET_COUNT] = {
+  50, 100, 250, 500,
+  1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000,
+  1000000, 2500000, 5000000, 10000000
+};
+
+MetricCounter::MetricCounter() : m_value(0) {
+}
+
+MetricHistogram::MetricHistogram() : m_count(0), m_sum(0) {
+  for (auto& bucket : m_buckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+void MetricHistogram::observe(uint64_t microseconds) {
+  size_t index = 0;
+  while (index < BUCKET_COUNT && microseconds > BUCKET_BOUNDS[index]) {
+    ++index;
+  }
+
+  m_buckets[index].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(microseconds, std::memory_order_relaxed);
+}
+
+MetricTimer::MetricTimer(MetricHistogram& histogram) :
+  m_histogram(histogram), m_start(std::chrono::steady_clock::now()), m_cancelled(false) {
+}
+
+MetricTimer::~MetricTimer() {
+  if (!m_cancelled) {
+    m_histogram.observe(elapsed());
+  }
+}
+
+uint64_t MetricTimer::elapsed() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+  static MetricsRegistry registry;
+  return registry;
+}
+
+MetricsRegistry::Family& MetricsRegistry::family(const std::string& name, const std::string& help, bool isHistogram) {
+  auto it = m_families.find(name);
+  if (it == m_families.end()) {
+    Family& family = m_families[name];
+    family.help = help;
+    family.isHistogram = isHistogram;
+    return family;
+  }
+
+  if (it->second.isHistogram != isHistogram) {
+    throw std::runtime_error("Metric " + name + " is already registered with a different type");
+  }
+
+  return it->second;
+}
+
+MetricCounter& MetricsRegistry::counter(const std::string& name, const std::string& help, const std::string& labels) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& counter = family(name, help, false).counters[labels];
+  if (!counter) {
+    counter.reset(new MetricCounter());
+  }
+
+  return *counter;
+}
+
+MetricHistogram& MetricsRegistry::histogram(const std::string& name, const std::string& help, const std::string& labels) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& histogram = family(name, help, true).histograms[labels];
+  if (!histogram) {
+    histogram.reset(new MetricHistogram());
+  }
+
+  return *histogram;
+}
+
+std::string MetricsRegistry::toPrometheus() const {
+  std::ostringstream out;
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (const auto& entry : m_families) {
+    const std::string& name = entry.first;
+    const Family& family = entry.second;
+    out << "# HELP " << name << ' ' << family.help << '\n';
+    out << "# TYPE " << name << ' ' << (family.isHistogram ? "histogram" : "counter") << '\n';
+
+    for (const auto& counter : family.counters) {
+      writeName(out, name, "", counter.first, std::string());
+      out << ' ' << counter.second->value() << '\n';
+    }
+
+    for (const auto& histogram : family.histograms) {
+      const std::string& labels = histogram.first;
+      uint64_t cumulative = 0;
+      for (size_t i = 0; i < MetricHistogram::BUCKET_COUNT; ++i) {
+        cumulative += histogram.second->bucket(i);
+        std::ostringstream bound;
+        bound << "le=\"";
+        writeSeconds(bound, MetricHistogram::BUCKET_BOUNDS[i]);
+        bound << '"';
+        writeName(out, name, "_bucket", labels, bound.str());
+        out << ' ' << cumulative << '\n';
+      }
+
+      // the bucket counters are read one by one, so derive the total from them
+      // to keep the exposition self-consistent
+      cumulative += histogram.second->bucket(MetricHistogram::BUCKET_COUNT);
+      writeName(out, name, "_bucket", labels, "le=\"+Inf\"");
+      out << ' ' << cumulative << '\n';
+      writeName(out, name, "_sum", labels, std::string());
+      out << ' ';
+      writeSeconds(out, histogram.second->sum());
+      out << '\n';
+      writeName(out, name, "_count", labels, std::string());
+      out << ' ' << cumulative << '\n';
+    }
+  }
+
+  return out.str();
+}
+
+std::string metricLabel(const std::string& name, const std::string& value) {
+  std::string label = name + "=\"";
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      label += '\\';
+      label += c;
+    } else if (c == '\n') {
+      label += "\\n";
+    } else {
+      label += c;
+    }
+  }
+
+  label += '"';
+  return label;
+}
+
+}
@@ -0,0 +1,105 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace common {
+
+class MetricCounter {
+public:
+  MetricCounter();
+
+  MetricCounter(const MetricCounter&) = delete;
+  MetricCounter& operator=(const MetricCounter&) = delete;
+
+  void increment(uint64_t value = 1) { m_value.fetch_add(value, std::memory_order_relaxed); }
+  uint64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint64_t> m_value;
+};
+
+// Latency histogram with fixed buckets from 50us to 10s. Observations are in
+// microseconds; buckets are cumulated only when the registry is scraped.
+class MetricHistogram {
+public:
+  static const size_t BUCKET_COUNT = 17;
+  static const uint64_t BUCKET_BOUNDS[BUCKET_COUNT];
+
+  MetricHistogram();
+
+  MetricHistogram(const MetricHistogram&) = delete;
+  MetricHistogram& operator=(const MetricHistogram&) = delete;
+
+  void observe(uint64_t microseconds);
+
+  uint64_t bucket(size_t index) const { return m_buckets[index].load(std::memory_order_relaxed); }
+  uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+  uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+
+private:
+  // the last bucket collects everything above the largest bound
+  std::atomic<uint64_t> m_buckets[BUCKET_COUNT + 1];
+  std::atomic<uint64_t> m_count;
+  std::atomic<uint64_t> m_sum;
+};
+
+// Observes the time between construction and destruction, unless cancelled.
+class MetricTimer {
+public:
+  explicit MetricTimer(MetricHistogram& histogram);
+  ~MetricTimer();
+
+  MetricTimer(const MetricTimer&) = delete;
+  MetricTimer& operator=(const MetricTimer&) = delete;
+
+  uint64_t elapsed() const;
+  void cancel() { m_cancelled = true; }
+
+private:
+  MetricHistogram& m_histogram;
+  std::chrono::steady_clock::time_point m_start;
+  bool m_cancelled;
+};
+
+// Process wide set of named metrics. Lookups take a lock, so hot paths should
+// resolve their metric once (e.g. into a function local static) and only touch
+// the returned object afterwards, which is lock-free.
+class MetricsRegistry {
+public:
+  static MetricsRegistry& instance();
+
+  // labels are in Prometheus syntax without braces, e.g. metricLabel("route", "/getinfo")
+  MetricCounter& counter(const std::string& name, const std::string& help, const std::string& labels = std::string());
+  MetricHistogram& histogram(const std::string& name, const std::string& help, const std::string& labels = std::string());
+
+  // Prometheus text exposition format, version 0.0.4
+  std::string toPrometheus() const;
+
+private:
+  struct Family {
+    std::string help;
+    bool isHistogram;
+    std::map<std::string, std::unique_ptr<MetricCounter>> counters;
+    std::map<std::string, std::unique_ptr<MetricHistogram>> histograms;
+  };
+
+  Family& family(const std::string& name, const std::string& help, bool isHistogram);
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, Family> m_families;
+};
+
+std::string metricLabel(const std::string& name, const std::string& value);
+
+}
@@ -138,6 +138,7 @@ namespace cn
 		const char CRYPTONOTE_BLOCKINDEXES_FILENAME[] = "blockindexes.dat";
 		const char CRYPTONOTE_BLOCKSCACHE_FILENAME[] = "blockscache.dat";
 		const char CRYPTONOTE_POOLDATA_FILENAME[] = "poolstate.bin";
+		const char CRYPTONOTE_POOLJOURNAL_FILENAME[] = "pooljournal.bin";
 		const char P2P_NET_DATA_FILENAME[] = "p2pstate.bin";
 		const char CRYPTONOTE_BLOCKCHAIN_INDICES_FILENAME[] = "blockchainindices.dat";
 		const char MINER_CONFIG_FILE_NAME[] = "miner_conf.json";
@@ -172,6 +173,11 @@ namespace cn
 	const size_t BLOCKS_SYNCHRONIZING_DEFAULT_COUNT = 128;		 // by default, blocks count in blocks downloading
 	const size_t COMMAND_RPC_GET_BLOCKS_FAST_MAX_COUNT = 1000;
     const size_t COMMAND_RPC_GET_OBJECTS_MAX_COUNT = 1000;
+    const size_t COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_MAX_COUNT = 10000; // total outputs over all amounts of one request
+    const size_t SIGNATURE_CACHE_MAX_SIZE = 100000; // verified key inputs remembered between pool admission and block import
+    const uint64_t DNS_CHECKPOINTS_CACHE_TTL = 600;           // seconds DNS checkpoint records are reused before a new lookup
+    const uint64_t DNS_CHECKPOINTS_STARTUP_TIMEOUT_MS = 5000; // how long daemon startup waits for the DNS checkpoint lookup
+    const size_t POOL_JOURNAL_COMPACTION_MIN_RECORDS = 1000;  // journal records before compaction is considered
 
 	const int P2P_DEFAULT_PORT = 15000;
 	const int RPC_DEFAULT_PORT = 16000;
@@ -0,0 +1,155 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "BlockHeaderIndex.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include "Serialization/ISerializer.h"
+
+namespace cn {
+
+namespace {
+
+// columns are written as raw arrays to keep cache loading fast
+template <typename T>
+void serializeColumn(std::vector<T>& column, common::StringView name, ISerializer& s) {
+  size_t size = column.size() * sizeof(T);
+  if (!s.beginArray(size, name)) {
+    throw std::runtime_error("Failed to serialize block header column");
+  }
+
+  if (s.type() == ISerializer::INPUT) {
+    if (size % sizeof(T) != 0) {
+      throw std::runtime_error("Invalid block header column size");
+    }
+
+    column.resize(size / sizeof(T));
+  }
+
+  if (size) {
+    s.binary(column.data(), size, "");
+  }
+
+  s.endArray();
+}
+
+}
+
+void BlockHeaderIndex::push(const Block& block, uint64_t cumulativeSize, difficulty_type cumulativeDifficulty, uint64_t generatedCoins) {
+  m_timestamps.push_back(block.timestamp);
+  m_cumulativeSizes.push_back(cumulativeSize);
+  m_cumulativeDifficulties.push_back(cumulativeDifficulty);
+  m_generatedCoins.push_back(generatedCoins);
+  m_majorVersions.push_back(block.majorVersion);
+  m_transactionCounts.push_back(static_cast<uint32_t>(block.transactionHashes.size()));
+}
+
+void BlockHeaderIndex::pop() {
+  assert(!empty());
+  m_timestamps.pop_back();
+  m_cumulativeSizes.pop_back();
+  m_cumulativeDifficulties.pop_back();
+  m_generatedCoins.pop_back();
+  m_majorVersions.pop_back();
+  m_transactionCounts.pop_back();
+}
+
+void BlockHeaderIndex::clear() {
+  m_timestamps.clear();
+  m_cumulativeSizes.clear();
+  m_cumulativeDifficulties.clear();
+  m_generatedCoins.clear();
+  m_majorVersions.clear();
+  m_transactionCounts.clear();
+}
+
+void BlockHeaderIndex::reserve(Height expectedHeight) {
+  m_timestamps.reserve(expectedHeight);
+  m_cumulativeSizes.reserve(expectedHeight);
+  m_cumulativeDifficulties.reserve(expectedHeight);
+  m_generatedCoins.reserve(expectedHeight);
+  m_majorVersions.reserve(expectedHeight);
+  m_transactionCounts.reserve(expectedHeight);
+}
+
+auto BlockHeaderIndex::size() const -> Height {
+  return static_cast<Height>(m_timestamps.size());
+}
+
+bool BlockHeaderIndex::empty() const {
+  return m_timestamps.empty();
+}
+
+uint64_t BlockHeaderIndex::timestamp(Height height) const {
+  assert(height < size());
+  return m_timestamps[height];
+}
+
+uint64_t BlockHeaderIndex::cumulativeSize(Height height) const {
+  assert(height < size());
+  return m_cumulativeSizes[height];
+}
+
+difficulty_type BlockHeaderIndex::cumulativeDifficulty(Height height) const {
+  assert(height < size());
+  return m_cumulativeDifficulties[height];
+}
+
+difficulty_type BlockHeaderIndex::difficulty(Height height) const {
+  assert(height < size());
+  return height == 0 ? m_cumulativeDifficulties[0] : m_cumulativeDifficulties[height] - m_cumulativeDifficulties[height - 1];
+}
+
+uint64_t BlockHeaderIndex::generatedCoins(Height height) const {
+  assert(height < size());
+  return m_generatedCoins[height];
+}
+
+uint8_t BlockHeaderIndex::majorVersion(Height height) const {
+  assert(height < size());
+  return m_majorVersions[height];
+}
+
+uint32_t BlockHeaderIndex::transactionCount(Height height) const {
+  assert(height < size());
+  return m_transactionCounts[height];
+}
+
+void BlockHeaderIndex::setGeneratedCoins(Height height, uint64_t generatedCoins) {
+  assert(height < size());
+  m_generatedCoins[height] = generatedCoins;
+}
+
+auto BlockHeaderIndex::timestampLowerBound(uint64_t timestamp, Height startHeight) const -> Height {
+  if (startHeight >= size()) {
+    return size();
+  }
+
+  auto bound = std::lower_bound(m_timestamps.begin() + startHeight, m_timestamps.end(), timestamp);
+  return static_cast<Height>(std::distance(m_timestamps.begin(), bound));
+}
+
+void BlockHeaderIndex::serialize(ISerializer& s) {
+  serializeColumn(m_timestamps, "timestamps", s);
+  serializeColumn(m_cumulativeSizes, "cumulative_sizes", s);
+  serializeColumn(m_cumulativeDifficulties, "cumulative_difficulties", s);
+  serializeColumn(m_generatedCoins, "generated_coins", s);
+  serializeColumn(m_majorVersions, "major_versions", s);
+  serializeColumn(m_transactionCounts, "transaction_counts", s);
+
+  if (s.type() == ISerializer::INPUT) {
+    size_t count = m_timestamps.size();
+    if (m_cumulativeSizes.size() != count || m_cumulativeDifficulties.size() != count || m_generatedCoins.size() != count ||
+        m_majorVersions.size() != count || m_transactionCounts.size() != count) {
+      clear();
+      throw std::runtime_error("Block header columns differ in length");
+    }
+  }
+}
+
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CryptoNoteCore/CryptoNoteBasic.h"
+#include "CryptoNoteCore/Difficulty.h"
+
+namespace cn {
+class ISerializer;
+
+/*
+  Per-height scalars of the main chain kept in parallel arrays, so difficulty,
+  median size and timestamp checks don't have to load whole blocks from the
+  swapped block storage. Heights run from 0 to size() - 1, like the blocks.
+*/
+class BlockHeaderIndex {
+public:
+  using Height = uint32_t;
+
+  void push(const Block& block, uint64_t cumulativeSize, difficulty_type cumulativeDifficulty, uint64_t generatedCoins);
+  void pop();
+  void clear();
+  void reserve(Height expectedHeight);
+  Height size() const;
+  bool empty() const;
+
+  uint64_t timestamp(Height height) const;
+  uint64_t cumulativeSize(Height height) const;
+  difficulty_type cumulativeDifficulty(Height height) const;
+  difficulty_type difficulty(Height height) const;
+  uint64_t generatedCoins(Height height) const;
+  uint8_t majorVersion(Height height) const;
+  // Number of transactions besides the coinbase one
+  uint32_t transactionCount(Height height) const;
+
+  void setGeneratedCoins(Height height, uint64_t generatedCoins);
+
+  // First height from startHeight on whose timestamp is not less than the given one, size() if there is none
+  Height timestampLowerBound(uint64_t timestamp, Height startHeight) const;
+
+  void serialize(ISerializer& s);
+
+private:
+  std::vector<uint64_t> m_timestamps;
+  std::vector<uint64_t> m_cumulativeSizes;
+  std::vector<difficulty_type> m_cumulativeDifficulties;
+  std::vector<uint64_t> m_generatedCoins;
+  std::vector<uint8_t> m_majorVersions;
+  std::vector<uint32_t> m_transactionCounts;
+};
+}
@@ -15,6 +15,8 @@
 #include <boost/foreach.hpp>
 #include "Common/Math.h"
 #include "Common/int-util.h"
+#include "Common/MemoryInputStream.h"
+#include "Common/Metrics.h"
 #include "Common/ShuffleGenerator.h"
 #include "Common/StdInputStream.h"
 #include "Common/StdOutputStream.h"
@@ -23,6 +25,7 @@
 #include "CryptoNoteTools.h"
 #include "TransactionExtra.h"
 #include "CryptoNoteConfig.h"
+#include "System/MemoryMappedFile.h"
 #include "parallel_hashmap/phmap_dump.h"
 
 using namespace logging;
@@ -58,8 +61,8 @@ namespace std
   }
 } // namespace std
 
-#define CURRENT_BLOCKCACHE_STORAGE_ARCHIVE_VER 5
-#define CURRENT_BLOCKCHAININDICES_STORAGE_ARCHIVE_VER 1
+#define CURRENT_BLOCKCACHE_STORAGE_ARCHIVE_VER 6
+#define CURRENT_BLOCKCHAININDICES_STORAGE_ARCHIVE_VER 2
 
 namespace cn
 {
@@ -67,6 +70,33 @@ namespace cn
   class BlockchainIndicesSerializer;
 } // namespace cn
 
+namespace
+{
+  uint64_t microsecondsSince(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  bool checkKeyInputSignature(const crypto::Hash &prefixHash, const crypto::KeyImage &keyImage, const std::vector<const crypto::PublicKey *> &outputKeys,
+                              const std::vector<crypto::Signature> &signatures)
+  {
+    static const crypto::KeyImage I = {{0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+    static const crypto::KeyImage L = {{0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10}};
+    if (!(crypto::scalarmultKey(keyImage, L) == I))
+    {
+      return false;
+    }
+
+    return crypto::check_ring_signature(prefixHash, keyImage, outputKeys, signatures.data());
+  }
+
+  common::MetricHistogram &blockPhaseLatency(const char *phase)
+  {
+    return common::MetricsRegistry::instance().histogram("conceal_block_phase_seconds",
+        "Time spent in each phase of adding a block to the main chain", common::metricLabel("phase", phase));
+  }
+} // namespace
+
 namespace cn
 {
 
@@ -201,6 +231,9 @@ namespace cn
       logger(INFO) << operation << "block index";
       s(m_bs.m_blockIndex, "block_index");
 
+      logger(INFO) << operation << "block headers";
+      s(m_bs.m_headerIndex, "header_index");
+
       logger(INFO) << operation << "transaction map";
       if (s.type() == ISerializer::INPUT)
       {
@@ -359,6 +392,7 @@ namespace cn
     m_currency(currency),
     m_tx_pool(tx_pool),
     m_checkpoints(logger),
+    m_signatureCache(SIGNATURE_CACHE_MAX_SIZE),
     m_upgradeDetectorV2(currency, m_blocks, BLOCK_MAJOR_VERSION_2, logger),
     m_upgradeDetectorV3(currency, m_blocks, BLOCK_MAJOR_VERSION_3, logger),
     m_upgradeDetectorV4(currency, m_blocks, BLOCK_MAJOR_VERSION_4, logger),
@@ -438,6 +472,11 @@ namespace cn
     return this->haveTransactionKeyImagesAsSpent(tx);
   }
 
+  bool Blockchain::preverifyTransaction(const cn::Transaction &tx)
+  {
+    return preverifyTransactionSignatures(tx, getObjectHash(*static_cast<const TransactionPrefix *>(&tx)));
+  }
+
   // pre m_blockchain_lock is locked
 
   bool Blockchain::checkTransactionSize(size_t blobSize)
@@ -522,7 +561,7 @@ namespace cn
           uint64_t checkBlockHeight = 24732;
           uint64_t checkMinimum = 13000000000000;
           if (!m_testnet && m_blocks.size() > checkBlockHeight && 
-              m_blocks[checkBlockHeight].already_generated_coins < checkMinimum)
+              m_headerIndex.generatedCoins(checkBlockHeight) < checkMinimum)
           {
             logger(WARNING, BRIGHT_YELLOW) << "Invalid blocks cache, rebuilding internal structures";
             if (!rebuildBlocks())
@@ -634,8 +673,8 @@ namespace cn
 
       update_next_comulative_size_limit();
 
-      uint64_t timestamp_diff = time(nullptr) - m_blocks.back().bl.timestamp;
-      if (!m_blocks.back().bl.timestamp)
+      uint64_t timestamp_diff = time(nullptr) - m_headerIndex.timestamp(m_headerIndex.size() - 1);
+      if (!m_headerIndex.timestamp(m_headerIndex.size() - 1))
       {
         timestamp_diff = time(nullptr) - 1341378000;
       }
@@ -686,10 +725,12 @@ namespace cn
     try 
     {
       m_blockIndex.clear();
+      m_headerIndex.clear();
       m_transactionMap.clear();
       m_spent_keys.clear();
       m_outputs.clear();
       m_multisignatureOutputs.clear();
+      m_headerIndex.reserve(static_cast<uint32_t>(m_blocks.size()));
       for (uint32_t b = 0; b < m_blocks.size(); ++b)
       {
         if (b % 1000 == 0)
@@ -700,6 +741,7 @@ namespace cn
         const BlockEntry &block = m_blocks[b];
         crypto::Hash blockHash = get_block_hash(block.bl);
         m_blockIndex.push(blockHash);
+        m_headerIndex.push(block.bl, block.block_cumulative_size, block.cumulative_difficulty, block.already_generated_coins);
         uint64_t interest = 0;
         for (uint32_t t = 0; t < block.transactions.size(); ++t)
         {
@@ -807,6 +849,7 @@ namespace cn
         uint64_t alreadyGeneratedCoins = alreadyGeneratedCoinsPrev + emissionChange + interest;
         block.already_generated_coins = alreadyGeneratedCoins;
         m_blocks.replace(b, block);
+        m_headerIndex.setGeneratedCoins(b, alreadyGeneratedCoins);
         alreadyGeneratedCoinsPrev = alreadyGeneratedCoins;
       }
 
@@ -896,6 +939,7 @@ namespace cn
     std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
     m_blocks.clear();
     m_blockIndex.clear();
+    m_headerIndex.clear();
     m_transactionMap.clear();
 
     m_spent_keys.clear();
@@ -1030,8 +1074,8 @@ namespace cn
 
     for (; offset < m_blocks.size(); offset++)
     {
-      timestamps.push_back(m_blocks[offset].bl.timestamp);
-      commulative_difficulties.push_back(m_blocks[offset].cumulative_difficulty);
+      timestamps.push_back(m_headerIndex.timestamp(static_cast<uint32_t>(offset)));
+      commulative_difficulties.push_back(m_headerIndex.cumulativeDifficulty(static_cast<uint32_t>(offset)));
     }
 
     uint64_t block_index = m_blocks.size();
@@ -1053,41 +1097,33 @@ namespace cn
 
   uint64_t Blockchain::getBlockTimestamp(uint32_t height)
   {
-    assert(height < m_blocks.size());
-    return m_blocks[height].bl.timestamp;
+    assert(height < m_headerIndex.size());
+    return m_headerIndex.timestamp(height);
   }
 
   uint64_t Blockchain::getCoinsInCirculation()
   {
     std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
-    if (m_blocks.empty())
+    if (m_headerIndex.empty())
     {
       return 0;
     }
     else
     {
-      return m_blocks.back().already_generated_coins;
+      return m_headerIndex.generatedCoins(m_headerIndex.size() - 1);
     }
   }
 
   uint64_t Blockchain::coinsEmittedAtHeight(uint64_t height)
   {
     std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
-    const auto &block = m_blocks[height];
-    return block.already_generated_coins;
+    return m_headerIndex.generatedCoins(static_cast<uint32_t>(height));
   }
 
   difficulty_type Blockchain::difficultyAtHeight(uint64_t height)
   {
     std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
-    const auto &current = m_blocks[height];
-    if (height < 1)
-    {
-      return current.cumulative_difficulty;
-    }
-
-    const auto &previous = m_blocks[height - 1];
-    return current.cumulative_difficulty - previous.cumulative_difficulty;
+    return m_headerIndex.difficulty(static_cast<uint32_t>(height));
   }
 
   uint8_t Blockchain::get_block_major_version_for_height(uint64_t height) const
@@ -1341,8 +1377,8 @@ namespace cn
 
       for (; main_chain_start_offset < main_chain_stop_offset; ++main_chain_start_offset)
       {
-        timestamps.push_back(m_blocks[main_chain_start_offset].bl.timestamp);
-        commulative_difficulties.push_back(m_blocks[main_chain_start_offset].cumulative_difficulty);
+        timestamps.push_back(m_headerIndex.timestamp(static_cast<uint32_t>(main_chain_start_offset)));
+        commulative_difficulties.push_back(m_headerIndex.cumulativeDifficulty(static_cast<uint32_t>(main_chain_start_offset)));
       }
 
       if (!((alt_chain.size() + timestamps.size()) <= m_currency.difficultyBlocksCountByBlockVersion(BlockMajorVersion)))
@@ -1508,7 +1544,7 @@ namespace cn
     size_t start_offset = (from_height + 1) - std::min((from_height + 1), count);
     for (size_t i = start_offset; i != from_height + 1; i++)
     {
-      sz.push_back(m_blocks[i].block_cumulative_size);
+      sz.push_back(m_headerIndex.cumulativeSize(static_cast<uint32_t>(i)));
     }
 
     return true;
@@ -1550,7 +1586,7 @@ namespace cn
 
     do
     {
-      timestamps.push_back(m_blocks[start_top_height].bl.timestamp);
+      timestamps.push_back(m_headerIndex.timestamp(static_cast<uint32_t>(start_top_height)));
       if (start_top_height == 0)
       {
         break;
@@ -1577,8 +1613,9 @@ namespace cn
         return false;
       }
 
-      /* in the absence of a better solution, we fetch checkpoints from dns records */
-      m_checkpoints.load_checkpoints_from_dns();
+      /* in the absence of a better solution, we fetch checkpoints from dns records.
+         Don't wait for the lookup under the blockchain lock; a refresh still in flight lands in the DNS cache. */
+      m_checkpoints.load_checkpoints_from_dns(std::chrono::milliseconds(0));
 
       if (!m_checkpoints.is_alternative_block_allowed(getCurrentBlockchainHeight(), block_height))
       {
@@ -1639,8 +1676,7 @@ namespace cn
             return false;
           }
 
-          crypto::Hash h = NULL_HASH;
-          get_block_hash(m_blocks[bei.height - 1].bl, h);
+          crypto::Hash h = m_blockIndex.getBlockId(bei.height - 1);
           if (!(h == bei.bl.previousBlockHash))
           {
             logger(ERROR, BRIGHT_RED) << "alternative chain have wrong connection to main chain";
@@ -1719,7 +1755,7 @@ namespace cn
           return false;
         }
 
-        bei.cumulative_difficulty = alt_chain.size() ? it_prev->second.cumulative_difficulty : m_blocks[mainPrevHeight].cumulative_difficulty;
+        bei.cumulative_difficulty = alt_chain.size() ? it_prev->second.cumulative_difficulty : m_headerIndex.cumulativeDifficulty(mainPrevHeight);
         bei.cumulative_difficulty += current_diff;
 
     #ifdef _DEBUG
@@ -1759,10 +1795,10 @@ namespace cn
           }
           return r;
         }
-        else if (m_blocks.back().cumulative_difficulty < bei.cumulative_difficulty) //check if difficulty bigger then in main chain
+        else if (m_headerIndex.cumulativeDifficulty(m_headerIndex.size() - 1) < bei.cumulative_difficulty) //check if difficulty bigger then in main chain
         {
           //do reorganize!
-          logger(INFO, BRIGHT_GREEN) << "###### REORGANIZE on height: " << m_alternative_chains[alt_chain.front()].height << " of " << m_blocks.size() - 1 << " with cum_difficulty " << m_blocks.back().cumulative_difficulty
+          logger(INFO, BRIGHT_GREEN) << "###### REORGANIZE on height: " << m_alternative_chains[alt_chain.front()].height << " of " << m_blocks.size() - 1 << " with cum_difficulty " << m_headerIndex.cumulativeDifficulty(m_headerIndex.size() - 1)
                                      << ENDL << " alternative blockchain size: " << alt_chain.size() << " with cum_difficulty " << bei.cumulative_difficulty;
 
           bool r = switch_to_alternative_blockchain(alt_chain, false);
@@ -1972,6 +2008,38 @@ namespace cn
     return 0;
   }
 
+  bool Blockchain::pickRandomOuts(uint64_t amount, uint64_t count, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount &result_outs)
+  {
+    result_outs.amount = amount;
+    auto it = m_outputs.find(amount);
+    if (it == m_outputs.end())
+    {
+      logger(ERROR, BRIGHT_RED) << "COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS: not outs for amount " << amount << ", wallet should use some real outs when it lookup for some mix, so, at least one out for this amount should exist";
+      return true; //actually this is strange situation, wallet should use some real outs when it lookup for some mix, so, at least one out for this amount should exist
+    }
+
+    std::vector<std::pair<TransactionIndex, uint16_t>> &amount_outs = it->second;
+    //it is not good idea to use top fresh outs, because it increases possibility of transaction canceling on split
+    //lets find upper bound of not fresh outs
+    size_t up_index_limit = find_end_of_allowed_index(amount_outs);
+    if (!(up_index_limit <= amount_outs.size()))
+    {
+      logger(ERROR, BRIGHT_RED) << "internal error: find_end_of_allowed_index returned wrong index=" << up_index_limit << ", with amount_outs.size = " << amount_outs.size();
+      return false;
+    }
+
+    if (up_index_limit > 0)
+    {
+      ShuffleGenerator<size_t, crypto::random_engine<size_t>> generator(up_index_limit);
+      for (uint64_t j = 0; j < up_index_limit && result_outs.outs.size() < count; ++j)
+      {
+        add_out_to_get_random_outs(amount_outs, result_outs, amount, generator());
+      }
+    }
+
+    return true;
+  }
+
   bool Blockchain::getRandomOutsByAmount(const COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::request &req, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::response &res)
   {
     std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
@@ -1979,33 +2047,30 @@ namespace cn
     for (uint64_t amount : req.amounts)
     {
       COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount &result_outs = *res.outs.insert(res.outs.end(), COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount());
-      result_outs.amount = amount;
-      auto it = m_outputs.find(amount);
-      if (it == m_outputs.end())
-      {
-        logger(ERROR, BRIGHT_RED) << "COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS: not outs for amount " << amount << ", wallet should use some real outs when it lookup for some mix, so, at least one out for this amount should exist";
-        continue; //actually this is strange situation, wallet should use some real outs when it lookup for some mix, so, at least one out for this amount should exist
-      }
-
-      std::vector<std::pair<TransactionIndex, uint16_t>> &amount_outs = it->second;
-      //it is not good idea to use top fresh outs, because it increases possibility of transaction canceling on split
-      //lets find upper bound of not fresh outs
-      size_t up_index_limit = find_end_of_allowed_index(amount_outs);
-      if (!(up_index_limit <= amount_outs.size()))
+      if (!pickRandomOuts(amount, req.outs_count, result_outs))
       {
-        logger(ERROR, BRIGHT_RED) << "internal error: find_end_of_allowed_index returned wrong index=" << up_index_limit << ", with amount_outs.size = " << amount_outs.size();
         return false;
       }
+    }
+    return true;
+  }
+
+  bool Blockchain::getRandomOutsBulk(const COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::request &req, COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::response &res)
+  {
+    std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
 
-      if (up_index_limit > 0)
+    res.outs.reserve(req.amounts.size());
+    for (const auto &amountCount : req.amounts)
+    {
+      res.outs.emplace_back();
+      if (!pickRandomOuts(amountCount.amount, amountCount.count, res.outs.back()))
       {
-        ShuffleGenerator<size_t, crypto::random_engine<size_t>> generator(up_index_limit);
-        for (uint64_t j = 0; j < up_index_limit && result_outs.outs.size() < req.outs_count; ++j)
-        {
-          add_out_to_get_random_outs(amount_outs, result_outs, amount, generator());
-        }
+        return false;
       }
     }
+
+    // every pick above was made against this chain state
+    res.height = getCurrentBlockchainHeight();
     return true;
   }
 
@@ -2029,10 +2094,7 @@ namespace cn
       logger(ERROR, BRIGHT_RED) << "wrong block index i = " << i << " at Blockchain::block_difficulty()";
       return false;
     }
-    if (i == 0)
-      return m_blocks[i].cumulative_difficulty;
-
-    return m_blocks[i].cumulative_difficulty - m_blocks[i - 1].cumulative_difficulty;
+    return m_headerIndex.difficulty(static_cast<uint32_t>(i));
   }
 
   void Blockchain::print_blockchain(uint64_t start_index, uint64_t end_index)
@@ -2047,9 +2109,10 @@ namespace cn
 
     for (size_t i = start_index; i != m_blocks.size() && i != end_index; i++)
     {
-      ss << "height " << i << ", timestamp " << m_blocks[i].bl.timestamp << ", cumul_dif " << m_blocks[i].cumulative_difficulty << ", cumul_size " << m_blocks[i].block_cumulative_size
-         << "\nid\t\t" << get_block_hash(m_blocks[i].bl)
-         << "\ndifficulty\t\t" << blockDifficulty(i) << ", nonce " << m_blocks[i].bl.nonce << ", tx_count " << m_blocks[i].bl.transactionHashes.size() << ENDL;
+      auto height = static_cast<uint32_t>(i);
+      ss << "height " << i << ", timestamp " << m_headerIndex.timestamp(height) << ", cumul_dif " << m_headerIndex.cumulativeDifficulty(height) << ", cumul_size " << m_headerIndex.cumulativeSize(height)
+         << "\nid\t\t" << m_blockIndex.getBlockId(height)
+         << "\ndifficulty\t\t" << m_headerIndex.difficulty(height) << ", nonce " << m_blocks[i].bl.nonce << ", tx_count " << m_headerIndex.transactionCount(height) << ENDL;
     }
     logger(INFO) << "Blockchain:\n"
                  << ss.str();
@@ -2204,7 +2267,7 @@ namespace cn
       logger(ERROR, BRIGHT_RED) << "internal error: max used block index=" << max_used_block_height << " is not less then blockchain size = " << m_blocks.size();
       return false;
     }
-    get_block_hash(m_blocks[max_used_block_height].bl, max_used_block_id);
+    max_used_block_id = m_blockIndex.getBlockId(max_used_block_height);
     return true;
   }
 
@@ -2376,14 +2439,102 @@ namespace cn
       return true;
     }
 
-    static const crypto::KeyImage I = {{0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-    static const crypto::KeyImage L = {{0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10}};
-    if (!(scalarmultKey(txin.keyImage, L) == I))
+    static common::MetricCounter &cacheHits = common::MetricsRegistry::instance().counter(
+        "conceal_signature_cache_hits_total", "Key inputs whose ring signature was already verified");
+    static common::MetricCounter &cacheMisses = common::MetricsRegistry::instance().counter(
+        "conceal_signature_cache_misses_total", "Key inputs whose ring signature had to be verified");
+
+    // the key covers the resolved output keys, so inputs checked by the pool are not verified again in a block
+    crypto::Hash cacheKey = SignatureCache::makeKey(tx_prefix_hash, txin.keyImage, output_keys, sig);
+    if (m_signatureCache.contains(cacheKey))
+    {
+      cacheHits.increment();
+      return true;
+    }
+
+    cacheMisses.increment();
+
+    if (!checkKeyInputSignature(tx_prefix_hash, txin.keyImage, output_keys, sig))
     {
       return false;
     }
 
-    return crypto::check_ring_signature(tx_prefix_hash, txin.keyImage, output_keys, sig.data());
+    m_signatureCache.add(cacheKey);
+    return true;
+  }
+
+  bool Blockchain::preverifyTransactionSignatures(const Transaction &tx, const crypto::Hash &tx_prefix_hash)
+  {
+    struct keys_collector
+    {
+      std::vector<crypto::PublicKey> &m_keys;
+
+      bool handle_output(const Transaction &tx, const TransactionOutput &out, size_t transactionOutputIndex)
+      {
+        if (out.target.type() != typeid(KeyOutput))
+        {
+          return false;
+        }
+
+        m_keys.push_back(boost::get<KeyOutput>(out.target).key);
+        return true;
+      }
+    };
+
+    for (size_t inputIndex = 0; inputIndex < tx.inputs.size() && inputIndex < tx.signatures.size(); ++inputIndex)
+    {
+      if (tx.inputs[inputIndex].type() != typeid(KeyInput))
+      {
+        continue;
+      }
+
+      const KeyInput &in_to_key = boost::get<KeyInput>(tx.inputs[inputIndex]);
+      const std::vector<crypto::Signature> &sig = tx.signatures[inputIndex];
+
+      // keys are copied, the outputs they come from may be swapped out once the lock is released
+      std::vector<crypto::PublicKey> keys;
+      {
+        std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
+        if (isInCheckpointZone(getCurrentBlockchainHeight()))
+        {
+          return true;
+        }
+
+        keys_collector collector{keys};
+        if (!scanOutputKeysForIndexes(in_to_key, collector))
+        {
+          // rings that can't be resolved yet are left to the full check
+          continue;
+        }
+      }
+
+      if (keys.size() != in_to_key.outputIndexes.size() || sig.size() != keys.size())
+      {
+        continue;
+      }
+
+      std::vector<const crypto::PublicKey *> output_keys;
+      output_keys.reserve(keys.size());
+      for (const auto &key : keys)
+      {
+        output_keys.push_back(&key);
+      }
+
+      crypto::Hash cacheKey = SignatureCache::makeKey(tx_prefix_hash, in_to_key.keyImage, output_keys, sig);
+      if (m_signatureCache.contains(cacheKey))
+      {
+        continue;
+      }
+
+      if (!checkKeyInputSignature(tx_prefix_hash, in_to_key.keyImage, output_keys, sig))
+      {
+        return false;
+      }
+
+      m_signatureCache.add(cacheKey);
+    }
+
+    return true;
   }
 
   uint64_t Blockchain::get_adjusted_time() const
@@ -2418,7 +2569,7 @@ namespace cn
     size_t offset = m_blocks.size() <= m_currency.timestampCheckWindow() ? 0 : m_blocks.size() - m_currency.timestampCheckWindow();
     for (; offset != m_blocks.size(); ++offset)
     {
-      timestamps.push_back(m_blocks[offset].bl.timestamp);
+      timestamps.push_back(m_headerIndex.timestamp(static_cast<uint32_t>(offset)));
     }
 
     return check_block_timestamp(std::move(timestamps), b);
@@ -2510,6 +2661,10 @@ namespace cn
 
   bool Blockchain::addNewBlock(const Block &bl_, block_verification_context &bvc)
   {
+    static common::MetricHistogram &addBlockLatency = common::MetricsRegistry::instance().histogram(
+        "conceal_block_add_seconds", "Time spent in Blockchain::addNewBlock, including alternative blocks");
+    common::MetricTimer timer(addBlockLatency);
+
     try
     {
       //copy block here to let modify block.target
@@ -2613,6 +2768,11 @@ namespace cn
 
   bool Blockchain::pushBlock(const Block &blockData, const std::vector<Transaction> &transactions, const crypto::Hash &id, block_verification_context &bvc)
   {
+    static common::MetricHistogram &validationLatency = blockPhaseLatency("validation");
+    static common::MetricHistogram &powLatency = blockPhaseLatency("pow");
+    static common::MetricHistogram &ringSignatureLatency = blockPhaseLatency("ring_signatures");
+    static common::MetricHistogram &commitLatency = blockPhaseLatency("commit");
+
     std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
 
     auto blockProcessingStart = std::chrono::steady_clock::now();
@@ -2692,6 +2852,8 @@ namespace cn
     }
 
     auto longhash_calculating_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - longhashTimeStart).count();
+    const uint64_t powTime = microsecondsSince(longhashTimeStart);
+    uint64_t ringSignatureTime = 0;
 
     if (!prevalidate_miner_transaction(blockData, static_cast<uint32_t>(m_blocks.size())))
     {
@@ -2731,11 +2893,13 @@ namespace cn
         logger(INFO, BRIGHT_WHITE) << "Block " << blockHash << " can't contain transaction " << tx_id << " because it has invalid version " << transactions[i].version;
       }
 
+      auto inputsCheckStart = std::chrono::steady_clock::now();
       if (!checkTransactionInputs(transactions[i]))
       {
         isTransactionValid = false;
         logger(INFO, BRIGHT_WHITE) << "Block " << blockHash << " has at least one transaction with wrong inputs: " << tx_id;
       }
+      ringSignatureTime += microsecondsSince(inputsCheckStart);
 
       if (!check_tx_outputs(transactions[i], block.height))
       {
@@ -2769,7 +2933,7 @@ namespace cn
 
     int64_t emissionChange = 0;
     uint64_t reward = 0;
-    uint64_t already_generated_coins = m_blocks.empty() ? 0 : m_blocks.back().already_generated_coins;
+    uint64_t already_generated_coins = m_headerIndex.empty() ? 0 : m_headerIndex.generatedCoins(m_headerIndex.size() - 1);
     if (!validate_miner_transaction(blockData, block.height, cumulative_block_size, already_generated_coins, fee_summary, reward, emissionChange))
     {
       logger(INFO, BRIGHT_WHITE) << "Block " << blockHash << " has invalid miner transaction";
@@ -2782,11 +2946,12 @@ namespace cn
     block.block_cumulative_size = cumulative_block_size;
     block.cumulative_difficulty = currentDifficulty;
     block.already_generated_coins = already_generated_coins + emissionChange + interestSummary;
-    if (m_blocks.size() > 0)
+    if (!m_headerIndex.empty())
     {
-      block.cumulative_difficulty += m_blocks.back().cumulative_difficulty;
+      block.cumulative_difficulty += m_headerIndex.cumulativeDifficulty(m_headerIndex.size() - 1);
     }
 
+    auto commitStart = std::chrono::steady_clock::now();
     pushBlock(block);
     pushToDepositIndex(block, interestSummary);
 
@@ -2808,6 +2973,13 @@ namespace cn
     m_upgradeDetectorV8.blockPushed();
     update_next_comulative_size_limit();
 
+    const uint64_t commitTime = microsecondsSince(commitStart);
+    const uint64_t totalTime = microsecondsSince(blockProcessingStart);
+    powLatency.observe(powTime);
+    ringSignatureLatency.observe(ringSignatureTime);
+    commitLatency.observe(commitTime);
+    validationLatency.observe(totalTime - std::min(totalTime, powTime + ringSignatureTime + commitTime));
+
     return true;
   }
 
@@ -2866,11 +3038,13 @@ namespace cn
 
     m_blocks.push_back(block);
     m_blockIndex.push(blockHash);
+    m_headerIndex.push(block.bl, block.block_cumulative_size, block.cumulative_difficulty, block.already_generated_coins);
 
     m_timestampIndex.add(block.bl.timestamp, blockHash);
     m_generatedTransactionsIndex.add(block.bl);
 
     assert(m_blockIndex.size() == m_blocks.size());
+    assert(m_headerIndex.size() == m_blocks.size());
 
     return true;
   }
@@ -2901,8 +3075,10 @@ namespace cn
     m_depositIndex.popBlock();
     m_blocks.pop_back();
     m_blockIndex.pop();
+    m_headerIndex.pop();
 
     assert(m_blockIndex.size() == m_blocks.size());
+    assert(m_headerIndex.size() == m_blocks.size());
 
     m_upgradeDetectorV2.blockPopped();
     m_upgradeDetectorV3.blockPopped();
@@ -3286,8 +3462,10 @@ namespace cn
 
     m_blocks.pop_back();
     m_blockIndex.pop();
+    m_headerIndex.pop();
 
     assert(m_blockIndex.size() == m_blocks.size());
+    assert(m_headerIndex.size() == m_blocks.size());
     return true;
   }
 
@@ -3295,17 +3473,15 @@ namespace cn
   {
     std::lock_guard<decltype(m_blockchain_lock)> lk(m_blockchain_lock);
 
-    assert(startOffset < m_blocks.size());
+    assert(startOffset < m_headerIndex.size());
 
-    auto bound = std::lower_bound(m_blocks.begin() + startOffset, m_blocks.end(), timestamp - m_currency.blockFutureTimeLimit(),
-                                  [](const BlockEntry &b, uint64_t timestamp) { return b.bl.timestamp < timestamp; });
-
-    if (bound == m_blocks.end())
+    uint32_t bound = m_headerIndex.timestampLowerBound(timestamp - m_currency.blockFutureTimeLimit(), static_cast<uint32_t>(startOffset));
+    if (bound == m_headerIndex.size())
     {
       return false;
     }
 
-    height = static_cast<uint32_t>(std::distance(m_blocks.begin(), bound));
+    height = bound;
     return true;
   }
 
@@ -3339,7 +3515,7 @@ namespace cn
     uint32_t height = 0;
     if (m_blockIndex.getBlockHeight(hash, height))
     {
-      generatedCoins = m_blocks[height].already_generated_coins;
+      generatedCoins = m_headerIndex.generatedCoins(height);
       return true;
     }
 
@@ -3363,7 +3539,7 @@ namespace cn
     uint32_t height = 0;
     if (m_blockIndex.getBlockHeight(hash, height))
     {
-      size = m_blocks[height].block_cumulative_size;
+      size = m_headerIndex.cumulativeSize(height);
       return true;
     }
 
@@ -3434,7 +3610,16 @@ namespace cn
     bool needsRebuild = false;
     try
     {
-      loadFromBinaryFile(loader, appendPath(m_config_folder, m_currency.blockchinIndicesFileName()));
+      // The indices are stored as flat arrays, so map the file and copy them out in bulk
+      platform_system::MemoryMappedFile indicesFile;
+      std::error_code ec;
+      indicesFile.open(appendPath(m_config_folder, m_currency.blockchinIndicesFileName()), ec);
+      if (!ec)
+      {
+        common::MemoryInputStream stream(indicesFile.data(), static_cast<size_t>(indicesFile.size()));
+        BinaryInputStreamSerializer in(stream);
+        cn::serialize(loader, in);
+      }
       needsRebuild = !loader.loaded();
     }
     catch (const std::exception &)
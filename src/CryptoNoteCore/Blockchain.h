@@ -14,12 +14,14 @@
 
 #include "Common/ObserverManager.h"
 #include "Common/Util.h"
+#include "CryptoNoteCore/BlockHeaderIndex.h"
 #include "CryptoNoteCore/BlockIndex.h"
 #include "CryptoNoteCore/Checkpoints.h"
 #include "CryptoNoteCore/Currency.h"
 #include "CryptoNoteCore/DepositIndex.h"
 #include "CryptoNoteCore/IBlockchainStorageObserver.h"
 #include "CryptoNoteCore/ITransactionValidator.h"
+#include "CryptoNoteCore/SignatureCache.h"
 #include "CryptoNoteCore/SwappedVector.h"
 #include "CryptoNoteCore/CryptoNoteFormatUtils.h"
 #include "CryptoNoteCore/TransactionPool.h"
@@ -41,6 +43,8 @@ namespace cn
   struct COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_request;
   struct COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_response;
   struct COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_outs_for_amount;
+  struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request;
+  struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response;
 
   using cn::BlockInfo;
   class Blockchain : public cn::ITransactionValidator
@@ -60,6 +64,7 @@ namespace cn
     bool checkTransactionInputs(const cn::Transaction &tx, BlockInfo &maxUsedBlock, BlockInfo &lastFailed) override;
     bool haveSpentKeyImages(const cn::Transaction &tx) override;
     bool checkTransactionSize(size_t blobSize) override;
+    bool preverifyTransaction(const cn::Transaction &tx) override;
 
     bool init() { return init(tools::getDefaultDataDirectory(), true, m_testnet); }
     bool init(const std::string &config_folder, bool load_existing, bool testnet);
@@ -104,10 +109,14 @@ namespace cn
     uint8_t blockMajorVersion;
     bool handleGetObjects(NOTIFY_REQUEST_GET_OBJECTS_request &arg, NOTIFY_RESPONSE_GET_OBJECTS_request &rsp); //Deprecated. Should be removed with CryptoNoteProtocolHandler.
     bool getRandomOutsByAmount(const COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_request &req, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_response &res);
+    bool getRandomOutsBulk(const COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request &req, COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response &res);
     bool getBackwardBlocksSize(size_t from_height, std::vector<size_t> &sz, size_t count);
     bool getTransactionOutputGlobalIndexes(const crypto::Hash &tx_id, std::vector<uint32_t> &indexs);
     bool get_out_by_msig_gindex(uint64_t amount, uint64_t gindex, MultisignatureOutput &out);
     bool checkTransactionInputs(const Transaction &tx, uint32_t &pmax_used_block_height, crypto::Hash &max_used_block_id, BlockInfo *tail = nullptr);
+    // Checks the ring signatures of the key inputs with the lock held only while ring members are resolved.
+    // Returns false only for a signature that is wrong; verified inputs are remembered for the full check
+    bool preverifyTransactionSignatures(const Transaction &tx, const crypto::Hash &tx_prefix_hash);
     uint64_t getCurrentCumulativeBlocksizeLimit() const;
     uint64_t blockDifficulty(size_t i);
     bool getBlockContainingTransaction(const crypto::Hash &txId, crypto::Hash &blockId, uint32_t &blockHeight);
@@ -286,6 +295,7 @@ namespace cn
     std::string m_config_folder;
     Checkpoints m_checkpoints;
     std::atomic<bool> m_is_in_checkpoint_zone;
+    SignatureCache m_signatureCache;
 
     using Blocks = SwappedVector<BlockEntry>;
     using BlockMap = parallel_flat_hash_map<crypto::Hash, uint32_t>;
@@ -297,6 +307,7 @@ namespace cn
 
     Blocks m_blocks;
     cn::BlockIndex m_blockIndex;
+    cn::BlockHeaderIndex m_headerIndex;
     cn::DepositIndex m_depositIndex;
     TransactionMap m_transactionMap;
     MultisignatureOutputsContainer m_multisignatureOutputs;
@@ -329,6 +340,7 @@ namespace cn
     bool add_out_to_get_random_outs(std::vector<std::pair<TransactionIndex, uint16_t>> &amount_outs, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_outs_for_amount &result_outs, uint64_t amount, size_t i);
     bool is_tx_spendtime_unlocked(uint64_t unlock_time);
     size_t find_end_of_allowed_index(const std::vector<std::pair<TransactionIndex, uint16_t>> &amount_outs);
+    bool pickRandomOuts(uint64_t amount, uint64_t count, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_outs_for_amount &result_outs);
     bool check_block_timestamp_main(const Block &b);
     bool check_block_timestamp(std::vector<uint64_t> timestamps, const Block &b);
     uint64_t get_adjusted_time() const;
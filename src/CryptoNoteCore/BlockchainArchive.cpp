@@ -0,0 +1,314 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "BlockchainArchive.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <list>
+#include <thread>
+#include <vector>
+
+#include <boost/crc.hpp>
+
+#include "Common/StringTools.h"
+#include "CryptoNoteProtocol/CryptoNoteProtocolDefinitions.h"
+#include "Core.h"
+#include "CryptoNoteFormatUtils.h"
+#include "CryptoNoteTools.h"
+#include "IBlock.h"
+
+using namespace logging;
+
+namespace cn {
+
+namespace {
+
+const char ARCHIVE_MAGIC[8] = {'C', 'C', 'X', 'C', 'H', 'A', 'I', 'N'};
+const uint32_t ARCHIVE_VERSION = 1;
+const uint32_t EXPORT_BATCH_SIZE = 1000;
+const size_t IMPORT_BATCH_SIZE = 1000;
+const uint32_t MAX_RECORD_SIZE = 256 * 1024 * 1024;
+const size_t STREAM_BUFFER_SIZE = 4 * 1024 * 1024;
+
+class ArchiveBlock : public IBlock {
+public:
+  virtual const Block& getBlock() const override { return block; }
+  virtual size_t getTransactionCount() const override { return transactions.size(); }
+  virtual const Transaction& getTransaction(size_t index) const override { return transactions[index]; }
+
+  Block block;
+  std::vector<Transaction> transactions;
+};
+
+struct ArchiveBatch {
+  std::vector<ArchiveBlock> blocks;
+  bool failed = false;
+  bool endReached = false;
+  uint64_t blockCount = 0;
+  std::string error;
+};
+
+template <typename T>
+void writePod(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readPod(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return static_cast<bool>(stream);
+}
+
+uint32_t payloadChecksum(const BinaryArray& payload) {
+  boost::crc_32_type crc;
+  crc.process_bytes(payload.data(), payload.size());
+  return crc.checksum();
+}
+
+bool decodeRecord(const BinaryArray& payload, ArchiveBlock& block) {
+  block_complete_entry entry;
+  if (!fromBinaryArray(entry, payload) || !fromBinaryArray(block.block, common::asBinaryArray(entry.block)) ||
+      entry.txs.size() != block.block.transactionHashes.size()) {
+    return false;
+  }
+
+  block.transactions.resize(entry.txs.size());
+  for (size_t i = 0; i < entry.txs.size(); ++i) {
+    if (!fromBinaryArray(block.transactions[i], common::asBinaryArray(entry.txs[i]))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Reads the next batch of records sequentially, then decodes them on all threads.
+ArchiveBatch loadBatch(std::istream& stream, uint64_t firstHeight, size_t threads) {
+  ArchiveBatch batch;
+  std::vector<BinaryArray> payloads;
+  payloads.reserve(IMPORT_BATCH_SIZE);
+
+  while (payloads.size() < IMPORT_BATCH_SIZE) {
+    uint32_t size = 0;
+    uint32_t checksum = 0;
+    if (!readPod(stream, size) || !readPod(stream, checksum)) {
+      batch.failed = true;
+      batch.error = "unexpected end of archive";
+      return batch;
+    }
+
+    if (size == 0) {
+      if (checksum != 0 || !readPod(stream, batch.blockCount)) {
+        batch.failed = true;
+        batch.error = "corrupted end marker";
+        return batch;
+      }
+
+      batch.endReached = true;
+      break;
+    }
+
+    if (size > MAX_RECORD_SIZE) {
+      batch.failed = true;
+      batch.error = "record of block " + std::to_string(firstHeight + payloads.size()) + " is too large";
+      return batch;
+    }
+
+    BinaryArray payload(size);
+    stream.read(reinterpret_cast<char*>(payload.data()), size);
+    if (!stream || payloadChecksum(payload) != checksum) {
+      batch.failed = true;
+      batch.error = "checksum mismatch in record of block " + std::to_string(firstHeight + payloads.size());
+      return batch;
+    }
+
+    payloads.push_back(std::move(payload));
+  }
+
+  batch.blocks.resize(payloads.size());
+  std::vector<char> decoded(payloads.size(), 0);
+  std::atomic<size_t> next(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < payloads.size(); i = next++) {
+      decoded[i] = decodeRecord(payloads[i], batch.blocks[i]) ? 1 : 0;
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min(threads, payloads.size()); ++i) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : workers) {
+    thread.join();
+  }
+
+  auto failedRecord = std::find(decoded.begin(), decoded.end(), 0);
+  if (failedRecord != decoded.end()) {
+    batch.failed = true;
+    batch.error = "failed to decode block " + std::to_string(firstHeight + (failedRecord - decoded.begin()));
+  }
+
+  return batch;
+}
+
+}
+
+BlockchainArchive::BlockchainArchive(core& core, logging::ILogger& logger) : m_core(core), logger(logger, "BlockchainArchive") {
+}
+
+bool BlockchainArchive::exportTo(const std::string& fileName) {
+  std::vector<char> buffer(STREAM_BUFFER_SIZE);
+  std::ofstream file;
+  file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+  file.open(fileName, std::ios::binary | std::ios::out | std::ios::trunc);
+  if (!file) {
+    logger(ERROR, BRIGHT_RED) << "Failed to open " << fileName << " for writing";
+    return false;
+  }
+
+  file.write(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+  writePod(file, ARCHIVE_VERSION);
+
+  const uint32_t height = m_core.get_current_blockchain_height();
+  const auto start = std::chrono::steady_clock::now();
+  uint64_t exported = 0;
+
+  logger(INFO, BRIGHT_WHITE) << "Exporting " << height << " blocks to " << fileName;
+  for (uint32_t batchStart = 0; batchStart < height; batchStart += EXPORT_BATCH_SIZE) {
+    std::list<Block> blocks;
+    std::list<Transaction> transactions;
+    if (!m_core.get_blocks(batchStart, std::min(EXPORT_BATCH_SIZE, height - batchStart), blocks, transactions)) {
+      logger(ERROR, BRIGHT_RED) << "Failed to read blocks from height " << batchStart;
+      return false;
+    }
+
+    auto transaction = transactions.begin();
+    for (const Block& block : blocks) {
+      block_complete_entry entry;
+      entry.block = common::asString(toBinaryArray(block));
+      for (size_t i = 0; i < block.transactionHashes.size() && transaction != transactions.end(); ++i, ++transaction) {
+        entry.txs.push_back(common::asString(toBinaryArray(*transaction)));
+      }
+
+      const BinaryArray payload = toBinaryArray(entry);
+      writePod(file, static_cast<uint32_t>(payload.size()));
+      writePod(file, payloadChecksum(payload));
+      file.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+      ++exported;
+    }
+
+    if (!file) {
+      logger(ERROR, BRIGHT_RED) << "Failed to write " << fileName;
+      return false;
+    }
+
+    if (exported % 100000 < EXPORT_BATCH_SIZE) {
+      logger(INFO) << "Exported " << exported << " / " << height << " blocks";
+    }
+  }
+
+  writePod(file, static_cast<uint32_t>(0));
+  writePod(file, static_cast<uint32_t>(0));
+  writePod(file, exported);
+  file.flush();
+  if (!file) {
+    logger(ERROR, BRIGHT_RED) << "Failed to write " << fileName;
+    return false;
+  }
+
+  auto seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+  logger(INFO, BRIGHT_GREEN) << "Exported " << exported << " blocks in " << seconds << " s";
+  return true;
+}
+
+bool BlockchainArchive::importFrom(const std::string& fileName, size_t threads) {
+  std::vector<char> buffer(STREAM_BUFFER_SIZE);
+  std::ifstream file;
+  file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+  file.open(fileName, std::ios::binary | std::ios::in);
+  if (!file) {
+    logger(ERROR, BRIGHT_RED) << "Failed to open " << fileName;
+    return false;
+  }
+
+  char magic[sizeof(ARCHIVE_MAGIC)];
+  uint32_t version = 0;
+  file.read(magic, sizeof(magic));
+  if (!file || memcmp(magic, ARCHIVE_MAGIC, sizeof(magic)) != 0 || !readPod(file, version) || version != ARCHIVE_VERSION) {
+    logger(ERROR, BRIGHT_RED) << fileName << " is not a supported blockchain archive";
+    return false;
+  }
+
+  threads = std::max<size_t>(1, threads);
+  const auto start = std::chrono::steady_clock::now();
+  uint64_t height = 0;
+  uint64_t imported = 0;
+
+  logger(INFO, BRIGHT_WHITE) << "Importing blocks from " << fileName << ", local chain height " << m_core.get_current_blockchain_height();
+
+  // Decoding of the next batch overlaps with adding the current one to the chain
+  std::future<ArchiveBatch> nextBatch = std::async(std::launch::async, loadBatch, std::ref(file), height, threads);
+  for (;;) {
+    ArchiveBatch batch = nextBatch.get();
+    if (batch.failed) {
+      logger(ERROR, BRIGHT_RED) << "Failed to read " << fileName << ": " << batch.error;
+      return false;
+    }
+
+    const uint64_t batchStart = height;
+    if (!batch.endReached) {
+      nextBatch = std::async(std::launch::async, loadBatch, std::ref(file), batchStart + batch.blocks.size(), threads);
+    }
+
+    std::vector<const IBlock*> chain;
+    chain.reserve(batch.blocks.size());
+    for (const ArchiveBlock& block : batch.blocks) {
+      if (height < m_core.get_current_blockchain_height()) {
+        if (get_block_hash(block.block) != m_core.getBlockIdByHeight(static_cast<uint32_t>(height))) {
+          logger(ERROR, BRIGHT_RED) << "Archive block at height " << height << " does not match the local chain";
+          return false;
+        }
+      } else {
+        chain.push_back(&block);
+      }
+
+      ++height;
+    }
+
+    if (!chain.empty()) {
+      size_t added = m_core.addChain(chain);
+      imported += added;
+      if (added != chain.size()) {
+        logger(ERROR, BRIGHT_RED) << "Failed to add archive block at height " << height - chain.size() + added;
+        return false;
+      }
+    }
+
+    if (height / 100000 != batchStart / 100000) {
+      logger(INFO) << "Imported up to height " << height;
+    }
+
+    if (batch.endReached) {
+      if (batch.blockCount != height) {
+        logger(ERROR, BRIGHT_RED) << "Archive end marker expects " << batch.blockCount << " blocks, found " << height;
+        return false;
+      }
+
+      break;
+    }
+  }
+
+  auto seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+  logger(INFO, BRIGHT_GREEN) << "Imported " << imported << " blocks in " << seconds << " s, chain height " << m_core.get_current_blockchain_height();
+  return true;
+}
+
+}
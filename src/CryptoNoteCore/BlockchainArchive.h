@@ -0,0 +1,41 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Logging/LoggerRef.h"
+
+namespace cn {
+
+class core;
+
+// Streaming chain archive used to bootstrap nodes without P2P sync.
+//
+// Layout: an 8 byte magic and a format version, then one record per block
+// starting at the genesis block, and an end marker holding the block count.
+// A record is the payload size, the CRC32 of the payload and the payload
+// itself (the block blob and its transaction blobs). The end marker is a
+// record header with zero size and checksum.
+class BlockchainArchive {
+public:
+  BlockchainArchive(core& core, logging::ILogger& logger);
+
+  bool exportTo(const std::string& fileName);
+
+  // Blocks already in the local chain are compared by hash and skipped. New
+  // blocks go through core::addChain, so they are fully validated except for
+  // the PoW and ring signature checks the blockchain already skips inside the
+  // checkpoint zone; all indices are rebuilt as the blocks are pushed.
+  bool importFrom(const std::string& fileName, size_t threads);
+
+private:
+  core& m_core;
+  logging::LoggerRef logger;
+};
+
+}
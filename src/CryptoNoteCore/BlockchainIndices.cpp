@@ -12,9 +12,64 @@
 #include "CryptoNoteCore/CryptoNoteFormatUtils.h"
 #include "BlockchainExplorer/BlockchainExplorerDataBuilder.h"
 #include "CryptoNoteBasicImpl.h"
+#include "Serialization/SerializationOverloads.h"
+
+#include <algorithm>
 
 namespace cn {
 
+namespace {
+
+const size_t PAYMENT_ID_INDEX_MIN_SLOTS = 1024;
+
+bool isFreeSlot(const PaymentIdIndexEntry& entry) {
+  return entry.transactionHash == NULL_HASH;
+}
+
+bool timestampLess(const TimestampIndexEntry& entry, uint64_t timestamp) {
+  return entry.timestamp < timestamp;
+}
+
+bool timestampGreater(uint64_t timestamp, const TimestampIndexEntry& entry) {
+  return timestamp < entry.timestamp;
+}
+
+void addTimestamp(std::vector<TimestampIndexEntry>& index, uint64_t timestamp, const crypto::Hash& hash) {
+  if (index.empty() || index.back().timestamp <= timestamp) {
+    index.push_back({timestamp, hash});
+  } else {
+    auto position = std::upper_bound(index.begin(), index.end(), timestamp, timestampGreater);
+    index.insert(position, {timestamp, hash});
+  }
+}
+
+bool removeTimestamp(std::vector<TimestampIndexEntry>& index, uint64_t timestamp, const crypto::Hash& hash) {
+  auto begin = std::lower_bound(index.begin(), index.end(), timestamp, timestampLess);
+  auto end = std::upper_bound(begin, index.end(), timestamp, timestampGreater);
+
+  // Scan backwards: a rollback always removes the most recently added entry
+  for (auto iter = end; iter != begin;) {
+    --iter;
+    if (iter->hash == hash) {
+      index.erase(iter);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void serializeTimestamps(std::vector<TimestampIndexEntry>& index, ISerializer& s) {
+  serializeAsBinary(index, "index", s);
+
+  if (s.type() == ISerializer::INPUT && !std::is_sorted(index.begin(), index.end(),
+      [](const TimestampIndexEntry& a, const TimestampIndexEntry& b) { return a.timestamp < b.timestamp; })) {
+    throw std::runtime_error("Timestamp index is not sorted");
+  }
+}
+
+}
+
 bool PaymentIdIndex::add(const Transaction& transaction) {
   crypto::Hash paymentId;
   crypto::Hash transactionHash = getObjectHash(transaction);
@@ -22,7 +77,28 @@ bool PaymentIdIndex::add(const Transaction& transaction) {
     return false;
   }
 
-  index.emplace(paymentId, transactionHash);
+  return add(paymentId, transactionHash);
+}
+
+bool PaymentIdIndex::add(const crypto::Hash& paymentId, const crypto::Hash& transactionHash) {
+  if (transactionHash == NULL_HASH) {
+    return false;
+  }
+
+  // keep the load factor at or below 3/4 so probe sequences stay short
+  if ((count + 1) * 4 > slots.size() * 3) {
+    grow();
+  }
+
+  const size_t mask = slots.size() - 1;
+  size_t i = slotIndex(paymentId);
+  while (!isFreeSlot(slots[i])) {
+    i = (i + 1) & mask;
+  }
+
+  slots[i].paymentId = paymentId;
+  slots[i].transactionHash = transactionHash;
+  ++count;
 
   return true;
 }
@@ -34,67 +110,112 @@ bool PaymentIdIndex::remove(const Transaction& transaction) {
     return false;
   }
 
-  auto range = index.equal_range(paymentId);
-  for (auto iter = range.first; iter != range.second; ++iter){
-    if (iter->second == transactionHash) {
-      index.erase(iter);
-      return true;
+  return remove(paymentId, transactionHash);
+}
+
+bool PaymentIdIndex::remove(const crypto::Hash& paymentId, const crypto::Hash& transactionHash) {
+  if (slots.empty()) {
+    return false;
+  }
+
+  const size_t mask = slots.size() - 1;
+  size_t hole = slotIndex(paymentId);
+  while (!isFreeSlot(slots[hole]) && (slots[hole].paymentId != paymentId || slots[hole].transactionHash != transactionHash)) {
+    hole = (hole + 1) & mask;
+  }
+
+  if (isFreeSlot(slots[hole])) {
+    return false;
+  }
+
+  // Backward-shift deletion: pull later entries of the probe run into the hole
+  // unless that would move them in front of their home slot.
+  for (size_t i = (hole + 1) & mask; !isFreeSlot(slots[i]); i = (i + 1) & mask) {
+    size_t home = slotIndex(slots[i].paymentId);
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      slots[hole] = slots[i];
+      hole = i;
     }
   }
 
-  return false;
+  slots[hole] = PaymentIdIndexEntry();
+  --count;
+
+  return true;
 }
 
-bool PaymentIdIndex::find(const crypto::Hash& paymentId, std::vector<crypto::Hash>& transactionHashes) {
+bool PaymentIdIndex::find(const crypto::Hash& paymentId, std::vector<crypto::Hash>& transactionHashes) const {
+  if (slots.empty()) {
+    return false;
+  }
+
   bool found = false;
-  auto range = index.equal_range(paymentId);
-  for (auto iter = range.first; iter != range.second; ++iter){
-    found = true;
-    transactionHashes.emplace_back(iter->second);
+  const size_t mask = slots.size() - 1;
+  for (size_t i = slotIndex(paymentId); !isFreeSlot(slots[i]); i = (i + 1) & mask) {
+    if (slots[i].paymentId == paymentId) {
+      found = true;
+      transactionHashes.emplace_back(slots[i].transactionHash);
+    }
   }
   return found;
 }
 
 void PaymentIdIndex::clear() {
-  index.clear();
+  slots.clear();
+  count = 0;
 }
 
-
 void PaymentIdIndex::serialize(ISerializer& s) {
-  s(index, "index");
+  serializeAsBinary(slots, "slots", s);
+  s(count, "count");
+
+  if (s.type() == ISerializer::INPUT) {
+    // slot count must be a power of two with at least one free slot
+    if ((slots.size() & (slots.size() - 1)) != 0 || (slots.empty() ? count != 0 : count >= slots.size())) {
+      throw std::runtime_error("Invalid payment id index");
+    }
+  }
 }
 
-bool TimestampBlocksIndex::add(uint64_t timestamp, const crypto::Hash& hash) {
-  index.emplace(timestamp, hash);
-  return true;
+size_t PaymentIdIndex::slotIndex(const crypto::Hash& paymentId) const {
+  return std::hash<crypto::Hash>()(paymentId) & (slots.size() - 1);
 }
 
-bool TimestampBlocksIndex::remove(uint64_t timestamp, const crypto::Hash& hash) {
-  auto range = index.equal_range(timestamp);
-  for (auto iter = range.first; iter != range.second; ++iter) {
-    if (iter->second == hash) {
-      index.erase(iter);
-      return true;
+void PaymentIdIndex::grow() {
+  std::vector<PaymentIdIndexEntry> oldSlots(std::max(slots.size() * 2, PAYMENT_ID_INDEX_MIN_SLOTS));
+  oldSlots.swap(slots);
+  count = 0;
+
+  for (const auto& entry : oldSlots) {
+    if (!isFreeSlot(entry)) {
+      add(entry.paymentId, entry.transactionHash);
     }
   }
+}
 
-  return false;
+bool TimestampBlocksIndex::add(uint64_t timestamp, const crypto::Hash& hash) {
+  addTimestamp(index, timestamp, hash);
+  return true;
 }
 
-bool TimestampBlocksIndex::find(uint64_t timestampBegin, uint64_t timestampEnd, uint32_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint32_t& hashesNumberWithinTimestamps) {
+bool TimestampBlocksIndex::remove(uint64_t timestamp, const crypto::Hash& hash) {
+  return removeTimestamp(index, timestamp, hash);
+}
+
+bool TimestampBlocksIndex::find(uint64_t timestampBegin, uint64_t timestampEnd, uint32_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint32_t& hashesNumberWithinTimestamps) const {
   uint32_t hashesNumber = 0;
   if (timestampBegin > timestampEnd) {
     //std::swap(timestampBegin, timestampEnd);
     return false;
   }
-  auto begin = index.lower_bound(timestampBegin);
-  auto end = index.upper_bound(timestampEnd);
+  auto begin = std::lower_bound(index.begin(), index.end(), timestampBegin, timestampLess);
+  auto end = std::upper_bound(begin, index.end(), timestampEnd, timestampGreater);
 
   hashesNumberWithinTimestamps = static_cast<uint32_t>(std::distance(begin, end));
 
   for (auto iter = begin; iter != end && hashesNumber < hashesNumberLimit; ++iter){
     ++hashesNumber;
-    hashes.emplace_back(iter->second);
+    hashes.emplace_back(iter->hash);
   }
   return hashesNumber > 0;
 }
@@ -104,34 +225,26 @@ void TimestampBlocksIndex::clear() {
 }
 
 void TimestampBlocksIndex::serialize(ISerializer& s) {
-  s(index, "index");
+  serializeTimestamps(index, s);
 }
 
 bool TimestampTransactionsIndex::add(uint64_t timestamp, const crypto::Hash& hash) {
-  index.emplace(timestamp, hash);
+  addTimestamp(index, timestamp, hash);
   return true;
 }
 
 bool TimestampTransactionsIndex::remove(uint64_t timestamp, const crypto::Hash& hash) {
-  auto range = index.equal_range(timestamp);
-  for (auto iter = range.first; iter != range.second; ++iter) {
-    if (iter->second == hash) {
-      index.erase(iter);
-      return true;
-    }
-  }
-
-  return false;
+  return removeTimestamp(index, timestamp, hash);
 }
 
-bool TimestampTransactionsIndex::find(uint64_t timestampBegin, uint64_t timestampEnd, uint64_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint64_t& hashesNumberWithinTimestamps) {
+bool TimestampTransactionsIndex::find(uint64_t timestampBegin, uint64_t timestampEnd, uint64_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint64_t& hashesNumberWithinTimestamps) const {
   uint32_t hashesNumber = 0;
   if (timestampBegin > timestampEnd) {
     //std::swap(timestampBegin, timestampEnd);
     return false;
   }
-  auto begin = index.lower_bound(timestampBegin);
-  auto end = index.upper_bound(timestampEnd);
+  auto begin = std::lower_bound(index.begin(), index.end(), timestampBegin, timestampLess);
+  auto end = std::upper_bound(begin, index.end(), timestampEnd, timestampGreater);
   if (timestampEnd == static_cast<uint64_t>(0) && end == begin && begin == index.begin() && index.size() > 0)
 	  ++end; //fix for genesis non-zero timestamp
 
@@ -139,7 +252,7 @@ bool TimestampTransactionsIndex::find(uint64_t timestampBegin, uint64_t timestam
 
   for (auto iter = begin; iter != end && hashesNumber < hashesNumberLimit; ++iter) {
     ++hashesNumber;
-    hashes.emplace_back(iter->second);
+    hashes.emplace_back(iter->hash);
   }
 
   return hashesNumber > 0;
@@ -150,7 +263,7 @@ void TimestampTransactionsIndex::clear() {
 }
 
 void TimestampTransactionsIndex::serialize(ISerializer& s) {
-  s(index, "index");
+  serializeTimestamps(index, s);
 }
 
 GeneratedTransactionsIndex::GeneratedTransactionsIndex() : lastGeneratedTxNumber(0) {
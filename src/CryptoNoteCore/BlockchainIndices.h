@@ -11,6 +11,7 @@
 #include <string>
 #include <unordered_map>
 #include <map>
+#include <vector>
 #include <parallel_hashmap/phmap.h>
 #include "crypto/hash.h"
 #include "CryptoNoteBasic.h"
@@ -19,32 +20,55 @@ namespace cn {
 
 class ISerializer;
 
+struct PaymentIdIndexEntry {
+  crypto::Hash paymentId;
+  crypto::Hash transactionHash;
+};
+
+struct TimestampIndexEntry {
+  uint64_t timestamp;
+  crypto::Hash hash;
+};
+
+// Open-addressing (linear probing) table of (payment id, transaction hash) pairs.
+// Slots with a null transaction hash are free. The slot array is a flat POD vector,
+// so it is stored to and loaded from disk as a single binary blob.
 class PaymentIdIndex {
 public:
   PaymentIdIndex() = default;
 
   bool add(const Transaction& transaction);
+  bool add(const crypto::Hash& paymentId, const crypto::Hash& transactionHash);
   bool remove(const Transaction& transaction);
-  bool find(const crypto::Hash& paymentId, std::vector<crypto::Hash>& transactionHashes);
+  bool remove(const crypto::Hash& paymentId, const crypto::Hash& transactionHash);
+  bool find(const crypto::Hash& paymentId, std::vector<crypto::Hash>& transactionHashes) const;
+  size_t size() const { return count; }
   void clear();
 
   void serialize(ISerializer& s);
 
   template<class Archive> 
   void serialize(Archive& archive, unsigned int version) {
-    archive & index;
+    archive & slots;
+    archive & count;
   }
 private:
-  std::unordered_multimap<crypto::Hash, crypto::Hash> index;
+  size_t slotIndex(const crypto::Hash& paymentId) const;
+  void grow();
+
+  std::vector<PaymentIdIndexEntry> slots;
+  uint64_t count = 0;
 };
 
+// Timestamps arrive almost in order, so the index is a vector sorted by timestamp:
+// in-order additions are appended and a rollback removes from the tail.
 class TimestampBlocksIndex {
 public:
   TimestampBlocksIndex() = default;
 
   bool add(uint64_t timestamp, const crypto::Hash& hash);
   bool remove(uint64_t timestamp, const crypto::Hash& hash);
-  bool find(uint64_t timestampBegin, uint64_t timestampEnd, uint32_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint32_t& hashesNumberWithinTimestamps);
+  bool find(uint64_t timestampBegin, uint64_t timestampEnd, uint32_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint32_t& hashesNumberWithinTimestamps) const;
   void clear();
 
   void serialize(ISerializer& s);
@@ -54,7 +78,7 @@ public:
     archive & index;
   }
 private:
-  std::multimap<uint64_t, crypto::Hash> index;
+  std::vector<TimestampIndexEntry> index;
 };
 
 class TimestampTransactionsIndex {
@@ -63,7 +87,7 @@ public:
 
   bool add(uint64_t timestamp, const crypto::Hash& hash);
   bool remove(uint64_t timestamp, const crypto::Hash& hash);
-  bool find(uint64_t timestampBegin, uint64_t timestampEnd, uint64_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint64_t& hashesNumberWithinTimestamps);
+  bool find(uint64_t timestampBegin, uint64_t timestampEnd, uint64_t hashesNumberLimit, std::vector<crypto::Hash>& hashes, uint64_t& hashesNumberWithinTimestamps) const;
   void clear();
 
   void serialize(ISerializer& s);
@@ -73,7 +97,7 @@ public:
     archive & index;
   }
 private:
-  std::multimap<uint64_t, crypto::Hash> index;
+  std::vector<TimestampIndexEntry> index;
 };
 
 class GeneratedTransactionsIndex {
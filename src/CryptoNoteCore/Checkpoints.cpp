@@ -23,6 +23,7 @@
 #include "../CryptoNoteConfig.h"
 #include "Common/StringTools.h"
 #include "Common/DnsTools.h"
+#include "System/AsyncResolver.h"
 
 using namespace logging;
 
@@ -113,7 +114,7 @@ std::vector<uint32_t> Checkpoints::getCheckpointHeights() const {
   return checkpointHeights;
 }
 
-bool Checkpoints::load_checkpoints_from_dns()
+bool Checkpoints::load_checkpoints_from_dns(std::chrono::milliseconds timeout)
 {
   std::string domain("checkpoints.conceal.id");
   if (m_testnet)
@@ -124,7 +125,13 @@ bool Checkpoints::load_checkpoints_from_dns()
 
   logger(logging::DEBUGGING) << "<< Checkpoints.cpp << " << "Fetching DNS checkpoint records from " << domain;
 
-  if (!common::fetch_dns_txt(domain, records)) {
+  auto lookup = [](const std::string& name) {
+    std::vector<std::string> txtRecords;
+    common::fetch_dns_txt(name, txtRecords);
+    return txtRecords;
+  };
+
+  if (!platform_system::AsyncResolver::resolveWithin("TXT", domain, lookup, std::chrono::seconds(DNS_CHECKPOINTS_CACHE_TTL), timeout, records)) {
     logger(logging::DEBUGGING) << "<< Checkpoints.cpp << " << "Failed to lookup DNS checkpoint records from " << domain;
   }
 
@@ -6,6 +6,7 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #pragma once
+#include <chrono>
 #include <map>
 #include "CryptoNoteBasicImpl.h"
 #include <Logging/LoggerRef.h>
@@ -20,7 +21,9 @@ namespace cn
     bool add_checkpoint(uint32_t height, const std::string& hash_str);
     bool is_in_checkpoint_zone(uint32_t height) const;
     bool load_checkpoints_from_file(const std::string& fileName);
-    bool load_checkpoints_from_dns();
+    // Waits at most timeout for the TXT lookup; records arriving later are
+    // picked up from the DNS cache on the next call.
+    bool load_checkpoints_from_dns(std::chrono::milliseconds timeout);
     bool load_checkpoints();    
     bool check_block(uint32_t height, const crypto::Hash& h) const;
     bool check_block(uint32_t height, const crypto::Hash& h, bool& is_a_checkpoint) const;
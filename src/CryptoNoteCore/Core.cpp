@@ -167,6 +167,8 @@ bool core::init(const CoreConfig& config, const MinerConfig& minerConfig, bool l
     return false;
   }
 
+  m_mempool.revalidate();
+
   r = m_miner->init(minerConfig);
   if (!(r)) {
     logger(ERROR, BRIGHT_RED) << "Failed to initialize blockchain storage";
@@ -236,28 +238,55 @@ bool core::handle_incoming_tx(const BinaryArray& tx_blob, tx_verification_contex
   tvc = boost::value_initialized<tx_verification_context>();
   //want to process all transactions sequentially
 
-  if (tx_blob.size() > m_currency.maxTxSize()) {
-    logger(INFO) << "WRONG TRANSACTION BLOB, too big size " << tx_blob.size() << ", rejected";
-    tvc.m_verification_failed = true;
+  Transaction tx;
+  crypto::Hash tx_hash = NULL_HASH;
+  crypto::Hash tx_prefixt_hash = NULL_HASH;
+  if (!parse_incoming_tx(tx_blob, tx, tx_hash, tx_prefixt_hash, tvc)) {
     return false;
   }
 
-  crypto::Hash tx_hash = NULL_HASH;
-  crypto::Hash tx_prefixt_hash = NULL_HASH;
-  Transaction tx;
+  return handle_preverified_tx(tx, tx_hash, tx_blob.size(), tvc, keeped_by_block);
+}
 
-  if (!parse_tx_from_blob(tx, tx_hash, tx_prefixt_hash, tx_blob)) {
-    logger(INFO) << "WRONG TRANSACTION BLOB, Failed to parse, rejected";
+bool core::preverify_incoming_tx(const BinaryArray& tx_blob, Transaction& tx, crypto::Hash& tx_hash, tx_verification_context& tvc) {
+  tvc = boost::value_initialized<tx_verification_context>();
+
+  crypto::Hash tx_prefix_hash = NULL_HASH;
+  if (!parse_incoming_tx(tx_blob, tx, tx_hash, tx_prefix_hash, tvc)) {
+    return false;
+  }
+
+  if (!m_blockchain.preverifyTransactionSignatures(tx, tx_prefix_hash)) {
+    logger(INFO) << "Transaction " << tx_hash << " has an invalid ring signature, rejected";
     tvc.m_verification_failed = true;
     return false;
   }
-  //std::cout << "!"<< tx.inputs.size() << std::endl;
 
+  return true;
+}
+
+bool core::handle_preverified_tx(const Transaction& tx, const crypto::Hash& tx_hash, size_t blob_size, tx_verification_context& tvc, bool keeped_by_block) {
   crypto::Hash blockId;
   uint32_t blockHeight;
   bool ok = getBlockContainingTx(tx_hash, blockId, blockHeight);
   if (!ok) blockHeight = this->get_current_blockchain_height(); //this assumption fails for withdrawals
-  return handleIncomingTransaction(tx, tx_hash, tx_blob.size(), tvc, keeped_by_block, blockHeight);
+  return handleIncomingTransaction(tx, tx_hash, blob_size, tvc, keeped_by_block, blockHeight);
+}
+
+bool core::parse_incoming_tx(const BinaryArray& tx_blob, Transaction& tx, crypto::Hash& tx_hash, crypto::Hash& tx_prefix_hash, tx_verification_context& tvc) {
+  if (tx_blob.size() > m_currency.maxTxSize()) {
+    logger(INFO) << "WRONG TRANSACTION BLOB, too big size " << tx_blob.size() << ", rejected";
+    tvc.m_verification_failed = true;
+    return false;
+  }
+
+  if (!parse_tx_from_blob(tx, tx_hash, tx_prefix_hash, tx_blob)) {
+    logger(INFO) << "WRONG TRANSACTION BLOB, Failed to parse, rejected";
+    tvc.m_verification_failed = true;
+    return false;
+  }
+
+  return true;
 }
 
 bool core::get_stat_info(core_stat_info& st_inf) {
@@ -492,6 +521,10 @@ bool core::get_random_outs_for_amounts(const COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_
   return m_blockchain.getRandomOutsByAmount(req, res);
 }
 
+bool core::get_random_outs_bulk(const COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::request& req, COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::response& res) {
+  return m_blockchain.getRandomOutsBulk(req, res);
+}
+
 bool core::get_tx_outputs_gindexs(const crypto::Hash& tx_id, std::vector<uint32_t>& indexs) {
   return m_blockchain.getTransactionOutputGlobalIndexes(tx_id, indexs);
 }
@@ -556,12 +589,7 @@ bool core::getPoolChangesLite(const crypto::Hash& tailBlockId, const std::vector
 void core::getPoolChanges(const std::vector<crypto::Hash>& knownTxsIds, std::vector<Transaction>& addedTxs,
                           std::vector<crypto::Hash>& deletedTxsIds) {
 
-  std::vector<crypto::Hash> addedTxsIds;
-  auto guard = m_mempool.obtainGuard();
-  m_mempool.get_difference(knownTxsIds, addedTxsIds, deletedTxsIds);
-  std::vector<crypto::Hash> misses;
-  m_mempool.getTransactions(addedTxsIds, addedTxs, misses);
-  assert(misses.empty());
+  m_mempool.getPoolChanges(knownTxsIds, addedTxs, deletedTxsIds);
 }
 
 bool core::handle_incoming_block_blob(const BinaryArray& block_blob, block_verification_context& bvc, bool control_miner, bool relay_block) {
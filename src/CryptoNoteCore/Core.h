@@ -40,6 +40,8 @@ namespace cn {
 
      bool on_idle() override;
      virtual bool handle_incoming_tx(const BinaryArray& tx_blob, tx_verification_context& tvc, bool keeped_by_block) override; //Deprecated. Should be removed with CryptoNoteProtocolHandler.
+     virtual bool preverify_incoming_tx(const BinaryArray& tx_blob, Transaction& tx, crypto::Hash& tx_hash, tx_verification_context& tvc) override;
+     virtual bool handle_preverified_tx(const Transaction& tx, const crypto::Hash& tx_hash, size_t blob_size, tx_verification_context& tvc, bool keeped_by_block) override;
      bool handle_incoming_block_blob(const BinaryArray& block_blob, block_verification_context& bvc, bool control_miner, bool relay_block) override;
      virtual i_cryptonote_protocol* get_protocol() override {return m_pprotocol;}
      virtual const Currency& currency() const override { return m_currency; }
@@ -131,6 +133,7 @@ namespace cn {
     virtual bool get_tx_outputs_gindexs(const crypto::Hash &tx_id, std::vector<uint32_t> &indexs) override;
     crypto::Hash get_tail_id();
     virtual bool get_random_outs_for_amounts(const COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_request &req, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_response &res) override;
+    virtual bool get_random_outs_bulk(const COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request &req, COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response &res) override;
     void pause_mining() override;
     void update_block_template_and_resume_mining() override;
     //Blockchain& get_blockchain_storage(){return m_blockchain;}
@@ -160,6 +163,7 @@ namespace cn {
     bool add_new_tx(const Transaction &tx, const crypto::Hash &tx_hash, size_t blob_size, tx_verification_context &tvc, bool keeped_by_block, uint32_t height);
     bool load_state_data();
     bool parse_tx_from_blob(Transaction &tx, crypto::Hash &tx_hash, crypto::Hash &tx_prefix_hash, const BinaryArray &blob);
+    bool parse_incoming_tx(const BinaryArray& tx_blob, Transaction& tx, crypto::Hash& tx_hash, crypto::Hash& tx_prefix_hash, tx_verification_context& tvc);
     bool handle_incoming_block(const Block &b, block_verification_context &bvc, bool control_miner, bool relay_block);
 
     bool check_tx_syntax(const Transaction &tx);
@@ -470,10 +470,17 @@ bool lookup_acc_outs(const AccountKeys& acc, const Transaction& tx, const Public
 }
 
 bool get_block_hashing_blob(const Block& b, BinaryArray& ba) {
+  size_t nonceOffset;
+  return get_block_hashing_blob(b, ba, nonceOffset);
+}
+
+bool get_block_hashing_blob(const Block& b, BinaryArray& ba, size_t& nonceOffset) {
   if (!toBinaryArray(static_cast<const BlockHeader&>(b), ba)) {
     return false;
   }
 
+  // the nonce is the last field of the serialized header
+  nonceOffset = ba.size() - sizeof(b.nonce);
   Hash treeRootHash = get_tx_tree_hash(b);
   ba.insert(ba.end(), treeRootHash.data, treeRootHash.data + 32);
   auto transactionCount = asBinaryArray(tools::get_varint_data(b.transactionHashes.size() + 1));
@@ -511,18 +518,37 @@ bool get_block_longhash(cn_context &context, const Block& b, Hash& res) {
     return false;
   }
 
-  if (b.majorVersion >= 8) {
-    cn_gpu_hash_v0(context, bd.data(), bd.size(), res);
-  } else if (b.majorVersion >= 7) {
-    cn_conceal_slow_hash_v0(context, bd.data(), bd.size(), res);
-  } else if (b.majorVersion >= 3) {
-    cn_fast_slow_hash_v1(context, bd.data(), bd.size(), res);
+  get_block_longhash_fn(b.majorVersion)(context, bd.data(), bd.size(), res);
+  return true;
+}
+
+cn_slow_hash_fn get_block_longhash_fn(uint8_t majorVersion) {
+  if (majorVersion >= 8) {
+    return cn_gpu_hash_v0;
+  } else if (majorVersion >= 7) {
+    return cn_conceal_slow_hash_v0;
+  } else if (majorVersion >= 3) {
+    return cn_fast_slow_hash_v1;
   } else {
-    cn_slow_hash_v0(context, bd.data(), bd.size(), res);
+    return cn_slow_hash_v0;
   }
-  
+}
 
-  return true;
+cn_slow_hash_multi_fn get_block_longhash_multi_fn(uint8_t majorVersion) {
+  if (majorVersion >= 8) {
+    return cn_gpu_hash_v0_multi;
+  } else if (majorVersion >= 7) {
+    return cn_conceal_slow_hash_v0_multi;
+  } else if (majorVersion >= 3) {
+    return cn_fast_slow_hash_v1_multi;
+  } else {
+    return cn_slow_hash_v0_multi;
+  }
+}
+
+void get_block_longhashes(cn_context* const* contexts, uint8_t majorVersion, const BinaryArray& blob, size_t nonceOffset,
+                          const uint32_t* nonces, size_t count, Hash* hashes) {
+  cn_slow_hash_nonces(contexts, get_block_longhash_multi_fn(majorVersion), blob.data(), blob.size(), nonceOffset, nonces, count, hashes);
 }
 
 std::vector<uint32_t> relative_output_offsets_to_absolute(const std::vector<uint32_t>& off) {
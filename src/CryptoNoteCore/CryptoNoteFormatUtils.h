@@ -75,10 +75,17 @@ bool generate_key_image_helper(const AccountKeys& ack, const crypto::PublicKey&
 std::string short_hash_str(const crypto::Hash& h);
 
 bool get_block_hashing_blob(const Block& b, BinaryArray& blob);
+// Also reports where the 4-byte nonce sits in the blob, so it can be patched in place
+bool get_block_hashing_blob(const Block& b, BinaryArray& blob, size_t& nonceOffset);
 bool get_aux_block_header_hash(const Block& b, crypto::Hash& res);
 bool get_block_hash(const Block& b, crypto::Hash& res);
 crypto::Hash get_block_hash(const Block& b);
 bool get_block_longhash(crypto::cn_context &context, const Block& b, crypto::Hash& res);
+crypto::cn_slow_hash_fn get_block_longhash_fn(uint8_t majorVersion);
+crypto::cn_slow_hash_multi_fn get_block_longhash_multi_fn(uint8_t majorVersion);
+// Hashes `count` nonces of one hashing blob, nonce i in contexts[i]
+void get_block_longhashes(crypto::cn_context* const* contexts, uint8_t majorVersion, const BinaryArray& blob, size_t nonceOffset,
+                          const uint32_t* nonces, size_t count, crypto::Hash* hashes);
 bool get_inputs_money_amount(const Transaction& tx, uint64_t& money);
 uint64_t get_outs_money_amount(const Transaction& tx);
 bool check_inputs_types_supported(const TransactionPrefix& tx);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <limits>
+#include "Common/CountingOutputStream.h"
 #include "Common/MemoryInputStream.h"
 #include "Common/StringTools.h"
 #include "Common/VectorOutputStream.h"
@@ -60,13 +61,16 @@ bool fromBinaryArray(T& object, const BinaryArray& binaryArray) {
 
 template<class T>
 bool getObjectBinarySize(const T& object, size_t& size) {
-  BinaryArray ba;
-  if (!toBinaryArray(object, ba)) {
+  try {
+    ::common::CountingOutputStream stream;
+    BinaryOutputStreamSerializer serializer(stream);
+    serialize(const_cast<T&>(object), serializer);
+    size = static_cast<size_t>(stream.size());
+  } catch (std::exception&) {
     size = (std::numeric_limits<size_t>::max)();
     return false;
   }
 
-  size = ba.size();
   return true;
 }
 
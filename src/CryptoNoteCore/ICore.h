@@ -24,6 +24,8 @@ namespace cn {
 
 struct COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_request;
 struct COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_response;
+struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request;
+struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response;
 struct NOTIFY_RESPONSE_GET_OBJECTS_request;
 struct NOTIFY_REQUEST_GET_OBJECTS_request;
 
@@ -69,10 +71,14 @@ public:
   virtual std::vector<crypto::Hash> findBlockchainSupplement(const std::vector<crypto::Hash>& remoteBlockIds, size_t maxCount,
     uint32_t& totalBlockCount, uint32_t& startBlockIndex) = 0;
   virtual bool get_random_outs_for_amounts(const COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_request& req, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_response& res) = 0;
+  virtual bool get_random_outs_bulk(const COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request& req, COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response& res) = 0;
   virtual bool get_tx_outputs_gindexs(const crypto::Hash& tx_id, std::vector<uint32_t>& indexs) = 0;
   virtual bool getOutByMSigGIndex(uint64_t amount, uint64_t gindex, MultisignatureOutput& out) = 0;
   virtual i_cryptonote_protocol* get_protocol() = 0;
   virtual bool handle_incoming_tx(const BinaryArray& tx_blob, tx_verification_context& tvc, bool keeped_by_block) = 0; //Deprecated. Should be removed with CryptoNoteProtocolHandler.
+  // Parses a relayed transaction and checks its ring signatures without adding it to the pool, may be called from any thread
+  virtual bool preverify_incoming_tx(const BinaryArray& tx_blob, Transaction& tx, crypto::Hash& tx_hash, tx_verification_context& tvc) = 0;
+  virtual bool handle_preverified_tx(const Transaction& tx, const crypto::Hash& tx_hash, size_t blob_size, tx_verification_context& tvc, bool keeped_by_block) = 0;
   virtual std::vector<Transaction> getPoolTransactions() = 0;
   virtual bool getPoolTransaction(const crypto::Hash &tx_hash, Transaction &transaction) = 0;
   virtual bool getPoolChanges(const crypto::Hash& tailBlockId, const std::vector<crypto::Hash>& knownTxsIds,
@@ -37,6 +37,8 @@ namespace cn {
     virtual bool checkTransactionInputs(const cn::Transaction& tx, BlockInfo& maxUsedBlock, BlockInfo& lastFailed) = 0;
     virtual bool haveSpentKeyImages(const cn::Transaction& tx) = 0;
     virtual bool checkTransactionSize(size_t blobSize) = 0;
+    // Checks the ring signatures only; may be called from several threads at once.
+    virtual bool preverifyTransaction(const cn::Transaction& tx) = 0;
   };
 
 }
@@ -31,6 +31,10 @@ using namespace logging;
 
 namespace cn
 {
+  namespace
+  {
+    const uint32_t MAX_MINING_LANES = 4;
+  }
 
   Miner::Miner(const Currency& currency, IMinerHandler& handler, logging::ILogger& log) :
     m_currency(currency),
@@ -41,6 +45,7 @@ namespace cn
     m_handler(handler),
     m_starter_nonce(0),
     m_threads_total(0),
+    m_lanes(1),
     m_pausers_count(0),
     m_diffic(0),
     m_do_print_hashrate(false),
@@ -142,6 +147,14 @@ namespace cn
   }
 
   bool Miner::init(const MinerConfig& config) {
+    if (config.miningLanes == 0 || config.miningLanes > MAX_MINING_LANES) {
+      logger(ERROR, BRIGHT_RED) << "Mining lanes must be between 1 and " << MAX_MINING_LANES << ", got " << config.miningLanes;
+      return false;
+    }
+
+    // interleaving only pays off when the extra scratchpads still fit the cache share of a core
+    m_lanes = config.miningLanes;
+
     if (!config.extraMessages.empty()) {
       std::string buff;
       if (!common::loadFileToString(config.extraMessages, buff)) {
@@ -265,16 +278,17 @@ namespace cn
       for (unsigned i = 0; i < nthreads; ++i) {
         threads[i] = std::async(std::launch::async, [&, i]() {
           crypto::cn_context localctx;
+          crypto::cn_context* lane = &localctx;
           crypto::Hash h;
+          BinaryArray blob;
+          size_t nonceOffset;
 
-          Block lb(bl); // copy to local block
+          if (!get_block_hashing_blob(bl, blob, nonceOffset)) {
+            return;
+          }
 
           for (uint32_t nonce = startNonce + i; !found; nonce += nthreads) {
-            lb.nonce = nonce;
-
-            if (!get_block_longhash(localctx, lb, h)) {
-              return;
-            }
+            get_block_longhashes(&lane, bl.majorVersion, blob, nonceOffset, &nonce, 1, &h);
 
             if (check_hash(h, diffic)) {
               foundNonce = nonce;
@@ -295,11 +309,16 @@ namespace cn
 
       return found;
     } else {
+      crypto::cn_context* lane = &context;
+      BinaryArray blob;
+      size_t nonceOffset;
+      if (!get_block_hashing_blob(bl, blob, nonceOffset)) {
+        return false;
+      }
+
       for (; bl.nonce != std::numeric_limits<uint32_t>::max(); bl.nonce++) {
         crypto::Hash h;
-        if (!get_block_longhash(context, bl, h)) {
-          return false;
-        }
+        get_block_longhashes(&lane, bl.majorVersion, blob, nonceOffset, &bl.nonce, 1, &h);
 
         if (check_hash(h, diffic)) {
           return true;
@@ -344,8 +363,19 @@ namespace cn
     uint32_t nonce = m_starter_nonce + th_local_index;
     difficulty_type local_diff = 0;
     uint32_t local_template_ver = 0;
-    crypto::cn_context context;
+    // one nonce per lane and call, each lane hashing in its own context
+    const size_t laneCount = m_lanes;
+    std::vector<crypto::cn_context> contexts(laneCount);
+    std::vector<crypto::cn_context*> lanes;
+    for (crypto::cn_context& context : contexts) {
+      lanes.push_back(&context);
+    }
+
     Block b;
+    BinaryArray blob;
+    size_t nonceOffset = 0;
+    std::vector<uint32_t> nonces(laneCount);
+    std::vector<crypto::Hash> hashes(laneCount);
 
     while(!m_stop)
     {
@@ -359,10 +389,16 @@ namespace cn
         std::unique_lock<std::mutex> lk(m_template_lock);
         b = m_template;
         local_diff = m_diffic;
+        local_template_ver = m_template_no;
         lk.unlock();
 
-        local_template_ver = m_template_no;
         nonce = m_starter_nonce + th_local_index;
+        // the blob only changes with the template, each attempt just patches its nonce
+        if (local_template_ver && !get_block_hashing_blob(b, blob, nonceOffset)) {
+          logger(ERROR) << "Failed to get block hashing blob";
+          m_stop = true;
+          break;
+        }
       }
 
       if(!local_template_ver)//no any set_block_template call
@@ -372,20 +408,25 @@ namespace cn
         continue;
       }
 
-      b.nonce = nonce;
-      crypto::Hash h;
-      if (!m_stop && !get_block_longhash(context, b, h)) {
-        logger(ERROR) << "Failed to get block long hash";
-        m_stop = true;
+      for (size_t i = 0; i < laneCount; ++i) {
+        nonces[i] = nonce;
+        nonce += m_threads_total;
       }
 
-      if (!m_stop && check_hash(h, local_diff))
-      {
+      get_block_longhashes(lanes.data(), b.majorVersion, blob, nonceOffset, nonces.data(), laneCount, hashes.data());
+      m_hashes += laneCount;
+
+      for (size_t i = 0; i < laneCount && !m_stop; ++i) {
+        if (!check_hash(hashes[i], local_diff)) {
+          continue;
+        }
+
         //we lucky!
         ++m_config.current_extra_message_index;
 
         logger(INFO, GREEN) << "Found block for difficulty: " << local_diff;
 
+        b.nonce = nonces[i];
         if(!m_handler.handle_block_found(b)) {
           --m_config.current_extra_message_index;
         } else {
@@ -393,9 +434,6 @@ namespace cn
           common::saveStringToFile(m_config_folder_path + "/" + cn::parameters::MINER_CONFIG_FILE_NAME, storeToJson(m_config));
         }
       }
-
-      nonce += m_threads_total;
-      ++m_hashes;
     }
     logger(INFO) << "Miner thread stopped ["<< th_local_index << "]";
     return true;
@@ -69,6 +69,7 @@ namespace cn {
     difficulty_type m_diffic;
 
     std::atomic<uint32_t> m_threads_total;
+    uint32_t m_lanes;
     std::atomic<int32_t> m_pausers_count;
     std::mutex m_miners_count_lock;
 
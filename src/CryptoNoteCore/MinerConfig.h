@@ -24,6 +24,7 @@ public:
   std::string extraMessages;
   std::string startMining;
   uint32_t miningThreads;
+  uint32_t miningLanes;
 };
 
 } //namespace cn
@@ -0,0 +1,181 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "PoolJournal.h"
+
+#include <cstring>
+
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+
+namespace cn {
+
+namespace {
+
+const char JOURNAL_MAGIC[8] = {'C', 'C', 'X', 'P', 'O', 'O', 'L', 'J'};
+const uint32_t JOURNAL_VERSION = 1;
+const uint32_t MAX_RECORD_SIZE = 64 * 1024 * 1024;
+
+template <typename T>
+void writePod(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readPod(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return static_cast<bool>(stream);
+}
+
+uint32_t payloadChecksum(const BinaryArray& payload) {
+  boost::crc_32_type crc;
+  crc.process_bytes(payload.data(), payload.size());
+  return crc.checksum();
+}
+
+void writeHeader(std::ostream& stream) {
+  stream.write(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+  writePod(stream, JOURNAL_VERSION);
+}
+
+void writeRecord(std::ostream& stream, PoolJournal::RecordType type, const BinaryArray& payload) {
+  writePod(stream, static_cast<uint8_t>(type));
+  writePod(stream, static_cast<uint32_t>(payload.size()));
+  writePod(stream, payloadChecksum(payload));
+  stream.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+}
+
+// Returns the offset just past the last intact record, or 0 if the header is invalid.
+uint64_t replayRecords(std::istream& stream, const PoolJournal::RecordHandler& handler, size_t& recordCount) {
+  char magic[sizeof(JOURNAL_MAGIC)];
+  uint32_t version = 0;
+  stream.read(magic, sizeof(magic));
+  if (!stream || memcmp(magic, JOURNAL_MAGIC, sizeof(magic)) != 0 || !readPod(stream, version) || version != JOURNAL_VERSION) {
+    return 0;
+  }
+
+  uint64_t goodOffset = static_cast<uint64_t>(stream.tellg());
+  for (;;) {
+    uint8_t type = 0;
+    uint32_t size = 0;
+    uint32_t checksum = 0;
+    if (!readPod(stream, type) || !readPod(stream, size) || !readPod(stream, checksum) || size > MAX_RECORD_SIZE ||
+        (type != PoolJournal::ADD && type != PoolJournal::REMOVE)) {
+      break;
+    }
+
+    BinaryArray payload(size);
+    stream.read(reinterpret_cast<char*>(payload.data()), size);
+    if (!stream || payloadChecksum(payload) != checksum) {
+      break;
+    }
+
+    handler(static_cast<PoolJournal::RecordType>(type), payload);
+    ++recordCount;
+    goodOffset = static_cast<uint64_t>(stream.tellg());
+  }
+
+  return goodOffset;
+}
+
+}
+
+bool PoolJournal::open(const std::string& fileName, const RecordHandler& handler) {
+  close();
+  m_fileName = fileName;
+  m_recordCount = 0;
+
+  boost::system::error_code ec;
+  if (boost::filesystem::exists(fileName, ec)) {
+    uint64_t goodOffset = 0;
+    {
+      std::ifstream input(fileName, std::ios::binary);
+      if (!input) {
+        return false;
+      }
+
+      goodOffset = replayRecords(input, handler, m_recordCount);
+    }
+
+    if (goodOffset == 0) {
+      return false;
+    }
+
+    if (boost::filesystem::file_size(fileName, ec) != goodOffset) {
+      boost::filesystem::resize_file(fileName, goodOffset, ec);
+      if (ec) {
+        return false;
+      }
+    }
+
+    m_stream.open(fileName, std::ios::binary | std::ios::app);
+  } else {
+    m_stream.open(fileName, std::ios::binary | std::ios::trunc);
+    writeHeader(m_stream);
+    m_stream.flush();
+  }
+
+  return static_cast<bool>(m_stream);
+}
+
+void PoolJournal::close() {
+  if (m_stream.is_open()) {
+    m_stream.close();
+  }
+
+  m_stream.clear();
+}
+
+bool PoolJournal::isOpen() const {
+  return m_stream.is_open();
+}
+
+bool PoolJournal::append(RecordType type, const BinaryArray& payload) {
+  if (!m_stream.is_open()) {
+    return false;
+  }
+
+  writeRecord(m_stream, type, payload);
+  m_stream.flush();
+  ++m_recordCount;
+  return static_cast<bool>(m_stream);
+}
+
+bool PoolJournal::compact(const std::vector<Record>& records) {
+  if (m_fileName.empty()) {
+    return false;
+  }
+
+  std::string tempFileName = m_fileName + ".tmp";
+  {
+    std::ofstream output(tempFileName, std::ios::binary | std::ios::trunc);
+    writeHeader(output);
+    for (const auto& record : records) {
+      writeRecord(output, record.type, record.payload);
+    }
+
+    output.flush();
+    if (!output) {
+      return false;
+    }
+  }
+
+  close();
+  boost::system::error_code ec;
+  boost::filesystem::rename(tempFileName, m_fileName, ec);
+  m_stream.open(m_fileName, std::ios::binary | std::ios::app);
+  if (ec) {
+    return false;
+  }
+
+  m_recordCount = records.size();
+  return static_cast<bool>(m_stream);
+}
+
+size_t PoolJournal::recordCount() const {
+  return m_recordCount;
+}
+
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <CryptoNote.h>
+
+namespace cn {
+
+// Append-only log of memory pool changes, replayed on startup instead of
+// loading a whole-pool dump written at shutdown.
+//
+// Layout: an 8 byte magic and a format version, then one record per change.
+// A record is the record type, the payload size, the CRC32 of the payload and
+// the payload itself. A record torn by a crash ends the replay and is cut off
+// before new records are appended.
+class PoolJournal {
+public:
+  enum RecordType : uint8_t {
+    ADD = 1,
+    REMOVE = 2
+  };
+
+  struct Record {
+    RecordType type;
+    BinaryArray payload;
+  };
+
+  typedef std::function<void(RecordType, const BinaryArray&)> RecordHandler;
+
+  // Replays an existing journal through handler and opens it for appending;
+  // a missing journal is created. Fails if the file is not a journal.
+  bool open(const std::string& fileName, const RecordHandler& handler);
+  void close();
+  bool isOpen() const;
+
+  bool append(RecordType type, const BinaryArray& payload);
+  // Replaces the journal with the given records, written to a temporary file first.
+  bool compact(const std::vector<Record>& records);
+
+  // Records in the journal file, replayed and appended.
+  size_t recordCount() const;
+
+private:
+  std::string m_fileName;
+  std::ofstream m_stream;
+  size_t m_recordCount = 0;
+};
+
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "SignatureCache.h"
+
+#include <cstring>
+
+namespace cn
+{
+
+  SignatureCache::SignatureCache(size_t maxSize) : m_maxSize(maxSize)
+  {
+  }
+
+  crypto::Hash SignatureCache::makeKey(const crypto::Hash &prefixHash, const crypto::KeyImage &keyImage,
+                                       const std::vector<const crypto::PublicKey *> &outputKeys, const std::vector<crypto::Signature> &signatures)
+  {
+    std::vector<uint8_t> data(sizeof(prefixHash) + sizeof(keyImage) + outputKeys.size() * sizeof(crypto::PublicKey) + signatures.size() * sizeof(crypto::Signature));
+    uint8_t *p = data.data();
+    memcpy(p, &prefixHash, sizeof(prefixHash));
+    p += sizeof(prefixHash);
+    memcpy(p, &keyImage, sizeof(keyImage));
+    p += sizeof(keyImage);
+    for (const crypto::PublicKey *key : outputKeys)
+    {
+      memcpy(p, key, sizeof(crypto::PublicKey));
+      p += sizeof(crypto::PublicKey);
+    }
+
+    if (!signatures.empty())
+    {
+      memcpy(p, signatures.data(), signatures.size() * sizeof(crypto::Signature));
+    }
+
+    return crypto::cn_fast_hash(data.data(), data.size());
+  }
+
+  bool SignatureCache::contains(const crypto::Hash &key) const
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    return m_entries.count(key) != 0;
+  }
+
+  void SignatureCache::add(const crypto::Hash &key)
+  {
+    if (m_maxSize == 0)
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (!m_entries.insert(key).second)
+    {
+      return;
+    }
+
+    m_order.push_back(key);
+    if (m_order.size() > m_maxSize)
+    {
+      m_entries.erase(m_order.front());
+      m_order.pop_front();
+    }
+  }
+
+  void SignatureCache::clear()
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_entries.clear();
+    m_order.clear();
+  }
+
+  size_t SignatureCache::size() const
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    return m_entries.size();
+  }
+
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "crypto/crypto.h"
+#include "crypto/hash.h"
+
+namespace cn
+{
+
+  /*
+    Remembers key inputs whose ring signature and key image were already
+    verified, so a transaction checked on pool admission isn't verified again
+    when it arrives in a block. An entry is keyed by everything the check
+    depends on, including the output keys the ring members resolved to, so a
+    reorg that changes the resolution simply misses. Oldest entries are
+    evicted first once maxSize is reached.
+  */
+  class SignatureCache
+  {
+  public:
+    explicit SignatureCache(size_t maxSize);
+
+    static crypto::Hash makeKey(const crypto::Hash &prefixHash, const crypto::KeyImage &keyImage,
+                                const std::vector<const crypto::PublicKey *> &outputKeys, const std::vector<crypto::Signature> &signatures);
+
+    bool contains(const crypto::Hash &key) const;
+    void add(const crypto::Hash &key);
+    void clear();
+    size_t size() const;
+
+  private:
+    const size_t m_maxSize;
+    mutable std::mutex m_mutex;
+    std::unordered_set<crypto::Hash> m_entries;
+    std::deque<crypto::Hash> m_order;
+  };
+
+}
@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 #include <cstdio>
+#include "Common/Metrics.h"
 #include "Common/StdInputStream.h"
 #include "Common/StdOutputStream.h"
 #include "Serialization/BinaryInputStreamSerializer.h"
@@ -269,6 +270,11 @@ template<class T> typename SwappedVector<T>::const_iterator SwappedVector<T>::en
 }
 
 template<class T> const T& SwappedVector<T>::operator[](uint64_t index) {
+  static common::MetricCounter& cacheHits = common::MetricsRegistry::instance().counter(
+    "conceal_swapped_vector_cache_hits_total", "SwappedVector reads served from the item cache");
+  static common::MetricCounter& cacheMisses = common::MetricsRegistry::instance().counter(
+    "conceal_swapped_vector_cache_misses_total", "SwappedVector reads loaded from disk");
+
   auto itemIter = m_items.find(index);
   if (itemIter != m_items.end()) {
     if (itemIter->second.cacheIter != --m_cache.end()) {
@@ -276,6 +282,7 @@ template<class T> const T& SwappedVector<T>::operator[](uint64_t index) {
     }
 
     ++m_cacheHits;
+    cacheHits.increment();
     return itemIter->second.item;
   }
 
@@ -297,6 +304,7 @@ template<class T> const T& SwappedVector<T>::operator[](uint64_t index) {
   T* item = prepare(index);
   std::swap(tempItem, *item);
   ++m_cacheMisses;
+  cacheMisses.increment();
   return *item;
 }
 
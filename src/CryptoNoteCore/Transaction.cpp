@@ -54,6 +54,7 @@ namespace cn {
     virtual bool getPaymentId(Hash& hash) const override;
     virtual bool getExtraNonce(BinaryArray& nonce) const override;
     virtual BinaryArray getExtra() const override;
+    virtual std::vector<std::string> getMessages(const crypto::SecretKey* recipientSecretKey) const override;
 
     // inputs
     virtual size_t getInputCount() const override;
@@ -468,6 +469,10 @@ namespace cn {
     return transaction.extra;
   }
 
+  std::vector<std::string> TransactionImpl::getMessages(const crypto::SecretKey* recipientSecretKey) const {
+    return get_messages_from_extra(transaction.extra, getTransactionPublicKey(), recipientSecretKey);
+  }
+
   size_t TransactionImpl::getInputCount() const {
     return transaction.inputs.size();
   }
@@ -77,4 +77,56 @@ namespace cn {
     std::vector<cn::TransactionExtraField> fields;
   };
 
+  // First public key and nonce of a serialized extra, found with a single
+  // TransactionExtraReader pass. Like TransactionExtra::parse, fields before
+  // a malformed one are still used.
+  class TransactionExtraCache {
+  public:
+    TransactionExtraCache() : m_hasPublicKey(false), m_hasNonce(false) {}
+
+    void load(const std::vector<uint8_t>& extra) {
+      m_hasPublicKey = false;
+      m_hasNonce = false;
+      m_nonce.clear();
+
+      cn::TransactionExtraReader reader(extra);
+      cn::TransactionExtraFieldView field;
+      while (reader.next(field) && !(m_hasPublicKey && m_hasNonce)) {
+        if (field.tag == TX_EXTRA_TAG_PUBKEY && !m_hasPublicKey) {
+          memcpy(&m_publicKey, field.data, sizeof(m_publicKey));
+          m_hasPublicKey = true;
+        } else if (field.tag == TX_EXTRA_NONCE && !m_hasNonce) {
+          m_nonce.assign(field.data, field.data + field.size);
+          m_hasNonce = true;
+        }
+      }
+    }
+
+    bool getPublicKey(crypto::PublicKey& pk) const {
+      if (!m_hasPublicKey) {
+        return false;
+      }
+      pk = m_publicKey;
+      return true;
+    }
+
+    bool getExtraNonce(std::vector<uint8_t>& nonce) const {
+      if (!m_hasNonce) {
+        return false;
+      }
+      nonce = m_nonce;
+      return true;
+    }
+
+    bool getPaymentId(crypto::Hash& paymentId) const {
+      return m_hasNonce && cn::getPaymentIdFromTransactionExtraNonce(m_nonce, paymentId);
+    }
+
+  private:
+    bool m_hasPublicKey;
+    bool m_hasNonce;
+    crypto::PublicKey m_publicKey;
+    std::vector<uint8_t> m_nonce;
+  };
+
 }
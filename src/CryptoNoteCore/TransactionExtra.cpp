@@ -22,103 +22,237 @@ using namespace common;
 namespace cn
 {
 
-  bool parseTransactionExtra(const std::vector<uint8_t> &transactionExtra, std::vector<TransactionExtraField> &transactionExtraFields)
+  namespace
   {
-    transactionExtraFields.clear();
+    const uint64_t MAX_EXTRA_STRING_SIZE = 128 * 1024 * 1024;
 
-    if (transactionExtra.empty())
+    bool getPaymentIdFromNonce(const uint8_t *nonce, size_t size, Hash &payment_id)
+    {
+      if (sizeof(Hash) + 1 != size)
+        return false;
+      if (TX_EXTRA_NONCE_PAYMENT_ID != nonce[0])
+        return false;
+      memcpy(&payment_id, nonce + 1, sizeof(Hash));
       return true;
+    }
+  }
+
+  TransactionExtraReader::TransactionExtraReader(const std::vector<uint8_t> &extra)
+      : TransactionExtraReader(extra.data(), extra.size()) {}
+
+  TransactionExtraReader::TransactionExtraReader(const uint8_t *data, size_t size)
+      : m_data(data), m_size(size), m_offset(0), m_failed(false) {}
 
-    try
+  bool TransactionExtraReader::next(TransactionExtraFieldView &field)
+  {
+    while (!m_failed && m_offset < m_size)
     {
-      MemoryInputStream iss(transactionExtra.data(), transactionExtra.size());
-      BinaryInputStreamSerializer ar(iss);
+      uint8_t tag = m_data[m_offset++];
+      bool known = false;
+      try
+      {
+        known = readField(tag, field);
+      }
+      catch (std::exception &)
+      {
+        m_failed = true;
+      }
 
-      int c = 0;
+      if (m_failed)
+      {
+        m_offset = m_size;
+        return false;
+      }
 
-      while (!iss.endOfStream())
+      // unknown tags are skipped byte by byte
+      if (known)
       {
-        c = read<uint8_t>(iss);
-        switch (c)
-        {
-        case TX_EXTRA_TAG_PADDING:
-        {
-          size_t size = 1;
-          for (; !iss.endOfStream() && size <= TX_EXTRA_PADDING_MAX_COUNT; ++size)
-          {
-            if (read<uint8_t>(iss) != 0)
-            {
-              return false; // all bytes should be zero
-            }
-          }
-
-          if (size > TX_EXTRA_PADDING_MAX_COUNT)
-          {
-            return false;
-          }
-
-          transactionExtraFields.push_back(TransactionExtraPadding{size});
-          break;
-        }
+        return true;
+      }
+    }
 
-        case TX_EXTRA_TAG_PUBKEY:
-        {
-          TransactionExtraPublicKey extraPk;
-          ar(extraPk.publicKey, "public_key");
-          transactionExtraFields.push_back(extraPk);
-          break;
-        }
+    return false;
+  }
 
-        case TX_EXTRA_NONCE:
-        {
-          TransactionExtraNonce extraNonce;
-          uint8_t size = read<uint8_t>(iss);
-          if (size > 0)
-          {
-            extraNonce.nonce.resize(size);
-            read(iss, extraNonce.nonce.data(), extraNonce.nonce.size());
-          }
-
-          transactionExtraFields.push_back(extraNonce);
-          break;
-        }
+  bool TransactionExtraReader::readField(uint8_t tag, TransactionExtraFieldView &field)
+  {
+    field.tag = tag;
+    field.data = nullptr;
+    field.size = 0;
+    field.value = 0;
 
-        case TX_EXTRA_MERGE_MINING_TAG:
+    switch (tag)
+    {
+    case TX_EXTRA_TAG_PADDING:
+    {
+      size_t size = 1;
+      for (; m_offset < m_size && size <= TX_EXTRA_PADDING_MAX_COUNT; ++size)
+      {
+        if (m_data[m_offset++] != 0)
         {
-          TransactionExtraMergeMiningTag mmTag;
-          ar(mmTag, "mm_tag");
-          transactionExtraFields.push_back(mmTag);
-          break;
+          m_failed = true; // all bytes should be zero
+          return true;
         }
+      }
 
-        case TX_EXTRA_MESSAGE_TAG:
-        {
-          tx_extra_message message;
-          ar(message.data, "message");
-          transactionExtraFields.push_back(message);
-          break;
-        }
+      if (size > TX_EXTRA_PADDING_MAX_COUNT)
+      {
+        m_failed = true;
+        return true;
+      }
 
-        case TX_EXTRA_TTL:
-        {
-          uint8_t size;
-          readVarint(iss, size);
-          TransactionExtraTTL ttl;
-          readVarint(iss, ttl.ttl);
-          transactionExtraFields.push_back(ttl);
-          break;
-        }
-        }
+      field.size = size;
+      return true;
+    }
+
+    case TX_EXTRA_TAG_PUBKEY:
+      field.size = sizeof(PublicKey);
+      readBytes(field.size, field.data);
+      return true;
+
+    case TX_EXTRA_NONCE:
+    {
+      const uint8_t *size;
+      if (readBytes(1, size))
+      {
+        field.size = *size;
+        readBytes(field.size, field.data);
+      }
+      return true;
+    }
+
+    case TX_EXTRA_MERGE_MINING_TAG:
+    {
+      uint64_t size;
+      readVarint(size);
+      const uint8_t *tag;
+      if (size > MAX_EXTRA_STRING_SIZE || !readBytes(static_cast<size_t>(size), tag))
+      {
+        m_failed = true;
+        return true;
       }
+
+      MemoryInputStream stream(tag, static_cast<size_t>(size));
+      common::readVarint(stream, field.value);
+      if (size - stream.getPosition() < sizeof(Hash))
+      {
+        m_failed = true;
+        return true;
+      }
+
+      field.data = tag + stream.getPosition();
+      field.size = sizeof(Hash);
+      return true;
     }
-    catch (std::exception &)
+
+    case TX_EXTRA_MESSAGE_TAG:
     {
+      uint64_t size;
+      readVarint(size);
+      if (size > MAX_EXTRA_STRING_SIZE)
+      {
+        m_failed = true;
+        return true;
+      }
+
+      field.size = static_cast<size_t>(size);
+      readBytes(field.size, field.data);
+      return true;
+    }
+
+    case TX_EXTRA_TTL:
+    {
+      uint8_t size;
+      readVarint(size);
+      readVarint(field.value);
+      return true;
+    }
+    }
+
+    return false;
+  }
+
+  bool TransactionExtraReader::readBytes(size_t size, const uint8_t *&bytes)
+  {
+    if (m_size - m_offset < size)
+    {
+      m_failed = true;
       return false;
     }
 
+    bytes = m_data + m_offset;
+    m_offset += size;
     return true;
   }
 
+  template <typename T>
+  void TransactionExtraReader::readVarint(T &value)
+  {
+    MemoryInputStream stream(m_data + m_offset, m_size - m_offset);
+    common::readVarint(stream, value);
+    m_offset += stream.getPosition();
+  }
+
+  bool parseTransactionExtra(const std::vector<uint8_t> &transactionExtra, std::vector<TransactionExtraField> &transactionExtraFields)
+  {
+    transactionExtraFields.clear();
+
+    TransactionExtraReader reader(transactionExtra);
+    TransactionExtraFieldView field;
+    while (reader.next(field))
+    {
+      switch (field.tag)
+      {
+      case TX_EXTRA_TAG_PADDING:
+        transactionExtraFields.push_back(TransactionExtraPadding{field.size});
+        break;
+
+      case TX_EXTRA_TAG_PUBKEY:
+      {
+        TransactionExtraPublicKey extraPk;
+        memcpy(&extraPk.publicKey, field.data, sizeof(extraPk.publicKey));
+        transactionExtraFields.push_back(extraPk);
+        break;
+      }
+
+      case TX_EXTRA_NONCE:
+      {
+        TransactionExtraNonce extraNonce;
+        extraNonce.nonce.assign(field.data, field.data + field.size);
+        transactionExtraFields.push_back(extraNonce);
+        break;
+      }
+
+      case TX_EXTRA_MERGE_MINING_TAG:
+      {
+        TransactionExtraMergeMiningTag mmTag;
+        mmTag.depth = static_cast<size_t>(field.value);
+        memcpy(&mmTag.merkleRoot, field.data, sizeof(mmTag.merkleRoot));
+        transactionExtraFields.push_back(mmTag);
+        break;
+      }
+
+      case TX_EXTRA_MESSAGE_TAG:
+      {
+        tx_extra_message message;
+        message.data.assign(reinterpret_cast<const char *>(field.data), field.size);
+        transactionExtraFields.push_back(message);
+        break;
+      }
+
+      case TX_EXTRA_TTL:
+      {
+        TransactionExtraTTL ttl;
+        ttl.ttl = field.value;
+        transactionExtraFields.push_back(ttl);
+        break;
+      }
+      }
+    }
+
+    return !reader.failed();
+  }
+
   struct ExtraSerializerVisitor : public boost::static_visitor<bool>
   {
     std::vector<uint8_t> &extra;
@@ -180,14 +314,19 @@ namespace cn
 
   PublicKey getTransactionPublicKeyFromExtra(const std::vector<uint8_t> &tx_extra)
   {
-    std::vector<TransactionExtraField> tx_extra_fields;
-    parseTransactionExtra(tx_extra, tx_extra_fields);
-
-    TransactionExtraPublicKey pub_key_field;
-    if (!findTransactionExtraFieldByType(tx_extra_fields, pub_key_field))
-      return boost::value_initialized<PublicKey>();
+    TransactionExtraReader reader(tx_extra);
+    TransactionExtraFieldView field;
+    while (reader.next(field))
+    {
+      if (field.tag == TX_EXTRA_TAG_PUBKEY)
+      {
+        PublicKey publicKey;
+        memcpy(&publicKey, field.data, sizeof(publicKey));
+        return publicKey;
+      }
+    }
 
-    return pub_key_field.publicKey;
+    return boost::value_initialized<PublicKey>();
   }
 
   bool addTransactionPublicKeyToExtra(std::vector<uint8_t> &tx_extra, const PublicKey &tx_pub_key)
@@ -233,10 +372,19 @@ namespace cn
 
   bool getMergeMiningTagFromExtra(const std::vector<uint8_t> &tx_extra, TransactionExtraMergeMiningTag &mm_tag)
   {
-    std::vector<TransactionExtraField> tx_extra_fields;
-    parseTransactionExtra(tx_extra, tx_extra_fields);
+    TransactionExtraReader reader(tx_extra);
+    TransactionExtraFieldView field;
+    while (reader.next(field))
+    {
+      if (field.tag == TX_EXTRA_MERGE_MINING_TAG)
+      {
+        mm_tag.depth = static_cast<size_t>(field.value);
+        memcpy(&mm_tag.merkleRoot, field.data, sizeof(mm_tag.merkleRoot));
+        return true;
+      }
+    }
 
-    return findTransactionExtraFieldByType(tx_extra_fields, mm_tag);
+    return false;
   }
 
   bool append_message_to_extra(std::vector<uint8_t> &tx_extra, const tx_extra_message &message)
@@ -256,21 +404,32 @@ namespace cn
 
   std::vector<std::string> get_messages_from_extra(const std::vector<uint8_t> &extra, const crypto::PublicKey &txkey, const crypto::SecretKey *recepient_secret_key)
   {
-    std::vector<TransactionExtraField> tx_extra_fields;
     std::vector<std::string> result;
-    if (!parseTransactionExtra(extra, tx_extra_fields))
+    TransactionExtraFieldView field;
+
+    // messages are only read from an extra that parses as a whole
+    TransactionExtraReader validator(extra);
+    while (validator.next(field))
+    {
+    }
+
+    if (validator.failed())
     {
       return result;
     }
+
+    TransactionExtraReader reader(extra);
     size_t i = 0;
-    for (const auto &f : tx_extra_fields)
+    while (reader.next(field))
     {
-      if (f.type() != typeid(tx_extra_message))
+      if (field.tag != TX_EXTRA_MESSAGE_TAG)
       {
         continue;
       }
+      tx_extra_message message;
+      message.data.assign(reinterpret_cast<const char *>(field.data), field.size);
       std::string res;
-      if (boost::get<tx_extra_message>(f).decrypt(i, txkey, recepient_secret_key, res))
+      if (message.decrypt(i, txkey, recepient_secret_key, res))
       {
         result.push_back(res);
       }
@@ -290,6 +449,22 @@ namespace cn
     std::copy(ttlData.begin(), ttlData.end(), std::back_inserter(tx_extra));
   }
 
+  bool getTTLFromExtra(const std::vector<uint8_t> &tx_extra, uint64_t &ttl)
+  {
+    TransactionExtraReader reader(tx_extra);
+    TransactionExtraFieldView field;
+    while (reader.next(field))
+    {
+      if (field.tag == TX_EXTRA_TTL)
+      {
+        ttl = field.value;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
   void setPaymentIdToTransactionExtraNonce(std::vector<uint8_t> &extra_nonce, const Hash &payment_id)
   {
     extra_nonce.clear();
@@ -300,12 +475,7 @@ namespace cn
 
   bool getPaymentIdFromTransactionExtraNonce(const std::vector<uint8_t> &extra_nonce, Hash &payment_id)
   {
-    if (sizeof(Hash) + 1 != extra_nonce.size())
-      return false;
-    if (TX_EXTRA_NONCE_PAYMENT_ID != extra_nonce[0])
-      return false;
-    payment_id = *reinterpret_cast<const Hash *>(extra_nonce.data() + 1);
-    return true;
+    return getPaymentIdFromNonce(extra_nonce.data(), extra_nonce.size(), payment_id);
   }
 
   bool parsePaymentId(const std::string &paymentIdString, Hash &paymentId)
@@ -335,26 +505,23 @@ namespace cn
 
   bool getPaymentIdFromTxExtra(const std::vector<uint8_t> &extra, Hash &paymentId)
   {
-    std::vector<TransactionExtraField> tx_extra_fields;
-    if (!parseTransactionExtra(extra, tx_extra_fields))
+    TransactionExtraReader reader(extra);
+    TransactionExtraFieldView field;
+    TransactionExtraFieldView nonce = {};
+    while (reader.next(field))
     {
-      return false;
-    }
-
-    TransactionExtraNonce extra_nonce;
-    if (findTransactionExtraFieldByType(tx_extra_fields, extra_nonce))
-    {
-      if (!getPaymentIdFromTransactionExtraNonce(extra_nonce.nonce, paymentId))
+      if (field.tag == TX_EXTRA_NONCE && nonce.data == nullptr)
       {
-        return false;
+        nonce = field;
       }
     }
-    else
+
+    if (reader.failed() || nonce.data == nullptr)
     {
       return false;
     }
 
-    return true;
+    return getPaymentIdFromNonce(nonce.data, nonce.size, paymentId);
   }
 
   bool addPaymentIdToExtra(const std::string &paymentId, std::string &extra) {
@@ -67,7 +67,41 @@ struct TransactionExtraTTL {
 //   varint data[];
 typedef boost::variant<TransactionExtraPadding, TransactionExtraPublicKey, TransactionExtraNonce, TransactionExtraMergeMiningTag, tx_extra_message, TransactionExtraTTL> TransactionExtraField;
 
+// A field of a transaction extra read in place. Depending on the tag:
+//   padding          size is the padding length
+//   public key       data points to the key
+//   nonce, message   data/size is the payload
+//   merge mining tag data points to the merkle root, value is the depth
+//   TTL              value is the TTL
+// data points into the extra and is valid while the extra is.
+struct TransactionExtraFieldView {
+  uint8_t tag;
+  const uint8_t* data;
+  size_t size;
+  uint64_t value;
+};
 
+// Walks the fields of a transaction extra without copying or allocating,
+// accepting exactly what parseTransactionExtra accepts.
+class TransactionExtraReader {
+public:
+  explicit TransactionExtraReader(const std::vector<uint8_t>& extra);
+  TransactionExtraReader(const uint8_t* data, size_t size);
+
+  // Returns false at the end of the extra or at a malformed field, see failed()
+  bool next(TransactionExtraFieldView& field);
+  bool failed() const { return m_failed; }
+
+private:
+  bool readField(uint8_t tag, TransactionExtraFieldView& field);
+  bool readBytes(size_t size, const uint8_t*& bytes);
+  template<typename T> void readVarint(T& value);
+
+  const uint8_t* m_data;
+  size_t m_size;
+  size_t m_offset;
+  bool m_failed;
+};
 
 template<typename T>
 bool findTransactionExtraFieldByType(const std::vector<TransactionExtraField>& tx_extra_fields, T& field) {
@@ -93,6 +127,7 @@ bool appendMergeMiningTagToExtra(std::vector<uint8_t>& tx_extra, const Transacti
 bool append_message_to_extra(std::vector<uint8_t>& tx_extra, const tx_extra_message& message);
 std::vector<std::string> get_messages_from_extra(const std::vector<uint8_t>& extra, const crypto::PublicKey &txkey, const crypto::SecretKey *recepient_secret_key);
 void appendTTLToExtra(std::vector<uint8_t>& tx_extra, uint64_t ttl);
+bool getTTLFromExtra(const std::vector<uint8_t>& tx_extra, uint64_t& ttl);
 bool getMergeMiningTagFromExtra(const std::vector<uint8_t>& tx_extra, TransactionExtraMergeMiningTag& mm_tag);
 
 bool createTxExtraWithPaymentId(const std::string& paymentIdString, std::vector<uint8_t>& extra);
@@ -8,12 +8,16 @@
 #include "TransactionPool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <vector>
 #include <unordered_set>
 
 #include <boost/filesystem.hpp>
+#include <boost/iterator/indirect_iterator.hpp>
 
 #include "Common/int-util.h"
+#include "Common/Metrics.h"
 #include "Common/Util.h"
 #include "crypto/hash.h"
 
@@ -115,12 +119,17 @@ namespace cn
                                m_txCheckInterval(60, timeProvider),
                                m_validator(validator),
                                m_fee_index(boost::get<1>(m_transactions)),
+                               m_version(0),
                                logger(log, "txpool")
   {
   }
 
   bool tx_memory_pool::add_tx(const Transaction &tx, /*const crypto::Hash& tx_prefix_hash,*/ const crypto::Hash &id, size_t blobSize, tx_verification_context &tvc, bool keptByBlock, uint32_t height)
   {
+    static common::MetricHistogram &addTxLatency = common::MetricsRegistry::instance().histogram(
+        "conceal_pool_add_tx_seconds", "Time spent admitting a transaction to the pool");
+    common::MetricTimer timer(addTxLatency);
+
     if (!check_inputs_types_supported(tx))
     {
       tvc.m_verification_failed = true;
@@ -150,10 +159,8 @@ namespace cn
       return false;
     }
 
-    std::vector<TransactionExtraField> txExtraFields;
-    parseTransactionExtra(tx.extra, txExtraFields);
     TransactionExtraTTL ttl;
-    if (!findTransactionExtraFieldByType(txExtraFields, ttl))
+    if (!getTTLFromExtra(tx.extra, ttl.ttl))
     {
       ttl.ttl = 0;
     }
@@ -188,7 +195,6 @@ namespace cn
     //check key images for transaction if it is not kept by block
     if (!keptByBlock)
     {
-      std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
       if (haveSpentInputs(tx))
       {
         logger(WARNING) << "Transaction with id= " << id << " used already spent inputs";
@@ -237,35 +243,46 @@ namespace cn
       return true;
     }
 
+    // the early check above ran without the pool lock, a conflicting transaction may have been added since
+    if (!keptByBlock && haveSpentInputs(tx))
+    {
+      logger(WARNING) << "Transaction with id= " << id << " used already spent inputs";
+      tvc.m_verification_failed = true;
+      return false;
+    }
+
     // add to pool
     {
-      TransactionDetails txd;
+      auto txd = std::make_shared<TransactionDetails>();
 
-      txd.id = id;
-      txd.blobSize = blobSize;
-      txd.tx = tx;
-      txd.fee = fee;
-      txd.keptByBlock = keptByBlock;
-      txd.receiveTime = m_timeProvider.now();
+      txd->id = id;
+      txd->blobSize = blobSize;
+      txd->tx = tx;
+      txd->fee = fee;
+      txd->keptByBlock = keptByBlock;
+      txd->receiveTime = m_timeProvider.now();
 
-      txd.maxUsedBlock = maxUsedBlock;
-      txd.lastFailedBlock.clear();
+      txd->maxUsedBlock = maxUsedBlock;
+      txd->lastFailedBlock.clear();
 
-      auto txd_p = m_transactions.insert(std::move(txd));
-      if (!(txd_p.second))
+      if (!insertTransaction(txd))
       {
         logger(WARNING, BRIGHT_YELLOW) << " Transaction already exists at inserting in memory pool";
         return false;
       }
-      m_paymentIdIndex.add(txd.tx);
-      m_timestampIndex.add(txd.receiveTime, txd.id);
+      if (m_journal.isOpen())
+      {
+        m_journal.append(PoolJournal::ADD, toBinaryArray(*txd));
+      }
+      m_paymentIdIndex.add(txd->tx);
+      m_timestampIndex.add(txd->receiveTime, txd->id);
 
       if (ttl.ttl != 0)
       {
         m_ttlIndex.emplace(std::make_pair(id, ttl.ttl));
       }
 
-      logger(DEBUGGING) << "Transaction " << txd.id << " added to pool";
+      logger(DEBUGGING) << "Transaction " << txd->id << " added to pool";
     }
 
     if (height >= m_currency.upgradeHeight(BLOCK_MAJOR_VERSION_8))
@@ -307,7 +324,7 @@ namespace cn
       return false;
     }
 
-    auto &txd = *it;
+    const auto &txd = **it;
 
     tx = txd.tx;
     blobSize = txd.blobSize;
@@ -319,15 +336,13 @@ namespace cn
 
   bool tx_memory_pool::getTransaction(const crypto::Hash &id, Transaction &tx)
   {
-    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-    auto it = m_transactions.find(id);
-    if (it == m_transactions.end())
+    auto txd = findTransaction(id);
+    if (!txd)
     {
       return false;
     }
 
-    auto &txd = *it;
-    tx = txd.tx;
+    tx = txd->tx;
 
     return true;
   }
@@ -335,49 +350,61 @@ namespace cn
   //---------------------------------------------------------------------------------
   size_t tx_memory_pool::get_transactions_count() const
   {
-    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-    return m_transactions.size();
+    return snapshot()->transactions.size();
   }
   //---------------------------------------------------------------------------------
   void tx_memory_pool::get_transactions(std::list<Transaction> &txs) const
   {
-    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-    for (const auto &tx_vt : m_transactions)
+    auto poolSnapshot = snapshot();
+    for (const auto &txd : poolSnapshot->transactions)
     {
-      txs.push_back(tx_vt.tx);
+      txs.push_back(txd->tx);
     }
   }
   //---------------------------------------------------------------------------------
-  void tx_memory_pool::get_difference(const std::vector<crypto::Hash> &known_tx_ids, std::vector<crypto::Hash> &new_tx_ids, std::vector<crypto::Hash> &deleted_tx_ids) const
+  std::vector<tx_memory_pool::TransactionDetailsPtr> tx_memory_pool::readyTransactions(const PoolSnapshot &poolSnapshot) const
   {
-    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-    std::unordered_set<crypto::Hash> ready_tx_ids;
-    for (const auto &tx : m_transactions)
+    // runs without the pool lock, the validator takes the blockchain lock on its own
+    std::vector<TransactionDetailsPtr> ready;
+    for (const auto &txd : poolSnapshot.transactions)
     {
-      TransactionCheckInfo checkInfo(tx);
-      if (is_transaction_ready_to_go(tx.tx, checkInfo))
+      TransactionCheckInfo checkInfo(*txd);
+      if (is_transaction_ready_to_go(txd->tx, checkInfo))
       {
-        ready_tx_ids.insert(tx.id);
+        ready.push_back(txd);
       }
     }
 
+    return ready;
+  }
+  //---------------------------------------------------------------------------------
+  void tx_memory_pool::get_difference(const std::vector<crypto::Hash> &known_tx_ids, std::vector<crypto::Hash> &new_tx_ids, std::vector<crypto::Hash> &deleted_tx_ids) const
+  {
     std::unordered_set<crypto::Hash> known_set(known_tx_ids.begin(), known_tx_ids.end());
-    for (auto it = ready_tx_ids.begin(), e = ready_tx_ids.end(); it != e;)
+    new_tx_ids.clear();
+    for (const auto &txd : readyTransactions(*snapshot()))
     {
-      auto known_it = known_set.find(*it);
-      if (known_it != known_set.end())
+      if (known_set.erase(txd->id) == 0)
       {
-        known_set.erase(known_it);
-        it = ready_tx_ids.erase(it);
+        new_tx_ids.push_back(txd->id);
       }
-      else
+    }
+
+    deleted_tx_ids.assign(known_set.begin(), known_set.end());
+  }
+  //---------------------------------------------------------------------------------
+  void tx_memory_pool::getPoolChanges(const std::vector<crypto::Hash> &knownTxsIds, std::vector<Transaction> &addedTxs, std::vector<crypto::Hash> &deletedTxsIds) const
+  {
+    std::unordered_set<crypto::Hash> knownSet(knownTxsIds.begin(), knownTxsIds.end());
+    for (const auto &txd : readyTransactions(*snapshot()))
+    {
+      if (knownSet.erase(txd->id) == 0)
       {
-        ++it;
+        addedTxs.push_back(txd->tx);
       }
     }
 
-    new_tx_ids.assign(ready_tx_ids.begin(), ready_tx_ids.end());
-    deleted_tx_ids.assign(known_set.begin(), known_set.end());
+    deletedTxsIds.assign(knownSet.begin(), knownSet.end());
   }
   //---------------------------------------------------------------------------------
   bool tx_memory_pool::on_blockchain_inc(uint64_t new_block_height, const crypto::Hash &top_block_id)
@@ -392,13 +419,7 @@ namespace cn
   //---------------------------------------------------------------------------------
   bool tx_memory_pool::have_tx(const crypto::Hash &id) const
   {
-    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-    if (m_transactions.count(id))
-    {
-      return true;
-    }
-
-    return false;
+    return findTransaction(id) != nullptr;
   }
   //---------------------------------------------------------------------------------
   void tx_memory_pool::lock() const
@@ -439,8 +460,9 @@ namespace cn
   {
     std::stringstream ss;
     std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-    for (const auto &txd : m_fee_index)
+    for (const auto &txdPtr : m_fee_index)
     {
+      const auto &txd = *txdPtr;
       ss << "id: " << txd.id << std::endl;
 
       if (!short_format)
@@ -470,7 +492,24 @@ namespace cn
       uint64_t &fee,
       uint32_t &height)
   {
-    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
+    static common::MetricHistogram &fillLatency = common::MetricsRegistry::instance().histogram(
+        "conceal_pool_fill_block_template_seconds", "Time spent selecting pool transactions for a block template");
+    common::MetricTimer timer(fillLatency);
+
+    // take the candidates in fee order under the lock, then check them without holding it
+    std::vector<TransactionDetailsPtr> candidates;
+    {
+      std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
+      candidates.reserve(m_fee_index.size());
+      for (const auto &txd : m_fee_index)
+      {
+        if (m_ttlIndex.count(txd->id) == 0)
+        {
+          candidates.push_back(txd);
+        }
+      }
+    }
+
     total_size = 0;
     fee = 0;
     size_t max_total_size = (125 * median_size) / 100 - m_currency.minerTxBlobReservedSize();
@@ -478,14 +517,9 @@ namespace cn
 
     BlockTemplate blockTemplate;
 
-    for (auto it = m_fee_index.begin(); it != m_fee_index.end(); ++it)
+    for (const auto &candidate : candidates)
     {
-      const auto &txd = *it;
-
-      if (m_ttlIndex.count(txd.id) > 0)
-      {
-        continue;
-      }
+      const auto &txd = *candidate;
 
       uint64_t inputs_amount = m_currency.getTransactionAllInputsAmount(txd.tx, height);
       uint64_t outputs_amount = get_outs_money_amount(txd.tx);
@@ -527,50 +561,74 @@ namespace cn
     std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
 
     m_config_folder = config_folder;
+    if (!tools::create_directories_if_necessary(m_config_folder))
+    {
+      logger(INFO) << "Failed to create data directory: " << m_config_folder;
+      return false;
+    }
+
+    std::string journal_file_path = config_folder + "/" + parameters::CRYPTONOTE_POOLJOURNAL_FILENAME;
     std::string state_file_path = config_folder + "/" + m_currency.txPoolFileName();
     boost::system::error_code ec;
-    if (!boost::filesystem::exists(state_file_path, ec))
+    bool haveJournal = boost::filesystem::exists(journal_file_path, ec);
+    bool haveStateFile = boost::filesystem::exists(state_file_path, ec);
+
+    // a pool dumped by an older version is loaded once and carried over into the journal
+    if (!haveJournal && haveStateFile)
     {
-      return true;
+      if (loadFromBinaryFile(*this, state_file_path))
+      {
+        buildIndices();
+      }
+      else
+      {
+        logger(ERROR) << "Failed to load memory pool from file " << state_file_path;
+        clearTransactions();
+        {
+          std::lock_guard<std::mutex> spentLock(m_spentInputsLock);
+          m_spent_key_images.clear();
+          m_spentOutputs.clear();
+        }
+      }
     }
 
-    if (!loadFromBinaryFile(*this, state_file_path))
+    if (!openJournal(journal_file_path))
     {
-      logger(ERROR) << "Failed to load memory pool from file " << state_file_path;
-
-      m_transactions.clear();
-      m_spent_key_images.clear();
-      m_spentOutputs.clear();
+      logger(ERROR) << "Failed to load memory pool journal " << journal_file_path << ", starting with an empty pool";
+      while (!m_transactions.empty())
+      {
+        removeTransaction(m_transactions.begin());
+      }
 
-      m_paymentIdIndex.clear();
-      m_timestampIndex.clear();
-      m_ttlIndex.clear();
+      m_recentlyDeletedTransactions.clear();
+      boost::filesystem::remove(journal_file_path, ec);
+      haveJournal = false;
+      if (!openJournal(journal_file_path))
+      {
+        return false;
+      }
     }
-    else
+
+    if (!haveJournal)
     {
-      buildIndices();
+      compactJournal();
+      if (haveStateFile)
+      {
+        boost::filesystem::remove(state_file_path, ec);
+      }
     }
 
     removeExpiredTransactions();
 
-    // Ignore deserialization error
     return true;
   }
   //---------------------------------------------------------------------------------
   bool tx_memory_pool::deinit()
   {
-    if (!tools::create_directories_if_necessary(m_config_folder))
-    {
-      logger(INFO) << "Failed to create data directory: " << m_config_folder;
-      return false;
-    }
-
-    std::string state_file_path = m_config_folder + "/" + m_currency.txPoolFileName();
+    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
 
-    if (!storeToBinaryFile(*this, state_file_path))
-    {
-      logger(INFO) << "Failed to serialize memory pool to file " << state_file_path;
-    }
+    // every change is already in the journal, nothing is dumped at shutdown
+    m_journal.close();
 
     m_paymentIdIndex.clear();
     m_timestampIndex.clear();
@@ -611,23 +669,197 @@ namespace cn
 
     if (s.type() == ISerializer::INPUT)
     {
-      m_transactions.clear();
-      readSequence<TransactionDetails>(std::inserter(m_transactions, m_transactions.end()), "transactions", s);
+      clearTransactions();
+      std::vector<TransactionDetails> transactions;
+      readSequence<TransactionDetails>(std::back_inserter(transactions), "transactions", s);
+      for (auto &txd : transactions)
+      {
+        insertTransaction(std::make_shared<TransactionDetails>(std::move(txd)));
+      }
     }
     else
     {
-      writeSequence<TransactionDetails>(m_transactions.begin(), m_transactions.end(), "transactions", s);
+      writeSequence<TransactionDetails>(boost::make_indirect_iterator(m_transactions.begin()), boost::make_indirect_iterator(m_transactions.end()), "transactions", s);
     }
 
-    KV_MEMBER(m_spent_key_images);
-    KV_MEMBER(m_spentOutputs);
+    {
+      std::lock_guard<std::mutex> spentLock(m_spentInputsLock);
+      KV_MEMBER(m_spent_key_images);
+      KV_MEMBER(m_spentOutputs);
+    }
     KV_MEMBER(m_recentlyDeletedTransactions);
   }
 
+  namespace
+  {
+    struct PoolRemoval
+    {
+      crypto::Hash id;
+      uint64_t deletedAt; // 0 unless the id is kept in the recently deleted list
+    };
+
+    void serialize(PoolRemoval &removal, ISerializer &s)
+    {
+      s(removal.id, "id");
+      s(removal.deletedAt, "deletedAt");
+    }
+  }
+
+  //---------------------------------------------------------------------------------
+  bool tx_memory_pool::openJournal(const std::string &fileName)
+  {
+    return m_journal.open(fileName, [this](PoolJournal::RecordType type, const BinaryArray &payload) {
+      if (type == PoolJournal::ADD)
+      {
+        TransactionDetails txd;
+        if (fromBinaryArray(txd, payload))
+        {
+          restoreTransaction(std::move(txd));
+        }
+      }
+      else
+      {
+        PoolRemoval removal;
+        if (!fromBinaryArray(removal, payload))
+        {
+          return;
+        }
+
+        auto it = m_transactions.find(removal.id);
+        if (it != m_transactions.end())
+        {
+          removeTransaction(it);
+        }
+
+        if (removal.deletedAt != 0)
+        {
+          m_recentlyDeletedTransactions[removal.id] = removal.deletedAt;
+        }
+      }
+    });
+  }
+
+  //---------------------------------------------------------------------------------
+  void tx_memory_pool::restoreTransaction(TransactionDetails &&txd)
+  {
+    auto restored = std::make_shared<TransactionDetails>(std::move(txd));
+    if (!insertTransaction(restored))
+    {
+      return;
+    }
+
+    if (!addTransactionInputs(restored->id, restored->tx, restored->keptByBlock))
+    {
+      logger(WARNING) << "Journaled transaction " << restored->id << " conflicts with the pool, dropped";
+      m_transactions.erase(restored->id);
+      TransactionShard &shard = shardFor(restored->id);
+      std::lock_guard<std::mutex> shardLock(shard.mutex);
+      shard.transactions.erase(restored->id);
+      return;
+    }
+
+    addToIndices(*restored);
+  }
+
+  //---------------------------------------------------------------------------------
+  void tx_memory_pool::compactJournal()
+  {
+    std::vector<PoolJournal::Record> records;
+    records.reserve(m_transactions.size() + m_recentlyDeletedTransactions.size());
+    for (const auto &txd : m_transactions)
+    {
+      records.push_back({PoolJournal::ADD, toBinaryArray(*txd)});
+    }
+
+    for (const auto &deleted : m_recentlyDeletedTransactions)
+    {
+      PoolRemoval removal = {deleted.first, deleted.second};
+      records.push_back({PoolJournal::REMOVE, toBinaryArray(removal)});
+    }
+
+    if (!m_journal.compact(records))
+    {
+      logger(WARNING) << "Failed to compact memory pool journal";
+    }
+  }
+
+  //---------------------------------------------------------------------------------
+  void tx_memory_pool::compactJournalIfNeeded()
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
+    size_t liveRecords = m_transactions.size() + m_recentlyDeletedTransactions.size();
+    if (m_journal.isOpen() && m_journal.recordCount() > POOL_JOURNAL_COMPACTION_MIN_RECORDS && m_journal.recordCount() > 2 * liveRecords)
+    {
+      compactJournal();
+    }
+  }
+
+  //---------------------------------------------------------------------------------
+  void tx_memory_pool::revalidate()
+  {
+    // signatures are checked on all cores first, so the serial pass below finds them in the signature cache
+    auto poolSnapshot = snapshot();
+    const auto &transactions = poolSnapshot->transactions;
+    std::vector<uint8_t> signaturesValid(transactions.size(), 0);
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+      for (size_t i = next++; i < transactions.size(); i = next++)
+      {
+        signaturesValid[i] = m_validator.preverifyTransaction(transactions[i]->tx) ? 1 : 0;
+      }
+    };
+
+    size_t threadCount = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), transactions.size()));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+      threads.emplace_back(worker);
+    }
+
+    worker();
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+
+    size_t removed = 0;
+    {
+      std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
+      for (size_t i = 0; i < transactions.size(); ++i)
+      {
+        const auto &txd = *transactions[i];
+        auto it = m_transactions.find(txd.id);
+        if (it == m_transactions.end())
+        {
+          continue;
+        }
+
+        BlockInfo maxUsedBlock;
+        bool valid = signaturesValid[i] && !m_validator.haveSpentKeyImages(txd.tx) &&
+                     (txd.keptByBlock || m_validator.checkTransactionInputs(txd.tx, maxUsedBlock));
+        if (!valid)
+        {
+          logger(INFO) << "Tx " << txd.id << " removed from tx pool, it is no longer valid";
+          removeTransaction(it);
+          ++removed;
+        }
+      }
+    }
+
+    if (removed != 0)
+    {
+      m_observerManager.notify(&ITxPoolObserver::txDeletedFromPool);
+    }
+  }
+
   //---------------------------------------------------------------------------------
   void tx_memory_pool::on_idle()
   {
-    m_txCheckInterval.call([this]() { return removeExpiredTransactions(); });
+    m_txCheckInterval.call([this]() {
+      bool result = removeExpiredTransactions();
+      compactJournalIfNeeded();
+      return result;
+    });
   }
 
   //---------------------------------------------------------------------------------
@@ -654,24 +886,25 @@ namespace cn
 
       for (auto it = m_transactions.begin(); it != m_transactions.end();)
       {
-        uint64_t txAge = now - it->receiveTime;
-        bool remove = txAge > (it->keptByBlock ? m_currency.mempoolTxFromAltBlockLiveTime() : m_currency.mempoolTxLiveTime());
+        const auto &txd = **it;
+        uint64_t txAge = now - txd.receiveTime;
+        bool remove = txAge > (txd.keptByBlock ? m_currency.mempoolTxFromAltBlockLiveTime() : m_currency.mempoolTxLiveTime());
 
-        auto ttlIt = m_ttlIndex.find(it->id);
+        auto ttlIt = m_ttlIndex.find(txd.id);
         bool ttlExpired = (ttlIt != m_ttlIndex.end() && ttlIt->second <= now);
 
         if (remove || ttlExpired)
         {
           if (ttlExpired)
           {
-            logger(INFO) << "Tx " << it->id << " removed from tx pool due to expired TTL, TTL : " << ttlIt->second;
+            logger(INFO) << "Tx " << txd.id << " removed from tx pool due to expired TTL, TTL : " << ttlIt->second;
           }
           else
           {
-            logger(INFO) << "Tx " << it->id << " removed from tx pool due to outdated, age: " << txAge;
+            logger(INFO) << "Tx " << txd.id << " removed from tx pool due to outdated, age: " << txAge;
           }
 
-          m_recentlyDeletedTransactions.emplace(it->id, now);
+          m_recentlyDeletedTransactions.emplace(txd.id, now);
           it = removeTransaction(it);
           somethingRemoved = true;
         }
@@ -690,17 +923,101 @@ namespace cn
     return true;
   }
 
+  bool tx_memory_pool::insertTransaction(TransactionDetailsPtr txd)
+  {
+    if (!m_transactions.insert(txd).second)
+    {
+      return false;
+    }
+
+    TransactionShard &shard = shardFor(txd->id);
+    {
+      std::lock_guard<std::mutex> shardLock(shard.mutex);
+      shard.transactions.emplace(txd->id, txd);
+    }
+
+    ++m_version;
+    return true;
+  }
+
   tx_memory_pool::tx_container_t::iterator tx_memory_pool::removeTransaction(tx_memory_pool::tx_container_t::iterator i)
   {
-    removeTransactionInputs(i->id, i->tx, i->keptByBlock);
-    m_paymentIdIndex.remove(i->tx);
-    m_timestampIndex.remove(i->receiveTime, i->id);
-    m_ttlIndex.erase(i->id);
+    const auto &txd = **i;
+    removeTransactionInputs(txd.id, txd.tx, txd.keptByBlock);
+    m_paymentIdIndex.remove(txd.tx);
+    m_timestampIndex.remove(txd.receiveTime, txd.id);
+    m_ttlIndex.erase(txd.id);
+
+    TransactionShard &shard = shardFor(txd.id);
+    {
+      std::lock_guard<std::mutex> shardLock(shard.mutex);
+      shard.transactions.erase(txd.id);
+    }
+
+    if (m_journal.isOpen())
+    {
+      auto deleted = m_recentlyDeletedTransactions.find(txd.id);
+      PoolRemoval removal = {txd.id, deleted == m_recentlyDeletedTransactions.end() ? 0 : deleted->second};
+      m_journal.append(PoolJournal::REMOVE, toBinaryArray(removal));
+    }
+
+    ++m_version;
     return m_transactions.erase(i);
   }
 
+  void tx_memory_pool::clearTransactions()
+  {
+    m_transactions.clear();
+    for (auto &shard : m_shards)
+    {
+      std::lock_guard<std::mutex> shardLock(shard.mutex);
+      shard.transactions.clear();
+    }
+
+    ++m_version;
+  }
+
+  tx_memory_pool::TransactionShard &tx_memory_pool::shardFor(const crypto::Hash &id) const
+  {
+    return m_shards[std::hash<crypto::Hash>()(id) % TRANSACTION_SHARD_COUNT];
+  }
+
+  tx_memory_pool::TransactionDetailsPtr tx_memory_pool::findTransaction(const crypto::Hash &id) const
+  {
+    TransactionShard &shard = shardFor(id);
+    std::lock_guard<std::mutex> shardLock(shard.mutex);
+    auto it = shard.transactions.find(id);
+    return it == shard.transactions.end() ? nullptr : it->second;
+  }
+
+  std::shared_ptr<const tx_memory_pool::PoolSnapshot> tx_memory_pool::snapshot() const
+  {
+    std::lock_guard<std::mutex> lock(m_snapshotLock);
+    // read the version before collecting, a change made meanwhile makes the next reader rebuild
+    uint64_t version = m_version.load();
+    if (m_snapshot && m_snapshot->version == version)
+    {
+      return m_snapshot;
+    }
+
+    auto poolSnapshot = std::make_shared<PoolSnapshot>();
+    poolSnapshot->version = version;
+    for (const auto &shard : m_shards)
+    {
+      std::lock_guard<std::mutex> shardLock(shard.mutex);
+      for (const auto &entry : shard.transactions)
+      {
+        poolSnapshot->transactions.push_back(entry.second);
+      }
+    }
+
+    m_snapshot = poolSnapshot;
+    return m_snapshot;
+  }
+
   bool tx_memory_pool::removeTransactionInputs(const crypto::Hash &tx_id, const Transaction &tx, bool keptByBlock)
   {
+    std::lock_guard<std::mutex> lock(m_spentInputsLock);
     for (const auto &in : tx.inputs)
     {
       if (in.type() == typeid(KeyInput))
@@ -753,6 +1070,7 @@ namespace cn
   //---------------------------------------------------------------------------------
   bool tx_memory_pool::addTransactionInputs(const crypto::Hash &id, const Transaction &tx, bool keptByBlock)
   {
+    std::lock_guard<std::mutex> lock(m_spentInputsLock);
     // should not fail
     for (const auto &in : tx.inputs)
     {
@@ -793,6 +1111,7 @@ namespace cn
   //---------------------------------------------------------------------------------
   bool tx_memory_pool::haveSpentInputs(const Transaction &tx) const
   {
+    std::lock_guard<std::mutex> lock(m_spentInputsLock);
     for (const auto &in : tx.inputs)
     {
       if (in.type() == typeid(KeyInput))
@@ -828,20 +1147,23 @@ namespace cn
   void tx_memory_pool::buildIndices()
   {
     std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-    for (auto it = m_transactions.begin(); it != m_transactions.end(); it++)
+    for (const auto &txd : m_transactions)
     {
-      m_paymentIdIndex.add(it->tx);
-      m_timestampIndex.add(it->receiveTime, it->id);
+      addToIndices(*txd);
+    }
+  }
 
-      std::vector<TransactionExtraField> txExtraFields;
-      parseTransactionExtra(it->tx.extra, txExtraFields);
-      TransactionExtraTTL ttl;
-      if (findTransactionExtraFieldByType(txExtraFields, ttl))
+  void tx_memory_pool::addToIndices(const TransactionDetails &txd)
+  {
+    m_paymentIdIndex.add(txd.tx);
+    m_timestampIndex.add(txd.receiveTime, txd.id);
+
+    uint64_t ttl;
+    if (getTTLFromExtra(txd.tx.extra, ttl))
+    {
+      if (ttl != 0)
       {
-        if (ttl.ttl != 0)
-        {
-          m_ttlIndex.emplace(std::make_pair(it->id, ttl.ttl));
-        }
+        m_ttlIndex.emplace(std::make_pair(txd.id, ttl));
       }
     }
   }
@@ -859,10 +1181,12 @@ namespace cn
   }
   
   std::list<cn::tx_memory_pool::TransactionDetails> tx_memory_pool::getMemoryPool() const {
-    std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
+    std::vector<TransactionDetailsPtr> ordered = snapshot()->transactions;
+    std::sort(ordered.begin(), ordered.end(), TransactionPriorityComparator());
+
     std::list<tx_memory_pool::TransactionDetails> txs;
-    for (const auto& txd : m_fee_index) {
-      txs.push_back(txd);
+    for (const auto& txd : ordered) {
+      txs.push_back(*txd);
     }
     return txs;
   }
@@ -7,7 +7,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -33,6 +37,7 @@
 #include "CryptoNoteCore/ITxPoolObserver.h"
 #include "CryptoNoteCore/VerificationContext.h"
 #include "CryptoNoteCore/BlockchainIndices.h"
+#include "CryptoNoteCore/PoolJournal.h"
 
 #include <Logging/LoggerRef.h>
 
@@ -86,6 +91,8 @@ namespace cn {
     // load/store operations
     bool init(const std::string& config_folder);
     bool deinit();
+    // Drops transactions that are no longer valid against the current chain, checking signatures on all cores
+    void revalidate();
 
     bool have_tx(const crypto::Hash &id) const;
     bool add_tx(const Transaction &tx, const crypto::Hash &id, size_t blobSize, tx_verification_context& tvc, bool keeped_by_block, uint32_t height);
@@ -114,14 +121,12 @@ namespace cn {
     
     template<class t_ids_container, class t_tx_container, class t_missed_container>
     void getTransactions(const t_ids_container& txsIds, t_tx_container& txs, t_missed_container& missedTxs) {
-      std::lock_guard<std::recursive_mutex> lock(m_transactions_lock);
-
       for (const auto& id : txsIds) {
-        auto it = m_transactions.find(id);
-        if (it == m_transactions.end()) {
+        auto txd = findTransaction(id);
+        if (!txd) {
           missedTxs.push_back(id);
         } else {
-          txs.push_back(it->tx);
+          txs.push_back(txd->tx);
         }
       }
     }
@@ -142,7 +147,11 @@ namespace cn {
       time_t receiveTime;
     };
 
+    typedef std::shared_ptr<const TransactionDetails> TransactionDetailsPtr;
+
     std::list<cn::tx_memory_pool::TransactionDetails> getMemoryPool() const;
+    // Like get_difference, but returns the added transactions themselves, taken from the same snapshot
+    void getPoolChanges(const std::vector<crypto::Hash>& knownTxsIds, std::vector<Transaction>& addedTxs, std::vector<crypto::Hash>& deletedTxsIds) const;
 
   private:
 
@@ -165,15 +174,43 @@ namespace cn {
           // prefer older
           (lhs_hi == rhs_hi && lhs_lo == rhs_lo && lhs.blobSize == rhs.blobSize && lhs.receiveTime < rhs.receiveTime);
       }
+
+      bool operator()(const TransactionDetailsPtr& lhs, const TransactionDetailsPtr& rhs) const {
+        return (*this)(*lhs, *rhs);
+      }
+    };
+
+    struct TransactionIdExtractor {
+      typedef crypto::Hash result_type;
+
+      const crypto::Hash& operator()(const TransactionDetailsPtr& txd) const {
+        return txd->id;
+      }
     };
 
-    typedef hashed_unique<BOOST_MULTI_INDEX_MEMBER(TransactionDetails, crypto::Hash, id)> main_index_t;
-    typedef ordered_non_unique<identity<TransactionDetails>, TransactionPriorityComparator> fee_index_t;
+    typedef hashed_unique<TransactionIdExtractor> main_index_t;
+    typedef ordered_non_unique<identity<TransactionDetailsPtr>, TransactionPriorityComparator> fee_index_t;
 
-    typedef multi_index_container<TransactionDetails,
+    typedef multi_index_container<TransactionDetailsPtr,
       indexed_by<main_index_t, fee_index_t>
     > tx_container_t;
 
+    // Transactions are also kept in shards keyed by id, so lookups by id
+    // only lock one shard instead of the whole pool.
+    static const size_t TRANSACTION_SHARD_COUNT = 16;
+
+    struct TransactionShard {
+      mutable std::mutex mutex;
+      std::unordered_map<crypto::Hash, TransactionDetailsPtr> transactions;
+    };
+
+    // Immutable view of the pool for read-mostly paths; rebuilt lazily when
+    // the pool version moves on.
+    struct PoolSnapshot {
+      uint64_t version;
+      std::vector<TransactionDetailsPtr> transactions;
+    };
+
     typedef std::pair<uint64_t, uint64_t> GlobalOutput;
     typedef std::set<GlobalOutput> GlobalOutputsContainer;
     typedef std::unordered_map<crypto::KeyImage, std::unordered_set<crypto::Hash> > key_images_container;
@@ -184,7 +221,18 @@ namespace cn {
     bool haveSpentInputs(const Transaction& tx) const;
     bool removeTransactionInputs(const crypto::Hash& id, const Transaction& tx, bool keptByBlock);
 
+    bool insertTransaction(TransactionDetailsPtr txd);
     tx_container_t::iterator removeTransaction(tx_container_t::iterator i);
+    void clearTransactions();
+    void addToIndices(const TransactionDetails& txd);
+    bool openJournal(const std::string& fileName);
+    void restoreTransaction(TransactionDetails&& txd);
+    void compactJournal();
+    void compactJournalIfNeeded();
+    TransactionDetailsPtr findTransaction(const crypto::Hash& id) const;
+    TransactionShard& shardFor(const crypto::Hash& id) const;
+    std::shared_ptr<const PoolSnapshot> snapshot() const;
+    std::vector<TransactionDetailsPtr> readyTransactions(const PoolSnapshot& snapshot) const;
     bool removeExpiredTransactions();
     bool is_transaction_ready_to_go(const Transaction& tx, TransactionCheckInfo& txd) const;
     void buildIndices();
@@ -192,7 +240,9 @@ namespace cn {
     tools::ObserverManager<ITxPoolObserver> m_observerManager;
     const cn::Currency& m_currency;
     OnceInTimeInterval m_txCheckInterval;
+    // guards m_transactions, the secondary indices and m_recentlyDeletedTransactions
     mutable std::recursive_mutex m_transactions_lock;
+    mutable std::mutex m_spentInputsLock;
     key_images_container m_spent_key_images;
     GlobalOutputsContainer m_spentOutputs;
 
@@ -202,6 +252,10 @@ namespace cn {
 
     tx_container_t m_transactions;  
     tx_container_t::nth_index<1>::type& m_fee_index;
+    mutable std::array<TransactionShard, TRANSACTION_SHARD_COUNT> m_shards;
+    std::atomic<uint64_t> m_version;
+    mutable std::mutex m_snapshotLock;
+    mutable std::shared_ptr<const PoolSnapshot> m_snapshot;
     std::unordered_map<crypto::Hash, uint64_t> m_recentlyDeletedTransactions;
 
     logging::LoggerRef logger;
@@ -209,5 +263,7 @@ namespace cn {
     PaymentIdIndex m_paymentIdIndex;
     TimestampTransactionsIndex m_timestampIndex;
     std::unordered_map<crypto::Hash, uint64_t> m_ttlIndex;
+
+    PoolJournal m_journal;
   };
 }
@@ -36,6 +36,7 @@ public:
   virtual bool getPaymentId(Hash& paymentId) const override;
   virtual bool getExtraNonce(BinaryArray& nonce) const override;
   virtual BinaryArray getExtra() const override;
+  virtual std::vector<std::string> getMessages(const SecretKey* recipientSecretKey) const override;
 
   // inputs
   virtual size_t getInputCount() const override;
@@ -68,7 +69,7 @@ public:
 
 private:
   TransactionPrefix m_txPrefix;
-  TransactionExtra m_extra;
+  TransactionExtraCache m_extra;
   Hash m_txHash;
 };
 
@@ -76,10 +77,10 @@ TransactionPrefixImpl::TransactionPrefixImpl() {
 }
 
 TransactionPrefixImpl::TransactionPrefixImpl(const TransactionPrefix& prefix, const Hash& transactionHash) {
-  m_extra.parse(prefix.extra);
-
   m_txPrefix = prefix;
   m_txHash = transactionHash;
+
+  m_extra.load(m_txPrefix.extra);
 }
 
 Hash TransactionPrefixImpl::getTransactionHash() const {
@@ -106,34 +107,21 @@ uint64_t TransactionPrefixImpl::getUnlockTime() const {
 }
 
 bool TransactionPrefixImpl::getPaymentId(Hash& hash) const {
-  BinaryArray nonce;
-
-  if (getExtraNonce(nonce)) {
-    crypto::Hash paymentId;
-    if (getPaymentIdFromTransactionExtraNonce(nonce, paymentId)) {
-      hash = reinterpret_cast<const Hash&>(paymentId);
-      return true;
-    }
-  }
-
-  return false;
+  return m_extra.getPaymentId(hash);
 }
 
 bool TransactionPrefixImpl::getExtraNonce(BinaryArray& nonce) const {
-  TransactionExtraNonce extraNonce;
-
-  if (m_extra.get(extraNonce)) {
-    nonce = extraNonce.nonce;
-    return true;
-  }
-
-  return false;
+  return m_extra.getExtraNonce(nonce);
 }
 
 BinaryArray TransactionPrefixImpl::getExtra() const {
   return m_txPrefix.extra;
 }
 
+std::vector<std::string> TransactionPrefixImpl::getMessages(const SecretKey* recipientSecretKey) const {
+  return get_messages_from_extra(m_txPrefix.extra, getTransactionPublicKey(), recipientSecretKey);
+}
+
 size_t TransactionPrefixImpl::getInputCount() const {
   return m_txPrefix.inputs.size();
 }
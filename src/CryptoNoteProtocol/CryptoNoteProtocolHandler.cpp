@@ -9,11 +9,16 @@
 
 #include "CryptoNoteProtocolHandler.h"
 
+#include <algorithm>
+#include <atomic>
 #include <future>
+#include <thread>
 #include <boost/scope_exit.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <System/Dispatcher.h>
+#include <System/RemoteContext.h>
 #include <boost/optional.hpp>
+#include "Common/Metrics.h"
 #include "CryptoNoteCore/CryptoNoteBasicImpl.h"
 #include "CryptoNoteCore/CryptoNoteFormatUtils.h"
 #include "CryptoNoteCore/CryptoNoteTools.h"
@@ -247,6 +252,9 @@ int notifyAdaptor(const BinaryArray &reqBuf, CryptoNoteConnectionContext &ctx, H
 #define HANDLE_NOTIFY(CMD, Handler)                                                                                                   \
   case CMD::ID:                                                                                                                       \
   {                                                                                                                                   \
+    static common::MetricHistogram &latency = common::MetricsRegistry::instance().histogram(                                         \
+        "conceal_p2p_handler_seconds", "Time spent in protocol message handlers", common::metricLabel("command", #CMD));              \
+    common::MetricTimer timer(latency);                                                                                               \
     ret = notifyAdaptor<CMD>(in, ctx, std::bind(Handler, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)); \
     break;                                                                                                                            \
   }
@@ -360,14 +368,19 @@ int CryptoNoteProtocolHandler::handle_notify_new_transactions(int command, NOTIF
   }
   else
   {
-    for (auto tx_blob_it = arg.txs.begin(); tx_blob_it != arg.txs.end();)
+    std::vector<IncomingTransaction> incoming = preverifyTransactions(arg.txs);
+
+    auto tx_blob_it = arg.txs.begin();
+    for (auto &transaction : incoming)
     {
-      auto transactionBinary = asBinaryArray(*tx_blob_it);
-      crypto::Hash transactionHash = crypto::cn_fast_hash(transactionBinary.data(), transactionBinary.size());
-      logger(DEBUGGING) << "transaction " << transactionHash << " came in NOTIFY_NEW_TRANSACTIONS";
+      logger(DEBUGGING) << "transaction " << transaction.hash << " came in NOTIFY_NEW_TRANSACTIONS";
+
+      cn::tx_verification_context &tvc = transaction.tvc;
+      if (transaction.preverified)
+      {
+        m_core.handle_preverified_tx(transaction.tx, transaction.hash, tx_blob_it->size(), tvc, false);
+      }
 
-      cn::tx_verification_context tvc = boost::value_initialized<decltype(tvc)>();
-      m_core.handle_incoming_tx(transactionBinary, tvc, false);
       if (tvc.m_verification_failed)
       {
         logger(logging::DEBUGGING) << context << "Tx verification failed";
@@ -392,6 +405,44 @@ int CryptoNoteProtocolHandler::handle_notify_new_transactions(int command, NOTIF
   return true;
 }
 
+std::vector<CryptoNoteProtocolHandler::IncomingTransaction> CryptoNoteProtocolHandler::preverifyTransactions(const std::vector<std::string> &txs)
+{
+  std::vector<IncomingTransaction> incoming(txs.size());
+  if (txs.empty())
+  {
+    return incoming;
+  }
+
+  // parsing and ring signature checks of the batch run on worker threads while the dispatcher serves other connections,
+  // only the pool insertion afterwards is sequential
+  platform_system::RemoteContext<void> verification(m_dispatcher, [this, &txs, &incoming] {
+    std::atomic<size_t> next(0);
+    auto worker = [this, &txs, &incoming, &next] {
+      for (size_t i = next++; i < txs.size(); i = next++)
+      {
+        IncomingTransaction &transaction = incoming[i];
+        transaction.preverified = m_core.preverify_incoming_tx(asBinaryArray(txs[i]), transaction.tx, transaction.hash, transaction.tvc);
+      }
+    };
+
+    size_t threads = std::min<size_t>(txs.size(), std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::future<void>> workers;
+    for (size_t i = 1; i < threads; ++i)
+    {
+      workers.push_back(std::async(std::launch::async, worker));
+    }
+
+    worker();
+    for (auto &w : workers)
+    {
+      w.get();
+    }
+  });
+
+  verification.get();
+  return incoming;
+}
+
 int CryptoNoteProtocolHandler::handle_request_get_objects(int command, NOTIFY_REQUEST_GET_OBJECTS::request &arg, CryptoNoteConnectionContext &context)
 {
   logger(logging::TRACE) << context << "NOTIFY_REQUEST_GET_OBJECTS";
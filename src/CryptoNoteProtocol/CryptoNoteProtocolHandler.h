@@ -13,6 +13,7 @@
 #include <Common/ObserverManager.h>
 #include "../CryptoNoteConfig.h"
 #include "CryptoNoteCore/ICore.h"
+#include "CryptoNoteCore/VerificationContext.h"
 
 #include "CryptoNoteProtocol/CryptoNoteProtocolDefinitions.h"
 #include "CryptoNoteProtocol/CryptoNoteProtocolHandlerCommon.h"
@@ -102,6 +103,15 @@ namespace cn
     logging::LoggerRef logger;
 
   private:
+    struct IncomingTransaction
+    {
+      Transaction tx;
+      crypto::Hash hash = NULL_HASH;
+      tx_verification_context tvc{};
+      bool preverified = false;
+    };
+
+    std::vector<IncomingTransaction> preverifyTransactions(const std::vector<std::string> &txs);
     int doPushLiteBlock(NOTIFY_NEW_LITE_BLOCK::request block, CryptoNoteConnectionContext &context, std::vector<BinaryArray> missingTxs);
 
     platform_system::Dispatcher& m_dispatcher;
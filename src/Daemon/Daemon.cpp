@@ -8,6 +8,8 @@
 
 #include "version.h"
 
+#include <thread>
+
 #include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 
@@ -17,6 +19,7 @@
 #include "Common/PathTools.h"
 #include "crypto/hash.h"
 #include "CryptoNoteConfig.h"
+#include "CryptoNoteCore/BlockchainArchive.h"
 #include "CryptoNoteCore/Checkpoints.h"
 #include "CryptoNoteCore/Core.h"
 #include "CryptoNoteCore/CoreConfig.h"
@@ -53,6 +56,8 @@ namespace
   const command_line::arg_descriptor<int>         arg_log_level   = {"log-level", "", 2};
   const command_line::arg_descriptor<bool>        arg_console     = {"no-console", "Disable daemon console commands"};
   const command_line::arg_descriptor<bool>        arg_print_genesis_tx = { "print-genesis-tx", "Prints genesis' block tx hex to insert it to config and exits" };
+  const command_line::arg_descriptor<std::string> arg_export_blockchain = {"export-blockchain", "Write the local blockchain to an archive file and exit", ""};
+  const command_line::arg_descriptor<std::string> arg_import_blockchain = {"import-blockchain", "Append the blocks of an archive file to the local blockchain and exit", ""};
 }
 
 void print_genesis_tx_hex() {
@@ -111,6 +116,8 @@ int main(int argc, char* argv[])
     command_line::add_arg(desc_cmd_only, arg_os_version);
     command_line::add_arg(desc_cmd_only, command_line::arg_data_dir, tools::getDefaultDataDirectory());
     command_line::add_arg(desc_cmd_only, arg_config_file);
+    command_line::add_arg(desc_cmd_only, arg_export_blockchain);
+    command_line::add_arg(desc_cmd_only, arg_import_blockchain);
     command_line::add_arg(desc_cmd_sett, arg_set_fee_address);
     command_line::add_arg(desc_cmd_sett, arg_log_file);
     command_line::add_arg(desc_cmd_sett, arg_log_level);
@@ -229,7 +236,7 @@ int main(int argc, char* argv[])
     cn::Checkpoints checkpoints(logManager);
     checkpoints.set_testnet(coreConfig.testnet);
     checkpoints.load_checkpoints();
-    checkpoints.load_checkpoints_from_dns();
+    checkpoints.load_checkpoints_from_dns(std::chrono::milliseconds(cn::DNS_CHECKPOINTS_STARTUP_TIMEOUT_MS));
     ccore.set_checkpoints(std::move(checkpoints));
 
     NetNodeConfig netNodeConfig;
@@ -252,6 +259,22 @@ int main(int argc, char* argv[])
         throw std::runtime_error("Can't create directory: " + coreConfig.configFolder);
     }
 
+    std::string exportFile = command_line::get_arg(vm, arg_export_blockchain);
+    std::string importFile = command_line::get_arg(vm, arg_import_blockchain);
+    if (!exportFile.empty() || !importFile.empty())
+    {
+      if (!ccore.init(coreConfig, minerConfig, true))
+      {
+        logger(ERROR, BRIGHT_RED) << "Failed to initialize core";
+        return 1;
+      }
+
+      BlockchainArchive archive(ccore, logManager);
+      bool success = exportFile.empty() ? archive.importFrom(importFile, std::thread::hardware_concurrency()) : archive.exportTo(exportFile);
+      ccore.deinit();
+      return success ? 0 : 1;
+    }
+
     platform_system::Dispatcher dispatcher;
 
     cn::CryptoNoteProtocolHandler cprotocol(currency, dispatcher, ccore, nullptr, logManager);
@@ -8,11 +8,68 @@
 #include "HttpParser.h"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 
 #include "HttpParserErrorCodes.h"
 
 namespace {
 
+const size_t MAX_HEADER_SIZE = 64 * 1024;
+
+void throwUnexpectedSymbol() {
+  throw std::system_error(make_error_code(cn::error::HttpParserErrorCodes::UNEXPECTED_SYMBOL));
+}
+
+const char* findLineEnd(const char* begin, const char* end) {
+  for (;;) {
+    const char* cr = static_cast<const char*>(memchr(begin, '\r', end - begin));
+    if (cr == nullptr || cr + 1 == end) {
+      return end;
+    }
+
+    if (cr[1] == '\n') {
+      return cr;
+    }
+
+    begin = cr + 1;
+  }
+}
+
+const char* skipSpaces(const char* begin, const char* end) {
+  while (begin != end && (*begin == ' ' || *begin == '\t')) {
+    ++begin;
+  }
+
+  return begin;
+}
+
+const char* trimSpaces(const char* begin, const char* end) {
+  while (end != begin && (end[-1] == ' ' || end[-1] == '\t')) {
+    --end;
+  }
+
+  return end;
+}
+
+size_t parseContentLength(const char* begin, const char* end) {
+  if (begin == end) {
+    throwUnexpectedSymbol();
+  }
+
+  size_t length = 0;
+  for (; begin != end; ++begin) {
+    // bounded well below SIZE_MAX, so the message size cannot overflow
+    if (*begin < '0' || *begin > '9' || length > std::numeric_limits<size_t>::max() / 20) {
+      throwUnexpectedSymbol();
+    }
+
+    length = length * 10 + (*begin - '0');
+  }
+
+  return length;
+}
+
 void throwIfNotGood(std::istream& stream) {
   if (!stream.good()) {
     if (stream.eof()) {
@@ -225,4 +282,121 @@ void HttpParser::readBody(std::istream& stream, std::string& body, const size_t
   throwIfNotGood(stream);
 }
 
+size_t HttpParser::parseRequest(const char* data, size_t size, HttpRequest& request) {
+  if (m_headerSize == 0) {
+    size_t headerSize = findHeaderEnd(data, size);
+    if (headerSize == 0) {
+      return 0;
+    }
+
+    const char* end = data + headerSize - 2;
+    const char* lineEnd = findLineEnd(data, end);
+    const char* methodEnd = std::find(data, lineEnd, ' ');
+    const char* urlEnd = std::find(std::min(methodEnd + 1, lineEnd), lineEnd, ' ');
+    if (methodEnd == data || methodEnd == lineEnd || urlEnd == methodEnd + 1) {
+      throwUnexpectedSymbol();
+    }
+
+    request.method.assign(data, methodEnd);
+    request.url.assign(methodEnd + 1, urlEnd);
+    parseHeaderLines(lineEnd + 2, end, [&request](std::string&& name, std::string&& value) {
+      request.headers[std::move(name)] = std::move(value);
+    });
+
+    m_headerSize = headerSize;
+  }
+
+  return completeMessage(size, request.body, data);
+}
+
+size_t HttpParser::parseResponse(const char* data, size_t size, HttpResponse& response) {
+  if (m_headerSize == 0) {
+    size_t headerSize = findHeaderEnd(data, size);
+    if (headerSize == 0) {
+      return 0;
+    }
+
+    const char* end = data + headerSize - 2;
+    const char* lineEnd = findLineEnd(data, end);
+    const char* versionEnd = std::find(data, lineEnd, ' ');
+    if (versionEnd == lineEnd) {
+      throwUnexpectedSymbol();
+    }
+
+    response.setStatus(parseResponseStatusFromString(std::string(versionEnd + 1, lineEnd)));
+    parseHeaderLines(lineEnd + 2, end, [&response](std::string&& name, std::string&& value) {
+      response.addHeader(name, value);
+    });
+
+    m_headerSize = headerSize;
+  }
+
+  std::string body;
+  size_t messageSize = completeMessage(size, body, data);
+  if (messageSize != 0) {
+    response.setBody(std::move(body));
+  }
+
+  return messageSize;
+}
+
+size_t HttpParser::findHeaderEnd(const char* data, size_t size) {
+  static const char HEADER_END[] = "\r\n\r\n";
+
+  const char* begin = data + (m_scanned > 3 ? m_scanned - 3 : 0);
+  const char* end = data + size;
+  const char* found = std::search(begin, end, HEADER_END, HEADER_END + 4);
+  if (found == end) {
+    m_scanned = size;
+    if (size > MAX_HEADER_SIZE) {
+      throw std::system_error(make_error_code(cn::error::HttpParserErrorCodes::HEADERS_TOO_LARGE));
+    }
+
+    return 0;
+  }
+
+  m_bodySize = 0;
+  return found + 4 - data;
+}
+
+// Header lines in [begin, end), each terminated by CRLF
+template <typename AddHeader>
+void HttpParser::parseHeaderLines(const char* begin, const char* end, AddHeader addHeader) {
+  while (begin < end) {
+    const char* lineEnd = findLineEnd(begin, end);
+    const char* colon = std::find(begin, lineEnd, ':');
+    if (colon == lineEnd) {
+      throwUnexpectedSymbol();
+    }
+
+    if (colon == begin) {
+      throw std::system_error(make_error_code(cn::error::HttpParserErrorCodes::EMPTY_HEADER));
+    }
+
+    std::string name(begin, colon);
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+    const char* valueBegin = skipSpaces(colon + 1, lineEnd);
+    const char* valueEnd = trimSpaces(valueBegin, lineEnd);
+    if (name == "content-length") {
+      m_bodySize = parseContentLength(valueBegin, valueEnd);
+    }
+
+    addHeader(std::move(name), std::string(valueBegin, valueEnd));
+    begin = lineEnd + 2;
+  }
+}
+
+size_t HttpParser::completeMessage(size_t size, std::string& body, const char* data) {
+  size_t messageSize = m_headerSize + m_bodySize;
+  if (size < messageSize) {
+    return 0;
+  }
+
+  body.assign(data + m_headerSize, m_bodySize);
+  m_scanned = 0;
+  m_headerSize = 0;
+  m_bodySize = 0;
+  return messageSize;
+}
+
 }
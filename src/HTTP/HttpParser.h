@@ -19,12 +19,32 @@ namespace cn {
 //Blocking HttpParser
 class HttpParser {
 public:
-  HttpParser() {};
+  HttpParser() : m_scanned(0), m_headerSize(0), m_bodySize(0) {};
 
   void receiveRequest(std::istream& stream, HttpRequest& request);
   void receiveResponse(std::istream& stream, HttpResponse& response);
   static HttpResponse::HTTP_STATUS parseResponseStatusFromString(const std::string& status);
+
+  // Incremental parsing over a connection read buffer holding the start of a
+  // message. Returns the message size once it is complete and 0 while more data
+  // is needed; pass the same message object until then. The header block is
+  // parsed in place once it is complete and is not rescanned on later calls.
+  size_t parseRequest(const char* data, size_t size, HttpRequest& request);
+  size_t parseResponse(const char* data, size_t size, HttpResponse& response);
+
+  // Size of the message being parsed, known once its headers are complete
+  size_t expectedSize() const { return m_headerSize + m_bodySize; }
+
 private:
+  size_t m_scanned;
+  size_t m_headerSize;
+  size_t m_bodySize;
+
+  size_t findHeaderEnd(const char* data, size_t size);
+  template <typename AddHeader>
+  void parseHeaderLines(const char* begin, const char* end, AddHeader addHeader);
+  size_t completeMessage(size_t size, std::string& body, const char* data);
+
   void readWord(std::istream& stream, std::string& word);
   void readHeaders(std::istream& stream, HttpRequest::Headers &headers);
   bool readHeader(std::istream& stream, std::string& name, std::string& value);
@@ -42,18 +42,25 @@ namespace cn {
     url = u;
   }
 
-  std::ostream& HttpRequest::printHttpRequest(std::ostream& os) const {
-    os << "POST " << url << " HTTP/1.1\r\n";
+  std::string HttpRequest::getHeaderBlock() const {
+    std::string block;
+    block.reserve(256);
+    block.append("POST ").append(url).append(" HTTP/1.1\r\n");
     auto host = headers.find("Host");
     if (host == headers.end()) {
-      os << "Host: " << "127.0.0.1" << "\r\n";
+      block.append("Host: 127.0.0.1\r\n");
     }
 
-    for (auto pair : headers) {
-      os << pair.first << ": " << pair.second << "\r\n";
+    for (const auto& pair : headers) {
+      block.append(pair.first).append(": ").append(pair.second).append("\r\n");
     }
-    
-    os << "\r\n";
+
+    block.append("\r\n");
+    return block;
+  }
+
+  std::ostream& HttpRequest::printHttpRequest(std::ostream& os) const {
+    os << getHeaderBlock();
     if (!body.empty()) {
       os << body;
     }
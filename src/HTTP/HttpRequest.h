@@ -21,6 +21,9 @@ namespace cn {
     const Headers& getHeaders() const;
     const std::string& getBody() const;
 
+    // Request line and headers, terminated by the empty line
+    std::string getHeaderBlock() const;
+
     void addHeader(const std::string& name, const std::string& value);
     void setBody(const std::string& b);
     void setUrl(const std::string& uri);
@@ -65,7 +65,11 @@ void HttpResponse::addHeader(const std::string& name, const std::string& value)
 }
 
 void HttpResponse::setBody(const std::string& b) {
-  body = b;
+  setBody(std::string(b));
+}
+
+void HttpResponse::setBody(std::string&& b) {
+  body = std::move(b);
   if (!body.empty()) {
     headers["Content-Length"] = std::to_string(body.size());
   } else {
@@ -73,13 +77,21 @@ void HttpResponse::setBody(const std::string& b) {
   }
 }
 
-std::ostream& HttpResponse::printHttpResponse(std::ostream& os) const {
-  os << "HTTP/1.1 " << getStatusString(status) << "\r\n";
+std::string HttpResponse::getHeaderBlock() const {
+  std::string block;
+  block.reserve(256);
+  block.append("HTTP/1.1 ").append(getStatusString(status)).append("\r\n");
 
-  for (auto pair: headers) {
-    os << pair.first << ": " << pair.second << "\r\n";
+  for (const auto& pair: headers) {
+    block.append(pair.first).append(": ").append(pair.second).append("\r\n");
   }
-  os << "\r\n";
+  block.append("\r\n");
+
+  return block;
+}
+
+std::ostream& HttpResponse::printHttpResponse(std::ostream& os) const {
+  os << getHeaderBlock();
 
   if (!body.empty()) {
     os << body;
@@ -27,11 +27,15 @@ namespace cn {
     void setStatus(HTTP_STATUS s);
     void addHeader(const std::string& name, const std::string& value);
     void setBody(const std::string& b);
+    void setBody(std::string&& b);
 
     const std::map<std::string, std::string>& getHeaders() const { return headers; }
     HTTP_STATUS getStatus() const { return status; }
     const std::string& getBody() const { return body; }
 
+    // Status line and headers, terminated by the empty line
+    std::string getHeaderBlock() const;
+
   private:
     friend std::ostream& operator<<(std::ostream& os, const HttpResponse& resp);
     std::ostream& printHttpResponse(std::ostream& os) const;
@@ -290,6 +290,62 @@ std::error_code InProcessNode::doGetRandomOutsByAmounts(std::vector<uint64_t>&&
   return std::error_code();
 }
 
+void InProcessNode::getRandomOutsBulk(std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts,
+    std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height, const Callback& callback)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  if (state != INITIALIZED) {
+    lock.unlock();
+    callback(make_error_code(cn::error::NOT_INITIALIZED));
+    return;
+  }
+
+  postIoService(
+    std::bind(&InProcessNode::getRandomOutsBulkAsync,
+      this,
+      std::move(amounts),
+      std::ref(result),
+      std::ref(height),
+      callback
+    )
+  );
+}
+
+void InProcessNode::getRandomOutsBulkAsync(std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>& amounts,
+  std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height, const Callback& callback)
+{
+  std::error_code ec = doGetRandomOutsBulk(std::move(amounts), result, height);
+  callback(ec);
+}
+
+std::error_code InProcessNode::doGetRandomOutsBulk(std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts,
+  std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height) {
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (state != INITIALIZED) {
+      return make_error_code(cn::error::NOT_INITIALIZED);
+    }
+  }
+
+  try {
+    cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::response res;
+    cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::request req;
+    req.amounts = std::move(amounts);
+
+    if (!core.get_random_outs_bulk(req, res)) {
+      return make_error_code(cn::error::REQUEST_ERROR);
+    }
+
+    result = std::move(res.outs);
+    height = res.height;
+  } catch (std::system_error& e) {
+    return e.code();
+  } catch (std::exception&) {
+    return make_error_code(cn::error::INTERNAL_NODE_ERROR);
+  }
+
+  return std::error_code();
+}
 
 void InProcessNode::relayTransaction(const cn::Transaction& transaction, const Callback& callback)
 {
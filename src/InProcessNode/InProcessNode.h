@@ -60,6 +60,8 @@ public:
   virtual void getTransactionOutsGlobalIndices(const crypto::Hash& transactionHash, std::vector<uint32_t>& outsGlobalIndices, const Callback& callback) override;
   virtual void getRandomOutsByAmounts(std::vector<uint64_t>&& amounts, uint64_t outsCount,
       std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, const Callback& callback) override;
+  virtual void getRandomOutsBulk(std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts,
+      std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height, const Callback& callback) override;
   virtual void relayTransaction(const cn::Transaction& transaction, const Callback& callback) override;
   virtual void queryBlocks(std::vector<crypto::Hash>&& knownBlockIds, uint64_t timestamp, std::vector<BlockShortEntry>& newBlocks,
     uint32_t& startHeight, const Callback& callback) override;
@@ -95,6 +97,11 @@ private:
   std::error_code doGetRandomOutsByAmounts(std::vector<uint64_t>&& amounts, uint64_t outsCount,
       std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result);
 
+  void getRandomOutsBulkAsync(std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>& amounts,
+      std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height, const Callback& callback);
+  std::error_code doGetRandomOutsBulk(std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts,
+      std::vector<cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height);
+
   void relayTransactionAsync(const cn::Transaction& transaction, const Callback& callback);
   std::error_code doRelayTransaction(const cn::Transaction& transaction);
 
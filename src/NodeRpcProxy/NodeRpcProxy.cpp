@@ -8,6 +8,7 @@
 #include "NodeRpcProxy.h"
 #include "NodeErrors.h"
 
+#include <algorithm>
 #include <atomic>
 #include <system_error>
 #include <thread>
@@ -73,6 +74,7 @@ void NodeRpcProxy::resetInternalState() {
   m_networkHeight.store(0, std::memory_order_relaxed);
   m_lastKnowHash = cn::NULL_HASH;
   m_knownTxs.clear();
+  m_randomOutsBulkUnsupported = false;
 }
 
 void NodeRpcProxy::init(const INode::Callback& callback) {
@@ -326,6 +328,19 @@ void NodeRpcProxy::getRandomOutsByAmounts(std::vector<uint64_t>&& amounts, uint6
     callback);
 }
 
+void NodeRpcProxy::getRandomOutsBulk(std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts,
+                                     std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& outs,
+                                     uint32_t& height, const Callback& callback) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_state != STATE_INITIALIZED) {
+    callback(make_error_code(error::NOT_INITIALIZED));
+    return;
+  }
+
+  scheduleRequest(std::bind(&NodeRpcProxy::doGetRandomOutsBulk, this, std::move(amounts), std::ref(outs), std::ref(height)),
+    callback);
+}
+
 void NodeRpcProxy::getNewBlocks(std::vector<crypto::Hash>&& knownBlockIds,
                                 std::vector<cn::block_complete_entry>& newBlocks,
                                 uint32_t& startHeight,
@@ -487,6 +502,49 @@ std::error_code NodeRpcProxy::doGetRandomOutsByAmounts(std::vector<uint64_t>& am
   return ec;
 }
 
+std::error_code NodeRpcProxy::doGetRandomOutsBulk(std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>& amounts,
+                                                  std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& outs, uint32_t& height) {
+  if (!m_randomOutsBulkUnsupported) {
+    COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::request req = AUTO_VAL_INIT(req);
+    COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::response rsp = AUTO_VAL_INIT(rsp);
+    req.amounts = amounts;
+
+    std::error_code ec = binaryCommand("/getrandom_outs_bulk.bin", req, rsp);
+    if (!ec) {
+      outs = std::move(rsp.outs);
+      height = rsp.height;
+      return ec;
+    }
+
+    // daemons without the bulk call answer with a page that does not parse
+    if (ec != make_error_code(error::NETWORK_ERROR)) {
+      return ec;
+    }
+  }
+
+  // one count for every amount, trimmed afterwards
+  std::vector<uint64_t> plainAmounts;
+  uint64_t outsCount = 0;
+  for (const auto& amountCount : amounts) {
+    plainAmounts.push_back(amountCount.amount);
+    outsCount = std::max(outsCount, amountCount.count);
+  }
+
+  std::error_code ec = doGetRandomOutsByAmounts(plainAmounts, outsCount, outs);
+  if (!ec) {
+    for (size_t i = 0; i < outs.size() && i < amounts.size(); ++i) {
+      if (outs[i].outs.size() > amounts[i].count) {
+        outs[i].outs.resize(amounts[i].count);
+      }
+    }
+
+    height = m_nodeHeight.load(std::memory_order_relaxed);
+    m_randomOutsBulkUnsupported = true;
+  }
+
+  return ec;
+}
+
 std::error_code NodeRpcProxy::doGetNewBlocks(std::vector<crypto::Hash>& knownBlockIds,
                                              std::vector<cn::block_complete_entry>& newBlocks,
                                              uint32_t& startHeight) {
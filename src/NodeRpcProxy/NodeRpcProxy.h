@@ -85,6 +85,7 @@ public:
 
   void relayTransaction(const cn::Transaction& transaction, const Callback& callback) override;
   void getRandomOutsByAmounts(std::vector<uint64_t>&& amounts, uint64_t outsCount, std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, const Callback& callback) override;
+  void getRandomOutsBulk(std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts, std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height, const Callback& callback) override;
   void getNewBlocks(std::vector<crypto::Hash>&& knownBlockIds, std::vector<cn::block_complete_entry>& newBlocks, uint32_t& startHeight, const Callback& callback) override;
   void getTransactionOutsGlobalIndices(const crypto::Hash& transactionHash, std::vector<uint32_t>& outsGlobalIndices, const Callback& callback) override;
   void queryBlocks(std::vector<crypto::Hash>&& knownBlockIds, uint64_t timestamp, std::vector<BlockShortEntry>& newBlocks, uint32_t& startHeight, const Callback& callback) override;
@@ -118,6 +119,8 @@ private:
   std::error_code doRelayTransaction(const cn::Transaction& transaction);
   std::error_code doGetRandomOutsByAmounts(std::vector<uint64_t>& amounts, uint64_t outsCount,
                                            std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result);
+  std::error_code doGetRandomOutsBulk(std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>& amounts,
+                                      std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height);
 
   std::error_code doGetNewBlocks(std::vector<crypto::Hash>& knownBlockIds,
     std::vector<cn::block_complete_entry>& newBlocks, uint32_t& startHeight);
@@ -171,6 +174,8 @@ private:
   crypto::Hash m_lastKnowHash;
   std::atomic<uint64_t> m_lastLocalBlockTimestamp;
   std::unordered_set<crypto::Hash> m_knownTxs;
+  // daemon answered /getrandom_outs_bulk.bin with something other than a response
+  bool m_randomOutsBulkUnsupported = false;
 
   bool m_connected;
 };
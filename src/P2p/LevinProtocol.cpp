@@ -6,6 +6,7 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "LevinProtocol.h"
+#include <Common/Metrics.h>
 #include <System/TcpConnection.h>
 
 using namespace cn;
@@ -114,16 +115,25 @@ void LevinProtocol::sendReply(uint32_t command, const BinaryArray& out, int32_t
 }
 
 void LevinProtocol::writeStrict(const uint8_t* ptr, size_t size) {
+  static common::MetricCounter& bytesSent = common::MetricsRegistry::instance().counter(
+    "conceal_p2p_bytes_sent_total", "Bytes written to levin connections");
+
   size_t offset = 0;
   while (offset < size) {
     offset += m_conn.write(ptr + offset, size - offset);
   }
+
+  bytesSent.increment(size);
 }
 
 bool LevinProtocol::readStrict(uint8_t* ptr, size_t size) {
+  static common::MetricCounter& bytesReceived = common::MetricsRegistry::instance().counter(
+    "conceal_p2p_bytes_received_total", "Bytes read from levin connections");
+
   size_t offset = 0;
   while (offset < size) {
     size_t read = m_conn.read(ptr + offset, size - offset);
+    bytesReceived.increment(read);
     if (read == 0) {
       return false;
     }
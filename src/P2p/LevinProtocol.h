@@ -73,8 +73,7 @@ public:
   template <typename T>
   static bool decode(const BinaryArray& buf, T& value) {
     try {
-      common::MemoryInputStream stream(buf.data(), buf.size());
-      KVBinaryInputStreamSerializer serializer(stream);
+      KVBinaryInputStreamSerializer serializer(buf.data(), buf.size());
       serialize(value, serializer);
     } catch (std::exception&) {
       return false;
@@ -249,11 +249,14 @@ void GetTransactionHashes::Request::serialize(cn::ISerializer &serializer)
   }
 
   serializer(paymentId, "paymentId");
+  serializer(limit, "limit");
+  serializer(cursor, "cursor");
 }
 
 void GetTransactionHashes::Response::serialize(cn::ISerializer &serializer)
 {
   serializer(items, "items");
+  serializer(nextCursor, "nextCursor");
 }
 
 void CreateIntegrated::Request::serialize(cn::ISerializer &serializer)
@@ -338,11 +341,14 @@ void GetTransactions::Request::serialize(cn::ISerializer &serializer)
   }
 
   serializer(paymentId, "paymentId");
+  serializer(limit, "limit");
+  serializer(cursor, "cursor");
 }
 
 void GetTransactions::Response::serialize(cn::ISerializer &serializer)
 {
   serializer(items, "items");
+  serializer(nextCursor, "nextCursor");
 }
 
 void GetUnconfirmedTransactionHashes::Request::serialize(cn::ISerializer &serializer)
@@ -335,6 +335,9 @@ struct GetTransactionHashes
     uint32_t firstBlockIndex = std::numeric_limits<uint32_t>::max();
     uint32_t blockCount;
     std::string paymentId;
+    // a limit or cursor asks for pages of matching transactions only
+    uint32_t limit = 0;
+    std::string cursor;
 
     void serialize(cn::ISerializer &serializer);
   };
@@ -342,6 +345,7 @@ struct GetTransactionHashes
   struct Response
   {
     std::vector<TransactionHashesInBlockRpcInfo> items;
+    std::string nextCursor;
 
     void serialize(cn::ISerializer &serializer);
   };
@@ -446,6 +450,9 @@ struct GetTransactions
     uint32_t firstBlockIndex = std::numeric_limits<uint32_t>::max();
     uint32_t blockCount;
     std::string paymentId;
+    // a limit or cursor asks for pages of matching transactions only
+    uint32_t limit = 0;
+    std::string cursor;
 
     void serialize(cn::ISerializer &serializer);
   };
@@ -453,6 +460,7 @@ struct GetTransactions
   struct Response
   {
     std::vector<TransactionsInBlockRpcInfo> items;
+    std::string nextCursor;
 
     void serialize(cn::ISerializer &serializer);
   };
@@ -186,7 +186,9 @@ std::error_code PaymentServiceJsonRpcServer::handleGetBlockHashes(const GetBlock
 }
 
 std::error_code PaymentServiceJsonRpcServer::handleGetTransactionHashes(const GetTransactionHashes::Request& request, GetTransactionHashes::Response& response) {
-  if (!request.blockHash.empty()) {
+  if (request.limit != 0 || !request.cursor.empty()) {
+    return service.getTransactionHashes(request, response);
+  } else if (!request.blockHash.empty()) {
     return service.getTransactionHashes(request.addresses, request.blockHash, request.blockCount, request.paymentId, response.items);
   } else {
     return service.getTransactionHashes(request.addresses, request.firstBlockIndex, request.blockCount, request.paymentId, response.items);
@@ -194,7 +196,9 @@ std::error_code PaymentServiceJsonRpcServer::handleGetTransactionHashes(const Ge
 }
 
 std::error_code PaymentServiceJsonRpcServer::handleGetTransactions(const GetTransactions::Request& request, GetTransactions::Response& response) {
-  if (!request.blockHash.empty()) {
+  if (request.limit != 0 || !request.cursor.empty()) {
+    return service.getTransactions(request, response);
+  } else if (!request.blockHash.empty()) {
     return service.getTransactions(request.addresses, request.blockHash, request.blockCount, request.paymentId, response.items);
   } else {
     return service.getTransactions(request.addresses, request.firstBlockIndex, request.blockCount, request.paymentId, response.items);
@@ -260,6 +260,41 @@ namespace payment_service
       return hash;
     }
 
+    std::string formatTransactionCursor(const cn::WalletTransactionCursor &cursor)
+    {
+      return std::to_string(cursor.blockIndex) + ":" + std::to_string(cursor.transactionId);
+    }
+
+    cn::WalletTransactionCursor parseTransactionCursor(const std::string &cursorString, const logging::LoggerRef& logger)
+    {
+      cn::WalletTransactionCursor cursor;
+      if (cursorString.empty())
+      {
+        return cursor;
+      }
+
+      std::istringstream stream(cursorString);
+      char separator = 0;
+      if (!(stream >> cursor.blockIndex >> separator >> cursor.transactionId) || separator != ':' || !stream.eof())
+      {
+        logger(logging::WARNING) << "Can't parse transaction cursor " << cursorString;
+        throw std::system_error(make_error_code(cn::error::WRONG_PARAMETERS), "Invalid cursor");
+      }
+
+      return cursor;
+    }
+
+    size_t countTransactions(const std::vector<cn::TransactionsInBlockInfo> &blocks)
+    {
+      size_t count = 0;
+      for (const auto &block : blocks)
+      {
+        count += block.transactions.size();
+      }
+
+      return count;
+    }
+
     std::vector<cn::TransactionsInBlockInfo> filterTransactions(
         const std::vector<cn::TransactionsInBlockInfo> &blocks,
         const TransactionsInBlockInfoFilter &filter)
@@ -994,6 +1029,67 @@ namespace payment_service
     return std::error_code();
   }
 
+  std::error_code WalletService::getTransactionHashes(const GetTransactionHashes::Request &request, GetTransactionHashes::Response &response)
+  {
+    try
+    {
+      platform_system::EventLock lk(readyEvent);
+      validateAddresses(request.addresses, currency, logger);
+
+      if (!request.paymentId.empty())
+      {
+        validatePaymentId(request.paymentId, logger);
+      }
+
+      std::vector<cn::TransactionsInBlockInfo> blocks = getTransactionPage(request.addresses, request.blockHash, request.firstBlockIndex, request.blockCount,
+                                                                           request.paymentId, request.limit, request.cursor, response.nextCursor);
+      response.items = convertTransactionsInBlockInfoToTransactionHashesInBlockRpcInfo(blocks);
+    }
+    catch (std::system_error &x)
+    {
+      logger(logging::WARNING) << "Error while getting transactions: " << x.what();
+      return x.code();
+    }
+    catch (std::exception &x)
+    {
+      logger(logging::WARNING) << "Error while getting transactions: " << x.what();
+      return make_error_code(cn::error::INTERNAL_WALLET_ERROR);
+    }
+
+    return std::error_code();
+  }
+
+  std::error_code WalletService::getTransactions(const GetTransactions::Request &request, GetTransactions::Response &response)
+  {
+    try
+    {
+      platform_system::EventLock lk(readyEvent);
+      validateAddresses(request.addresses, currency, logger);
+
+      if (!request.paymentId.empty())
+      {
+        validatePaymentId(request.paymentId, logger);
+      }
+
+      uint32_t knownBlockCount = node.getKnownBlockCount();
+      std::vector<cn::TransactionsInBlockInfo> blocks = getTransactionPage(request.addresses, request.blockHash, request.firstBlockIndex, request.blockCount,
+                                                                           request.paymentId, request.limit, request.cursor, response.nextCursor);
+      response.items = convertTransactionsInBlockInfoToTransactionsInBlockRpcInfo(blocks, knownBlockCount);
+    }
+    catch (std::system_error &x)
+    {
+      logger(logging::WARNING) << "Error while getting transactions: " << x.what();
+      return x.code();
+    }
+    catch (std::exception &x)
+    {
+      logger(logging::WARNING) << "Error while getting transactions: " << x.what();
+      return make_error_code(cn::error::INTERNAL_WALLET_ERROR);
+    }
+
+    return std::error_code();
+  }
+
   std::error_code WalletService::getDeposit(uint64_t depositId, uint64_t &amount, uint64_t &term, uint64_t &interest, std::string &creatingTransactionHash, std::string &spendingTransactionHash, bool &locked, uint64_t &height, uint64_t &unlockHeight, std::string &address)
   {
     try
@@ -1932,6 +2028,42 @@ namespace payment_service
       return convertTransactionsInBlockInfoToTransactionsInBlockRpcInfo(filteredTransactions, knownBlockCount);
     }
 
+    std::vector<cn::TransactionsInBlockInfo> WalletService::getTransactionPage(const std::vector<std::string> &addresses, const std::string &blockHash, uint32_t firstBlockIndex,
+                                                                               uint32_t blockCount, const std::string &paymentId, uint32_t limit, const std::string &cursor, std::string &nextCursor) const
+    {
+      cn::WalletTransactionFilter filter;
+      filter.addresses = addresses;
+      if (!paymentId.empty())
+      {
+        filter.paymentId = parsePaymentId(paymentId);
+      }
+
+      if (limit != 0)
+      {
+        filter.limit = limit;
+      }
+
+      cn::WalletTransactionCursor walletCursor = parseTransactionCursor(cursor, logger);
+      std::vector<cn::TransactionsInBlockInfo> result;
+      if (!blockHash.empty())
+      {
+        result = wallet.getTransactions(parseHash(blockHash, logger), blockCount, filter, walletCursor);
+      }
+      else
+      {
+        result = wallet.getTransactions(firstBlockIndex, blockCount, filter, walletCursor);
+      }
+
+      // a short page means the range is exhausted
+      nextCursor.clear();
+      if (limit != 0 && countTransactions(result) == limit)
+      {
+        nextCursor = formatTransactionCursor(walletCursor);
+      }
+
+      return result;
+    }
+
     TransactionRpcInfo WalletService::convertTransactionWithTransfersToTransactionRpcInfo(const cn::WalletTransactionWithTransfers &transactionWithTransfers, const uint32_t &knownBlockCount) const
     {
       TransactionRpcInfo transactionInfo;
@@ -75,6 +75,8 @@ std::error_code getViewKey(std::string &viewSecretKey);
                                   uint32_t blockCount, const std::string &paymentId, std::vector<TransactionsInBlockRpcInfo> &transactionHashes);
   std::error_code getTransactions(const std::vector<std::string> &addresses, uint32_t firstBlockIndex,
                                   uint32_t blockCount, const std::string &paymentId, std::vector<TransactionsInBlockRpcInfo> &transactionHashes);
+  std::error_code getTransactionHashes(const GetTransactionHashes::Request &request, GetTransactionHashes::Response &response);
+  std::error_code getTransactions(const GetTransactions::Request &request, GetTransactions::Response &response);
   std::error_code getTransaction(const std::string &transactionHash, TransactionRpcInfo &transaction);
   std::error_code getAddresses(std::vector<std::string> &addresses);
   std::error_code sendTransaction(const SendTransaction::Request &request, std::string &transactionHash, std::string &transactionSecretKey);
@@ -117,6 +119,9 @@ private:
   std::vector<TransactionsInBlockRpcInfo> getRpcTransactions(const crypto::Hash &blockHash, size_t blockCount, const TransactionsInBlockInfoFilter &filter) const;
   std::vector<TransactionsInBlockRpcInfo> getRpcTransactions(uint32_t firstBlockIndex, size_t blockCount, const TransactionsInBlockInfoFilter &filter) const;
 
+  std::vector<cn::TransactionsInBlockInfo> getTransactionPage(const std::vector<std::string> &addresses, const std::string &blockHash, uint32_t firstBlockIndex,
+                                                              uint32_t blockCount, const std::string &paymentId, uint32_t limit, const std::string &cursor, std::string &nextCursor) const;
+
   TransactionRpcInfo convertTransactionWithTransfersToTransactionRpcInfo(
       const cn::WalletTransactionWithTransfers &transactionWithTransfers, const uint32_t &knownBlockCount) const;
   std::vector<TransactionsInBlockRpcInfo> convertTransactionsInBlockInfoToTransactionsInBlockRpcInfo(
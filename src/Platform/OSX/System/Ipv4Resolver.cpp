@@ -7,11 +7,14 @@
 
 #include "Ipv4Resolver.h"
 #include <cassert>
+#include <chrono>
 #include <random>
 #include <stdexcept>
+#include <vector>
 
 #include <netdb.h>
 
+#include <System/AsyncResolver.h>
 #include <System/Dispatcher.h>
 #include <System/ErrorMessage.h>
 #include <System/InterruptedException.h>
@@ -19,6 +22,31 @@
 
 namespace platform_system {
 
+namespace {
+
+// getaddrinfo doesn't report record TTLs, so resolved addresses are kept for a fixed time.
+const std::chrono::seconds RESOLVER_CACHE_TTL(300);
+
+// Runs on the resolver's helper thread.
+std::vector<std::string> lookupAddresses(const std::string& host) {
+  addrinfo hints = { 0, AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, NULL, NULL, NULL };
+  addrinfo* addressInfos;
+  int result = getaddrinfo(host.c_str(), NULL, &hints, &addressInfos);
+  if (result != 0) {
+    throw std::runtime_error("Ipv4Resolver::resolve, getaddrinfo failed, " + errorMessage(result));
+  }
+
+  std::vector<std::string> addresses;
+  for (addrinfo* addressInfo = addressInfos; addressInfo != nullptr; addressInfo = addressInfo->ai_next) {
+    addresses.push_back(Ipv4Address(ntohl(reinterpret_cast<sockaddr_in*>(addressInfo->ai_addr)->sin_addr.s_addr)).toDottedDecimal());
+  }
+
+  freeaddrinfo(addressInfos);
+  return addresses;
+}
+
+}
+
 Ipv4Resolver::Ipv4Resolver() : dispatcher(nullptr) {
 }
 
@@ -45,32 +73,14 @@ Ipv4Resolver& Ipv4Resolver::operator=(Ipv4Resolver&& other) {
 
 Ipv4Address Ipv4Resolver::resolve(const std::string& host) {
   assert(dispatcher != nullptr);
-  if (dispatcher->interrupted()) {
-    throw InterruptedException();
-  }
-
-  addrinfo hints = { 0, AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, NULL, NULL, NULL };
-  addrinfo* addressInfos;
-  int result = getaddrinfo(host.c_str(), NULL, &hints, &addressInfos);
-  if (result != 0) {
-    throw std::runtime_error("Ipv4Resolver::resolve, getaddrinfo failed, " + errorMessage(result));
-  }
-  
-  std::size_t count = 0;
-  for (addrinfo* addressInfo = addressInfos; addressInfo != nullptr; addressInfo = addressInfo->ai_next) {
-    ++count;
+  std::vector<std::string> addresses = AsyncResolver(*dispatcher, "A", lookupAddresses, RESOLVER_CACHE_TTL).resolve(host);
+  if (addresses.empty()) {
+    throw std::runtime_error("Ipv4Resolver::resolve, no addresses found for " + host);
   }
 
   std::mt19937 generator{ std::random_device()() };
-  std::size_t index = std::uniform_int_distribution<std::size_t>(0, count - 1)(generator);
-  addrinfo* addressInfo = addressInfos;
-  for (std::size_t i = 0; i < index; ++i) {
-    addressInfo = addressInfo->ai_next;
-  }
-
-  Ipv4Address address(ntohl(reinterpret_cast<sockaddr_in*>(addressInfo->ai_addr)->sin_addr.s_addr));
-  freeaddrinfo(addressInfo);
-  return address;
+  std::size_t index = std::uniform_int_distribution<std::size_t>(0, addresses.size() - 1)(generator);
+  return Ipv4Address(addresses[index]);
 }
 
 }
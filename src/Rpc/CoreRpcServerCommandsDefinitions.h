@@ -285,6 +285,47 @@ struct COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_JSON {
   using outs_for_amount = COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_outs_for_amount_json;
 };
 
+//-----------------------------------------------
+struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_amount_count {
+  uint64_t amount;
+  uint64_t count;
+
+  void serialize(ISerializer &s) {
+    KV_MEMBER(amount)
+    KV_MEMBER(count)
+  }
+};
+
+struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request {
+  std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_amount_count> amounts;
+
+  void serialize(ISerializer &s) {
+    KV_MEMBER(amounts)
+  }
+};
+
+struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response {
+  std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_outs_for_amount> outs;
+  uint32_t height;
+  std::string status;
+
+  void serialize(ISerializer &s) {
+    KV_MEMBER(outs)
+    KV_MEMBER(height)
+    KV_MEMBER(status)
+  }
+};
+
+// Per-amount output counts in one request, picked against a single chain height
+struct COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK {
+  using request = COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request;
+  using response = COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response;
+
+  using amount_count = COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_amount_count;
+  using out_entry = COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_out_entry;
+  using outs_for_amount = COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_outs_for_amount;
+};
+
 //-----------------------------------------------
 struct COMMAND_RPC_SEND_RAW_TX {
   struct request {
@@ -23,7 +23,7 @@
 #include <HTTP/HttpRequest.h>
 #include <HTTP/HttpResponse.h>
 #include <System/TcpConnection.h>
-#include <System/TcpStream.h>
+#include "HttpConnection.h"
 #include "JsonRpc.h"
 
 #include "Serialization/SerializationTools.h"
@@ -54,7 +54,7 @@ private:
   bool m_connected = false;
   platform_system::Dispatcher& m_dispatcher;
   platform_system::TcpConnection m_connection;
-  std::unique_ptr<platform_system::TcpStreambuf> m_streamBuf;
+  std::unique_ptr<HttpConnection> m_httpConnection;
 };
 
 template <typename Request, typename Response>
@@ -0,0 +1,117 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "HttpConnection.h"
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+#include <HTTP/HttpParserErrorCodes.h>
+#include <System/TcpConnection.h>
+
+namespace cn {
+
+namespace {
+
+const size_t READ_SIZE = 16 * 1024;
+// Content-Length is only trusted this far ahead of the data actually received
+const size_t MAX_PREALLOCATION = 16 * 1024 * 1024;
+const size_t MAX_IDLE_BUFFER_SIZE = 1024 * 1024;
+// Smaller bodies are sent in the same write as the headers
+const size_t INLINE_BODY_SIZE = 16 * 1024;
+
+}
+
+HttpConnection::HttpConnection(platform_system::TcpConnection& connection) :
+  m_connection(connection), m_begin(0), m_end(0) {
+}
+
+bool HttpConnection::receiveRequest(HttpRequest& request) {
+  return receive(request, [this](const char* data, size_t size, HttpRequest& message) {
+    return m_parser.parseRequest(data, size, message);
+  });
+}
+
+void HttpConnection::receiveResponse(HttpResponse& response) {
+  bool received = receive(response, [this](const char* data, size_t size, HttpResponse& message) {
+    return m_parser.parseResponse(data, size, message);
+  });
+
+  if (!received) {
+    throw std::system_error(make_error_code(cn::error::HttpParserErrorCodes::END_OF_STREAM));
+  }
+}
+
+void HttpConnection::send(const HttpRequest& request) {
+  sendMessage(request.getHeaderBlock(), request.getBody());
+}
+
+void HttpConnection::send(const HttpResponse& response) {
+  sendMessage(response.getHeaderBlock(), response.getBody());
+}
+
+template <typename Message, typename Parse>
+bool HttpConnection::receive(Message& message, Parse parse) {
+  for (;;) {
+    if (m_end != m_begin) {
+      size_t messageSize = parse(m_buffer.data() + m_begin, m_end - m_begin, message);
+      if (messageSize != 0) {
+        m_begin += messageSize;
+        if (m_begin == m_end) {
+          m_begin = 0;
+          m_end = 0;
+          if (m_buffer.size() > MAX_IDLE_BUFFER_SIZE) {
+            std::vector<char>().swap(m_buffer);
+          }
+        }
+
+        return true;
+      }
+    }
+
+    // the parser keeps offsets relative to the start of the message, so it can be moved
+    if (m_begin != 0) {
+      std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+      m_end -= m_begin;
+      m_begin = 0;
+    }
+
+    size_t wanted = std::max(m_end + READ_SIZE, std::min(m_parser.expectedSize(), m_end + MAX_PREALLOCATION));
+    if (m_buffer.size() < wanted) {
+      m_buffer.resize(wanted);
+    }
+
+    size_t readSize = m_connection.read(reinterpret_cast<uint8_t*>(m_buffer.data() + m_end), m_buffer.size() - m_end);
+    if (readSize == 0) {
+      if (m_end == 0) {
+        return false;
+      }
+
+      throw std::system_error(make_error_code(cn::error::HttpParserErrorCodes::END_OF_STREAM));
+    }
+
+    m_end += readSize;
+  }
+}
+
+void HttpConnection::sendMessage(std::string&& header, const std::string& body) {
+  if (body.size() <= INLINE_BODY_SIZE) {
+    header.append(body);
+    writeStrict(header.data(), header.size());
+  } else {
+    writeStrict(header.data(), header.size());
+    writeStrict(body.data(), body.size());
+  }
+}
+
+void HttpConnection::writeStrict(const char* data, size_t size) {
+  size_t offset = 0;
+  while (offset < size) {
+    offset += m_connection.write(reinterpret_cast<const uint8_t*>(data) + offset, size - offset);
+  }
+}
+
+}
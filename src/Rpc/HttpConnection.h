@@ -0,0 +1,48 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <HTTP/HttpParser.h>
+#include <HTTP/HttpRequest.h>
+#include <HTTP/HttpResponse.h>
+
+namespace platform_system {
+class TcpConnection;
+}
+
+namespace cn {
+
+// HTTP/1.1 message exchange over a TCP connection. Messages are parsed in
+// place in a read buffer owned by the connection, which also keeps any
+// pipelined bytes for the next message.
+class HttpConnection {
+public:
+  explicit HttpConnection(platform_system::TcpConnection& connection);
+
+  // Returns false if the peer closed the connection instead of sending a request
+  bool receiveRequest(HttpRequest& request);
+  void receiveResponse(HttpResponse& response);
+
+  void send(const HttpRequest& request);
+  void send(const HttpResponse& response);
+
+private:
+  template <typename Message, typename Parse>
+  bool receive(Message& message, Parse parse);
+  void sendMessage(std::string&& header, const std::string& body);
+  void writeStrict(const char* data, size_t size);
+
+  platform_system::TcpConnection& m_connection;
+  HttpParser m_parser;
+  std::vector<char> m_buffer;
+  size_t m_begin;
+  size_t m_end;
+};
+
+}
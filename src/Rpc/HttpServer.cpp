@@ -21,10 +21,9 @@
 #include <boost/scope_exit.hpp>
 
 #include <Common/Base64.h>
-#include <HTTP/HttpParser.h>
 #include <System/InterruptedException.h>
-#include <System/TcpStream.h>
 #include <System/Ipv4Address.h>
+#include "HttpConnection.h"
 
 using namespace logging;
 
@@ -90,9 +89,7 @@ void HttpServer::acceptLoop() {
 
     logger(DEBUGGING) << "Incoming connection from " << addr.first.toDottedDecimal() << ":" << addr.second;
 
-    platform_system::TcpStreambuf streambuf(connection);
-    std::iostream stream(&streambuf);
-    HttpParser parser;
+    HttpConnection httpConnection(connection);
 
     for (;;) {
       HttpRequest req;
@@ -100,7 +97,10 @@ void HttpServer::acceptLoop() {
 	  resp.addHeader("Access-Control-Allow-Origin", "*");
 	  resp.addHeader("Content-Type", "application/json");
 	
-      parser.receiveRequest(stream, req);
+      if (!httpConnection.receiveRequest(req)) {
+        break;
+      }
+
 				if (authenticate(req)) {
 					processRequest(req, resp);
 				}
@@ -109,12 +109,7 @@ void HttpServer::acceptLoop() {
 					fillUnauthorizedResponse(resp);
 				}
 
-      stream << resp;
-      stream.flush();
-
-      if (stream.peek() == std::iostream::traits_type::eof()) {
-        break;
-      }
+      httpConnection.send(resp);
     }
 
     logger(DEBUGGING) << "Closing connection from " << addr.first.toDottedDecimal() << ":" << addr.second << " total=" << m_connections.size();
@@ -14,6 +14,7 @@
 #include "BlockchainExplorerData.h"
 #include "Common/StringTools.h"
 #include "Common/Base58.h"
+#include "Common/Metrics.h"
 #include "CryptoNoteCore/TransactionUtils.h"
 #include "CryptoNoteCore/CryptoNoteTools.h"
 #include "CryptoNoteCore/CryptoNoteFormatUtils.h"
@@ -94,6 +95,7 @@ std::unordered_map<std::string, RpcServer::RpcHandler<RpcServer::HandlerFunction
   { "/queryblockslite.bin", { binMethod<COMMAND_RPC_QUERY_BLOCKS_LITE>(&RpcServer::on_query_blocks_lite), false } },
   { "/get_o_indexes.bin", { binMethod<COMMAND_RPC_GET_TX_GLOBAL_OUTPUTS_INDEXES>(&RpcServer::on_get_indexes), false } },
   { "/getrandom_outs.bin", { binMethod<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS>(&RpcServer::on_get_random_outs_bin), false } },
+  { "/getrandom_outs_bulk.bin", { binMethod<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK>(&RpcServer::on_get_random_outs_bulk), false } },
   { "/get_pool_changes.bin", { binMethod<COMMAND_RPC_GET_POOL_CHANGES>(&RpcServer::onGetPoolChanges), false } },
   { "/get_pool_changes_lite.bin", { binMethod<COMMAND_RPC_GET_POOL_CHANGES_LITE>(&RpcServer::onGetPoolChangesLite), false } },
 
@@ -110,11 +112,18 @@ std::unordered_map<std::string, RpcServer::RpcHandler<RpcServer::HandlerFunction
   { "/getrandom_outs", { jsonMethod<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_JSON>(&RpcServer::on_get_random_outs_json), false } },
 
   // json rpc
-  { "/json_rpc", { std::bind(&RpcServer::processJsonRpcRequest, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3), true } }
+  { "/json_rpc", { std::bind(&RpcServer::processJsonRpcRequest, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3), true } },
+
+  // prometheus
+  { "/metrics", { std::bind(&RpcServer::on_get_metrics, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3), true } }
 };
 
 RpcServer::RpcServer(platform_system::Dispatcher& dispatcher, logging::ILogger& log, core& c, NodeServer& p2p, const ICryptoNoteProtocolQuery& protocolQuery) :
   HttpServer(dispatcher, log), logger(log, "RpcServer"), m_core(c), m_p2p(p2p), m_protocolQuery(protocolQuery) {
+  for (const auto& handler : s_handlers) {
+    m_routeLatency[handler.first] = &common::MetricsRegistry::instance().histogram(
+      "conceal_rpc_request_seconds", "Time spent serving RPC requests by route", common::metricLabel("route", handler.first));
+  }
 }
 
 void RpcServer::processRequest(const HttpRequest& request, HttpResponse& response) {
@@ -132,9 +141,16 @@ void RpcServer::processRequest(const HttpRequest& request, HttpResponse& respons
     return;
   }
 
+  common::MetricTimer timer(*m_routeLatency.at(url));
   it->second.handler(this, request, response);
 }
 
+bool RpcServer::on_get_metrics(const HttpRequest& request, HttpResponse& response) {
+  response.addHeader("Content-Type", "text/plain; version=0.0.4");
+  response.setBody(common::MetricsRegistry::instance().toPrometheus());
+  return true;
+}
+
 bool RpcServer::processJsonRpcRequest(const HttpRequest& request, HttpResponse& response) {
 
   using namespace JsonRpc;
@@ -186,6 +202,16 @@ bool RpcServer::processJsonRpcRequest(const HttpRequest& request, HttpResponse&
       throw JsonRpcError(CORE_RPC_ERROR_CODE_CORE_BUSY, "Core is busy");
     }
 
+    static std::unordered_map<std::string, common::MetricHistogram*> jsonRpcLatency = [] {
+      std::unordered_map<std::string, common::MetricHistogram*> latency;
+      for (const auto& handler : jsonRpcHandlers) {
+        latency[handler.first] = &common::MetricsRegistry::instance().histogram(
+          "conceal_json_rpc_request_seconds", "Time spent serving JSON-RPC requests by method", common::metricLabel("method", handler.first));
+      }
+      return latency;
+    }();
+
+    common::MetricTimer timer(*jsonRpcLatency.at(it->first));
     it->second.handler(this, jsonRequest, jsonResponse);
 
   } catch (const JsonRpcError& err) {
@@ -895,6 +921,27 @@ bool RpcServer::on_get_random_outs_bin(const COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_
   return true;
 }
 
+bool RpcServer::on_get_random_outs_bulk(const COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::request& req, COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::response& res) {
+  res.status = "Failed";
+
+  uint64_t totalCount = 0;
+  for (const auto& amountCount : req.amounts) {
+    totalCount += std::min<uint64_t>(amountCount.count, COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_MAX_COUNT);
+  }
+
+  if (totalCount > COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_MAX_COUNT) {
+    res.status = "Requested outputs count: " + std::to_string(totalCount) + " exceeded max limit of " + std::to_string(COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_MAX_COUNT);
+    return true;
+  }
+
+  if (!m_core.get_random_outs_bulk(req, res)) {
+    return true;
+  }
+
+  res.status = CORE_RPC_STATUS_OK;
+  return true;
+}
+
 bool RpcServer::on_get_random_outs_json(const COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_JSON::request& req, COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_JSON::response& res) {
   res.status = "Failed";
   
@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <Common/StreamTools.h>
 #include "SerializationOverloads.h"
@@ -20,11 +22,56 @@ namespace cn {
 
 namespace {
 
-template<typename StorageType, typename T>
-void readVarintAs(IInputStream& s, T &i) {
-  i = static_cast<T>(readVarint<StorageType>(s));
+// Same checks as common::readVarint, over a buffer instead of a stream
+template<typename T>
+T decodeVarint(const uint8_t*& begin, const uint8_t* end) {
+  const int bits = std::numeric_limits<T>::digits;
+  T value = 0;
+  for (int shift = 0;; shift += 7) {
+    if (begin == end) {
+      throw std::runtime_error("Reading from IInputStream failed");
+    }
+
+    uint8_t piece = *begin++;
+    if (shift >= bits - 7 && piece >= 1 << (bits - shift)) {
+      throw std::runtime_error("readVarint, value overflow");
+    }
+
+    value |= static_cast<T>(piece & 0x7f) << shift;
+    if ((piece & 0x80) == 0) {
+      if (piece == 0 && shift != 0) {
+        throw std::runtime_error("readVarint, unrepresentable value");
+      }
+
+      return value;
+    }
+  }
+}
+
 }
 
+BinaryInputStreamSerializer::BinaryInputStreamSerializer(common::IInputStream& strm) :
+  stream(strm), memoryStream(dynamic_cast<common::MemoryInputStream*>(&strm)) {
+}
+
+template<typename T>
+void BinaryInputStreamSerializer::readVarintValue(T& value) {
+  if (memoryStream == nullptr) {
+    readVarint(stream, value);
+    return;
+  }
+
+  const uint8_t* begin = reinterpret_cast<const uint8_t*>(memoryStream->current());
+  const uint8_t* position = begin;
+  // single byte values (counts, tags, small amounts) are the common case
+  if (memoryStream->remaining() != 0 && *position < 0x80) {
+    value = *position;
+    memoryStream->advance(1);
+    return;
+  }
+
+  value = decodeVarint<T>(position, begin + memoryStream->remaining());
+  memoryStream->advance(position - begin);
 }
 
 ISerializer::SerializerType BinaryInputStreamSerializer::type() const {
@@ -39,7 +86,9 @@ void BinaryInputStreamSerializer::endObject() {
 }
 
 bool BinaryInputStreamSerializer::beginArray(size_t& size, common::StringView name) {
-  readVarintAs<uint64_t>(stream, size);
+  uint64_t arraySize;
+  readVarintValue(arraySize);
+  size = static_cast<size_t>(arraySize);
 
   if (size > 128*1024*1024) {
     throw std::runtime_error("array size is too big");
@@ -52,57 +101,69 @@ void BinaryInputStreamSerializer::endArray() {
 }
 
 bool BinaryInputStreamSerializer::operator()(uint8_t& value, common::StringView name) {
-  readVarint(stream, value);
+  readVarintValue(value);
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(uint16_t& value, common::StringView name) {
-  readVarint(stream, value);
+  readVarintValue(value);
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(int16_t& value, common::StringView name) {
-  readVarintAs<uint16_t>(stream, value);
+  uint16_t storedValue;
+  readVarintValue(storedValue);
+  value = static_cast<int16_t>(storedValue);
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(uint32_t& value, common::StringView name) {
-  readVarint(stream, value);
+  readVarintValue(value);
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(int32_t& value, common::StringView name) {
-  readVarintAs<uint32_t>(stream, value);
+  uint32_t storedValue;
+  readVarintValue(storedValue);
+  value = static_cast<int32_t>(storedValue);
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(int64_t& value, common::StringView name) {
-  readVarintAs<uint64_t>(stream, value);
+  uint64_t storedValue;
+  readVarintValue(storedValue);
+  value = static_cast<int64_t>(storedValue);
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(uint64_t& value, common::StringView name) {
-  readVarint(stream, value);
+  readVarintValue(value);
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(bool& value, common::StringView name) {
-  value = read<uint8_t>(stream) != 0;
+  uint8_t boolValue;
+  checkedRead(reinterpret_cast<char*>(&boolValue), sizeof(boolValue));
+  value = boolValue != 0;
   return true;
 }
 
 bool BinaryInputStreamSerializer::operator()(std::string& value, common::StringView name) {
   uint64_t size;
-  readVarint(stream, size);
+  readVarintValue(size);
 
   if (size > 128*1024*1024) {
     throw std::runtime_error("string size is too big");
+  } else if (memoryStream != nullptr) {
+    if (size > memoryStream->remaining()) {
+      throw std::runtime_error("Reading from IInputStream failed");
+    }
+
+    value.assign(memoryStream->current(), size);
+    memoryStream->advance(size);
   } else if (size > 0) {
-    std::vector<char> temp;
-    temp.resize(size);
-    checkedRead(&temp[0], size);
-    value.reserve(size);
-    value.assign(&temp[0], size);
+    value.resize(size);
+    checkedRead(&value[0], size);
   } else {
     value.clear();
   }
@@ -126,7 +187,17 @@ bool BinaryInputStreamSerializer::operator()(double& value, common::StringView n
 }
 
 void BinaryInputStreamSerializer::checkedRead(char* buf, size_t size) {
-  read(stream, buf, size);
+  if (memoryStream == nullptr) {
+    read(stream, buf, size);
+    return;
+  }
+
+  if (size > memoryStream->remaining()) {
+    throw std::runtime_error("Reading from IInputStream failed");
+  }
+
+  memcpy(buf, memoryStream->current(), size);
+  memoryStream->advance(size);
 }
 
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Common/IInputStream.h>
+#include <Common/MemoryInputStream.h>
 #include "ISerializer.h"
 #include "SerializationOverloads.h"
 
@@ -15,7 +16,7 @@ namespace cn {
 
 class BinaryInputStreamSerializer : public ISerializer {
 public:
-  BinaryInputStreamSerializer(common::IInputStream& strm) : stream(strm) {}
+  BinaryInputStreamSerializer(common::IInputStream& strm);
   virtual ~BinaryInputStreamSerializer() {}
 
   virtual ISerializer::SerializerType type() const override;
@@ -45,9 +46,13 @@ public:
   }
 
 private:
-
+  template<typename T>
+  void readVarintValue(T& value);
   void checkedRead(char* buf, size_t size);
+
   common::IInputStream& stream;
+  // Set when reading from memory, which is decoded in place without virtual calls per byte
+  common::MemoryInputStream* memoryStream;
 };
 
 }
@@ -15,6 +15,23 @@ using namespace common;
 
 namespace cn {
 
+namespace {
+
+// Encodes into a local buffer so that a varint costs one stream write instead of one per byte
+void writeVarintValue(IOutputStream& out, uint64_t value) {
+  uint8_t buffer[(sizeof(value) * 8 + 6) / 7];
+  size_t size = 0;
+  while (value >= 0x80) {
+    buffer[size++] = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+
+  buffer[size++] = static_cast<uint8_t>(value);
+  write(out, buffer, size);
+}
+
+}
+
 ISerializer::SerializerType BinaryOutputStreamSerializer::type() const {
   return ISerializer::OUTPUT;
 }
@@ -27,7 +44,7 @@ void BinaryOutputStreamSerializer::endObject() {
 }
 
 bool BinaryOutputStreamSerializer::beginArray(size_t& size, common::StringView name) {
-  writeVarint(stream, size);
+  writeVarintValue(stream, size);
   return true;
 }
 
@@ -35,37 +52,37 @@ void BinaryOutputStreamSerializer::endArray() {
 }
 
 bool BinaryOutputStreamSerializer::operator()(uint8_t& value, common::StringView name) {
-  writeVarint(stream, value);
+  writeVarintValue(stream, value);
   return true;
 }
 
 bool BinaryOutputStreamSerializer::operator()(uint16_t& value, common::StringView name) {
-  writeVarint(stream, value);
+  writeVarintValue(stream, value);
   return true;
 }
 
 bool BinaryOutputStreamSerializer::operator()(int16_t& value, common::StringView name) {
-  writeVarint(stream, static_cast<uint16_t>(value));
+  writeVarintValue(stream, static_cast<uint16_t>(value));
   return true;
 }
 
 bool BinaryOutputStreamSerializer::operator()(uint32_t& value, common::StringView name) {
-  writeVarint(stream, value);
+  writeVarintValue(stream, value);
   return true;
 }
 
 bool BinaryOutputStreamSerializer::operator()(int32_t& value, common::StringView name) {
-  writeVarint(stream, static_cast<uint32_t>(value));
+  writeVarintValue(stream, static_cast<uint32_t>(value));
   return true;
 }
 
 bool BinaryOutputStreamSerializer::operator()(int64_t& value, common::StringView name) {
-  writeVarint(stream, static_cast<uint64_t>(value));
+  writeVarintValue(stream, static_cast<uint64_t>(value));
   return true;
 }
 
 bool BinaryOutputStreamSerializer::operator()(uint64_t& value, common::StringView name) {
-  writeVarint(stream, value);
+  writeVarintValue(stream, value);
   return true;
 }
 
@@ -76,7 +93,7 @@ bool BinaryOutputStreamSerializer::operator()(bool& value, common::StringView na
 }
 
 bool BinaryOutputStreamSerializer::operator()(std::string& value, common::StringView name) {
-  writeVarint(stream, value.size());
+  writeVarintValue(stream, value.size());
   checkedWrite(value.data(), value.size());
   return true;
 }
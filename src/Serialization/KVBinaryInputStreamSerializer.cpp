@@ -11,7 +11,6 @@
 #include <cassert>
 #include <cstring>
 #include <stdexcept>
-#include <Common/StreamTools.h>
 #include "KVBinaryCommon.h"
 
 using namespace common;
@@ -19,27 +18,92 @@ using namespace cn;
 
 namespace {
 
+const size_t READ_CHUNK_SIZE = 64 * 1024;
+const size_t MAX_NESTING_LEVEL = 100;
+
+// size of the values stored inline, 0 for variable length types
+size_t fixedValueSize(uint8_t type) {
+  switch (type) {
+  case BIN_KV_SERIALIZE_TYPE_INT64:
+  case BIN_KV_SERIALIZE_TYPE_UINT64:
+  case BIN_KV_SERIALIZE_TYPE_DOUBLE:
+    return 8;
+  case BIN_KV_SERIALIZE_TYPE_INT32:
+  case BIN_KV_SERIALIZE_TYPE_UINT32:
+    return 4;
+  case BIN_KV_SERIALIZE_TYPE_INT16:
+  case BIN_KV_SERIALIZE_TYPE_UINT16:
+    return 2;
+  case BIN_KV_SERIALIZE_TYPE_INT8:
+  case BIN_KV_SERIALIZE_TYPE_UINT8:
+  case BIN_KV_SERIALIZE_TYPE_BOOL:
+    return 1;
+  default:
+    return 0;
+  }
+}
+
 template <typename T>
-T readPod(common::IInputStream& s) {
+T readPod(const uint8_t* data) {
   T v;
-  read(s, &v, sizeof(T));
+  memcpy(&v, data, sizeof(T));
   return v;
 }
 
-template <typename T, typename JsonT = T>
-JsonValue readPodJson(common::IInputStream& s) {
-  JsonValue jv;
-  jv = static_cast<JsonT>(readPod<T>(s));
-  return jv;
 }
 
-template <typename T>
-JsonValue readIntegerJson(common::IInputStream& s) {
-  return readPodJson<T, int64_t>(s);
+KVBinaryInputStreamSerializer::KVBinaryInputStreamSerializer(common::IInputStream& strm) {
+  size_t size = 0;
+  for (;;) {
+    m_buffer.resize(size + READ_CHUNK_SIZE);
+    size_t readSize = strm.readSome(&m_buffer[size], READ_CHUNK_SIZE);
+    size += readSize;
+    if (readSize == 0) {
+      break;
+    }
+  }
+
+  m_buffer.resize(size);
+  m_data = reinterpret_cast<const uint8_t*>(m_buffer.data());
+  m_size = m_buffer.size();
+  parseHeader();
+}
+
+KVBinaryInputStreamSerializer::KVBinaryInputStreamSerializer(const void* data, size_t size) :
+  m_data(static_cast<const uint8_t*>(data)), m_size(size) {
+  parseHeader();
+}
+
+void KVBinaryInputStreamSerializer::parseHeader() {
+  size_t offset = 0;
+  auto hdr = readPod<KVBinaryStorageBlockHeader>(take(offset, sizeof(KVBinaryStorageBlockHeader)));
+
+  if (
+    hdr.m_signature_a != PORTABLE_STORAGE_SIGNATUREA ||
+    hdr.m_signature_b != PORTABLE_STORAGE_SIGNATUREB) {
+    throw std::runtime_error("Invalid binary storage signature");
+  }
+
+  if (hdr.m_ver != PORTABLE_STORAGE_FORMAT_VER) {
+    throw std::runtime_error("Unknown binary storage format version");
+  }
+
+  m_scopes.push_back(Scope{false, 0, 0, 0, 0});
+  indexSection(offset);
+}
+
+const uint8_t* KVBinaryInputStreamSerializer::take(size_t& offset, size_t size) const {
+  if (size > m_size - offset) {
+    throw std::runtime_error("Unexpected end of binary storage");
+  }
+
+  const uint8_t* data = m_data + offset;
+  offset += size;
+  return data;
 }
 
-size_t readVarint(common::IInputStream& s) {
-  uint8_t b = read<uint8_t>(s);
+size_t KVBinaryInputStreamSerializer::readVarint(size_t& offset) const {
+  uint8_t b = *take(offset, 1);
   uint8_t size_mask = b & PORTABLE_RAW_SIZE_MARK_MASK;
   size_t bytesLeft = 0;
 
@@ -59,9 +123,10 @@ size_t readVarint(common::IInputStream& s) {
   }
 
   size_t value = b;
+  const uint8_t* rest = take(offset, bytesLeft);
 
   for (size_t i = 1; i <= bytesLeft; ++i) {
-    size_t n = read<uint8_t>(s);
+    size_t n = rest[i - 1];
     value |= n << (i * 8);
   }
 
@@ -69,131 +134,305 @@ size_t readVarint(common::IInputStream& s) {
   return value;
 }
 
-std::string readString(common::IInputStream& s) {
-  auto size = readVarint(s);
-  if (size > 128*1024*1024) {
-    throw std::runtime_error("string size is too big");
+// Appends the entries of the section at offset to m_entries, returns the end of the section
+size_t KVBinaryInputStreamSerializer::indexSection(size_t offset) {
+  size_t count = readVarint(offset);
+
+  while (count--) {
+    uint8_t nameLength = *take(offset, 1);
+    const char* name = reinterpret_cast<const char*>(take(offset, nameLength));
+    uint8_t type = *take(offset, 1);
+    m_entries.push_back(Entry{StringView(name, nameLength), type, offset});
+
+    if (type & BIN_KV_SERIALIZE_FLAG_ARRAY) {
+      offset = skipArray(offset, type & ~BIN_KV_SERIALIZE_FLAG_ARRAY, m_scopes.size());
+    } else {
+      offset = skipValue(offset, type, m_scopes.size());
+    }
+  }
+
+  return offset;
+}
+
+size_t KVBinaryInputStreamSerializer::skipValue(size_t offset, uint8_t type, size_t depth) const {
+  if (depth > MAX_NESTING_LEVEL) {
+    throw std::runtime_error("Binary storage nesting is too deep");
+  }
+
+  size_t size = fixedValueSize(type);
+  if (size != 0) {
+    take(offset, size);
+    return offset;
+  }
+
+  switch (type) {
+  case BIN_KV_SERIALIZE_TYPE_STRING:
+    size = readVarint(offset);
+    take(offset, size);
+    return offset;
+
+  case BIN_KV_SERIALIZE_TYPE_OBJECT: {
+    size_t count = readVarint(offset);
+    while (count--) {
+      uint8_t nameLength = *take(offset, 1);
+      take(offset, nameLength);
+      uint8_t entryType = *take(offset, 1);
+      if (entryType & BIN_KV_SERIALIZE_FLAG_ARRAY) {
+        offset = skipArray(offset, entryType & ~BIN_KV_SERIALIZE_FLAG_ARRAY, depth + 1);
+      } else {
+        offset = skipValue(offset, entryType, depth + 1);
+      }
+    }
+    return offset;
+  }
+
+  case BIN_KV_SERIALIZE_TYPE_ARRAY: {
+    uint8_t itemType = *take(offset, 1);
+    if (!(itemType & BIN_KV_SERIALIZE_FLAG_ARRAY)) {
+      throw std::runtime_error("Array expected");
+    }
+    return skipArray(offset, itemType & ~BIN_KV_SERIALIZE_FLAG_ARRAY, depth + 1);
+  }
+
+  default:
+    throw std::runtime_error("Unknown data type");
+  }
+}
+
+size_t KVBinaryInputStreamSerializer::skipArray(size_t offset, uint8_t itemType, size_t depth) const {
+  size_t count = readVarint(offset);
+  size_t itemSize = fixedValueSize(itemType);
+
+  if (itemSize != 0) {
+    if (count > (m_size - offset) / itemSize) {
+      throw std::runtime_error("Unexpected end of binary storage");
+    }
+
+    return offset + count * itemSize;
+  }
+
+  while (count--) {
+    offset = skipValue(offset, itemType, depth);
+  }
+
+  return offset;
+}
+
+bool KVBinaryInputStreamSerializer::findValue(common::StringView name, uint8_t& type, size_t& offset) {
+  Scope& scope = m_scopes.back();
+
+  if (scope.isArray) {
+    if (scope.remaining == 0) {
+      throw std::runtime_error("Array index out of range");
+    }
+
+    --scope.remaining;
+    type = scope.itemType;
+    offset = scope.cursor;
+    scope.cursor = skipValue(offset, type, m_scopes.size());
+    return true;
   }
 
-  std::string str;
-  str.resize(size);
-  if (size) {
-    read(s, &str[0], size);
+  for (size_t i = scope.firstEntry; i < m_entries.size(); ++i) {
+    if (m_entries[i].name == name) {
+      type = m_entries[i].type;
+      offset = m_entries[i].offset;
+      return true;
+    }
   }
-  return str;
+
+  return false;
 }
 
-JsonValue readStringJson(common::IInputStream& s) {
-  return JsonValue(readString(s));
+ISerializer::SerializerType KVBinaryInputStreamSerializer::type() const {
+  return ISerializer::INPUT;
 }
 
-void readName(common::IInputStream& s, std::string& name) {
-  uint8_t len = readPod<uint8_t>(s);
-  if (len) {
-    name.resize(len);
-    read(s, &name[0], len);
+bool KVBinaryInputStreamSerializer::beginObject(common::StringView name) {
+  Scope& parent = m_scopes.back();
+  size_t offset;
+
+  if (parent.isArray) {
+    if (parent.itemType != BIN_KV_SERIALIZE_TYPE_OBJECT) {
+      throw std::runtime_error("Object expected");
+    }
+
+    if (parent.remaining == 0) {
+      throw std::runtime_error("Array index out of range");
+    }
+
+    // indexing the element finds its end, which is where the next one starts
+    --parent.remaining;
+    offset = parent.cursor;
+    size_t parentIndex = m_scopes.size() - 1;
+    m_scopes.push_back(Scope{false, 0, 0, 0, m_entries.size()});
+    m_scopes[parentIndex].cursor = indexSection(offset);
+    return true;
+  }
+
+  uint8_t type;
+  if (!findValue(name, type, offset)) {
+    return false;
+  }
+
+  if (type != BIN_KV_SERIALIZE_TYPE_OBJECT) {
+    throw std::runtime_error("Object expected");
   }
+
+  m_scopes.push_back(Scope{false, 0, 0, 0, m_entries.size()});
+  indexSection(offset);
+  return true;
 }
 
-JsonValue loadValue(common::IInputStream& stream, uint8_t type);
-JsonValue loadSection(common::IInputStream& stream);
-JsonValue loadEntry(common::IInputStream& stream);
-JsonValue loadArray(common::IInputStream& stream, uint8_t itemType);
+void KVBinaryInputStreamSerializer::endObject() {
+  assert(m_scopes.size() > 1);
+  m_entries.resize(m_scopes.back().firstEntry);
+  m_scopes.pop_back();
+}
+
+bool KVBinaryInputStreamSerializer::beginArray(size_t& size, common::StringView name) {
+  uint8_t type;
+  size_t offset;
 
+  if (!findValue(name, type, offset)) {
+    size = 0;
+    return false;
+  }
 
-JsonValue loadSection(common::IInputStream& stream) {
-  JsonValue sec(JsonValue::OBJECT);
-  size_t count = readVarint(stream);
-  std::string name;
+  // nested arrays carry their own type byte
+  if (type == BIN_KV_SERIALIZE_TYPE_ARRAY) {
+    type = *take(offset, 1);
+  }
 
-  while (count--) {
-    readName(stream, name);
-    sec.insert(name, loadEntry(stream));
+  if (!(type & BIN_KV_SERIALIZE_FLAG_ARRAY)) {
+    throw std::runtime_error("Array expected");
   }
 
-  return sec;
+  size = readVarint(offset);
+  m_scopes.push_back(Scope{true, static_cast<uint8_t>(type & ~BIN_KV_SERIALIZE_FLAG_ARRAY), size, offset, m_entries.size()});
+  return true;
 }
 
-JsonValue loadValue(common::IInputStream& stream, uint8_t type) {
+void KVBinaryInputStreamSerializer::endArray() {
+  assert(m_scopes.size() > 1);
+  m_scopes.pop_back();
+}
+
+template <typename T>
+bool KVBinaryInputStreamSerializer::readNumber(common::StringView name, T& value) {
+  uint8_t type;
+  size_t offset;
+  if (!findValue(name, type, offset)) {
+    return false;
+  }
+
+  const uint8_t* data = take(offset, fixedValueSize(type));
   switch (type) {
-  case BIN_KV_SERIALIZE_TYPE_INT64:  return readIntegerJson<int64_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_INT32:  return readIntegerJson<int32_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_INT16:  return readIntegerJson<int16_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_INT8:   return readIntegerJson<int8_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_UINT64: return readIntegerJson<uint64_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_UINT32: return readIntegerJson<uint32_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_UINT16: return readIntegerJson<uint16_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_UINT8:  return readIntegerJson<uint8_t>(stream);
-  case BIN_KV_SERIALIZE_TYPE_DOUBLE: return readPodJson<double>(stream);
-  case BIN_KV_SERIALIZE_TYPE_BOOL:   return JsonValue(read<uint8_t>(stream) != 0);
-  case BIN_KV_SERIALIZE_TYPE_STRING: return readStringJson(stream);
-  case BIN_KV_SERIALIZE_TYPE_OBJECT: return loadSection(stream);
-  case BIN_KV_SERIALIZE_TYPE_ARRAY:  return loadArray(stream, type);
+  case BIN_KV_SERIALIZE_TYPE_INT64:  value = static_cast<T>(readPod<int64_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_INT32:  value = static_cast<T>(readPod<int32_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_INT16:  value = static_cast<T>(readPod<int16_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_INT8:   value = static_cast<T>(readPod<int8_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_UINT64: value = static_cast<T>(readPod<uint64_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_UINT32: value = static_cast<T>(readPod<uint32_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_UINT16: value = static_cast<T>(readPod<uint16_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_UINT8:  value = static_cast<T>(readPod<uint8_t>(data)); break;
+  case BIN_KV_SERIALIZE_TYPE_DOUBLE: value = static_cast<T>(readPod<double>(data)); break;
   default:
-    throw std::runtime_error("Unknown data type");
+    throw std::runtime_error("Number expected");
   }
+
+  return true;
 }
 
-JsonValue loadEntry(common::IInputStream& stream) {
-  uint8_t type = readPod<uint8_t>(stream);
+bool KVBinaryInputStreamSerializer::operator()(uint8_t& value, common::StringView name) {
+  return readNumber(name, value);
+}
 
-  if (type & BIN_KV_SERIALIZE_FLAG_ARRAY) {
-    type &= ~BIN_KV_SERIALIZE_FLAG_ARRAY;
-    return loadArray(stream, type);
-  }
+bool KVBinaryInputStreamSerializer::operator()(uint16_t& value, common::StringView name) {
+  return readNumber(name, value);
+}
 
-  return loadValue(stream, type);
+bool KVBinaryInputStreamSerializer::operator()(int16_t& value, common::StringView name) {
+  return readNumber(name, value);
 }
 
-JsonValue loadArray(common::IInputStream& stream, uint8_t itemType) {
-  JsonValue arr(JsonValue::ARRAY);
-  size_t count = readVarint(stream);
+bool KVBinaryInputStreamSerializer::operator()(uint32_t& value, common::StringView name) {
+  return readNumber(name, value);
+}
 
-  while (count--) {
-    arr.pushBack(loadValue(stream, itemType));
-  }
+bool KVBinaryInputStreamSerializer::operator()(int32_t& value, common::StringView name) {
+  return readNumber(name, value);
+}
 
-  return arr;
+bool KVBinaryInputStreamSerializer::operator()(int64_t& value, common::StringView name) {
+  return readNumber(name, value);
 }
 
+bool KVBinaryInputStreamSerializer::operator()(uint64_t& value, common::StringView name) {
+  return readNumber(name, value);
+}
 
-JsonValue parseBinary(common::IInputStream& stream) {
-  auto hdr = readPod<KVBinaryStorageBlockHeader>(stream);
+bool KVBinaryInputStreamSerializer::operator()(double& value, common::StringView name) {
+  return readNumber(name, value);
+}
 
-  if (
-    hdr.m_signature_a != PORTABLE_STORAGE_SIGNATUREA ||
-    hdr.m_signature_b != PORTABLE_STORAGE_SIGNATUREB) {
-    throw std::runtime_error("Invalid binary storage signature");
+bool KVBinaryInputStreamSerializer::operator()(bool& value, common::StringView name) {
+  uint8_t type;
+  size_t offset;
+  if (!findValue(name, type, offset)) {
+    return false;
   }
 
-  if (hdr.m_ver != PORTABLE_STORAGE_FORMAT_VER) {
-    throw std::runtime_error("Unknown binary storage format version");
+  if (type != BIN_KV_SERIALIZE_TYPE_BOOL) {
+    throw std::runtime_error("Bool expected");
   }
 
-  return loadSection(stream);
+  value = *take(offset, 1) != 0;
+  return true;
 }
 
+bool KVBinaryInputStreamSerializer::readBlob(common::StringView name, const uint8_t*& data, size_t& size) {
+  uint8_t type;
+  size_t offset;
+  if (!findValue(name, type, offset)) {
+    return false;
+  }
+
+  if (type != BIN_KV_SERIALIZE_TYPE_STRING) {
+    throw std::runtime_error("String expected");
+  }
+
+  size = readVarint(offset);
+  data = take(offset, size);
+  return true;
 }
 
-KVBinaryInputStreamSerializer::KVBinaryInputStreamSerializer(common::IInputStream& strm) : JsonInputValueSerializer(parseBinary(strm)) {
+bool KVBinaryInputStreamSerializer::operator()(std::string& value, common::StringView name) {
+  const uint8_t* data;
+  size_t size;
+  if (!readBlob(name, data, size)) {
+    return false;
+  }
+
+  value.assign(reinterpret_cast<const char*>(data), size);
+  return true;
 }
 
 bool KVBinaryInputStreamSerializer::binary(void* value, size_t size, common::StringView name) {
-  std::string str;
-
-  if (!(*this)(str, name)) {
+  const uint8_t* data;
+  size_t blobSize;
+  if (!readBlob(name, data, blobSize)) {
     return false;
   }
 
-  if (str.size() != size) {
+  if (blobSize != size) {
     throw std::runtime_error("Binary block size mismatch");
   }
 
-  memcpy(value, str.data(), size);
+  memcpy(value, data, size);
   return true;
 }
 
 bool KVBinaryInputStreamSerializer::binary(std::string& value, common::StringView name) {
   return (*this)(value, name); // load as string
 }
-
@@ -7,18 +7,82 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <Common/IInputStream.h>
 #include "ISerializer.h"
-#include "JsonInputValueSerializer.h"
 
 namespace cn {
 
-class KVBinaryInputStreamSerializer : public JsonInputValueSerializer {
+// Reads portable storage directly from the serialized buffer. Each section is
+// indexed (key name and value offset) when it is entered, so keys may be read
+// in any order, and values are decoded straight into the target fields.
+class KVBinaryInputStreamSerializer : public ISerializer {
 public:
+  // Reads the whole stream into an internal buffer
   KVBinaryInputStreamSerializer(common::IInputStream& strm);
+  // The buffer must outlive the serializer
+  KVBinaryInputStreamSerializer(const void* data, size_t size);
+
+  SerializerType type() const override;
+
+  bool beginObject(common::StringView name) override;
+  void endObject() override;
+
+  bool beginArray(size_t& size, common::StringView name) override;
+  void endArray() override;
+
+  bool operator()(uint8_t& value, common::StringView name) override;
+  bool operator()(int16_t& value, common::StringView name) override;
+  bool operator()(uint16_t& value, common::StringView name) override;
+  bool operator()(int32_t& value, common::StringView name) override;
+  bool operator()(uint32_t& value, common::StringView name) override;
+  bool operator()(int64_t& value, common::StringView name) override;
+  bool operator()(uint64_t& value, common::StringView name) override;
+  bool operator()(double& value, common::StringView name) override;
+  bool operator()(bool& value, common::StringView name) override;
+  bool operator()(std::string& value, common::StringView name) override;
+  bool binary(void* value, size_t size, common::StringView name) override;
+  bool binary(std::string& value, common::StringView name) override;
+
+  template<typename T>
+  bool operator()(T& value, common::StringView name) {
+    return ISerializer::operator()(value, name);
+  }
+
+private:
+  struct Entry {
+    common::StringView name;
+    uint8_t type;
+    size_t offset;
+  };
+
+  struct Scope {
+    bool isArray;
+    uint8_t itemType;
+    size_t remaining;
+    size_t cursor;
+    size_t firstEntry;
+  };
+
+  std::string m_buffer;
+  const uint8_t* m_data;
+  size_t m_size;
+  std::vector<Entry> m_entries;
+  std::vector<Scope> m_scopes;
+
+  void parseHeader();
+  size_t indexSection(size_t offset);
+  size_t skipValue(size_t offset, uint8_t type, size_t depth) const;
+  size_t skipArray(size_t offset, uint8_t itemType, size_t depth) const;
+  size_t readVarint(size_t& offset) const;
+  const uint8_t* take(size_t& offset, size_t size) const;
+  bool findValue(common::StringView name, uint8_t& type, size_t& offset);
+  bool readBlob(common::StringView name, const uint8_t*& data, size_t& size);
 
-  virtual bool binary(void* value, size_t size, common::StringView name) override;
-  virtual bool binary(std::string& value, common::StringView name) override;
+  template <typename T>
+  bool readNumber(common::StringView name, T& value);
 };
 
 }
@@ -112,8 +112,7 @@ std::string storeToBinaryKeyValue(const T& v) {
 template <typename T>
 bool loadFromBinaryKeyValue(T& v, const std::string& buf) {
   try {
-    common::MemoryInputStream stream(buf.data(), buf.size());
-    KVBinaryInputStreamSerializer s(stream);
+    KVBinaryInputStreamSerializer s(buf.data(), buf.size());
     serialize(v, s);
     return true;
   } catch (std::exception&) {
@@ -0,0 +1,140 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "AsyncResolver.h"
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <System/Dispatcher.h>
+#include <System/DnsCache.h>
+#include <System/Event.h>
+#include <System/InterruptedException.h>
+
+namespace platform_system {
+
+namespace {
+
+// Shared between the waiter and the helper thread. dispatcher and event are
+// reset by the waiter when it gives up, after which the helper only stores
+// its result.
+struct LookupState {
+  std::mutex mutex;
+  std::condition_variable finishedCondition;
+  bool finished = false;
+  Dispatcher* dispatcher = nullptr;
+  Event* event = nullptr;
+  std::vector<std::string> records;
+  std::exception_ptr error;
+};
+
+void startLookup(std::shared_ptr<LookupState> state, AsyncResolver::Lookup lookup, std::string name, std::string key, std::chrono::seconds ttl,
+  bool tracked) {
+  std::thread([state, lookup, name, key, ttl, tracked] {
+    std::vector<std::string> records;
+    std::exception_ptr error;
+    try {
+      records = lookup(name);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    if (!error && !records.empty()) {
+      DnsCache::instance().put(key, records, ttl);
+    }
+
+    if (tracked) {
+      DnsCache::instance().endLookup(key);
+    }
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->finished = true;
+    state->records = std::move(records);
+    state->error = error;
+    state->finishedCondition.notify_all();
+    if (state->dispatcher != nullptr) {
+      state->dispatcher->remoteSpawn([state] {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->event != nullptr) {
+          state->event->set();
+        }
+      });
+    }
+  }).detach();
+}
+
+}
+
+AsyncResolver::AsyncResolver(Dispatcher& dispatcher, const std::string& kind, Lookup lookup, std::chrono::seconds ttl) :
+  dispatcher(&dispatcher), kind(kind), lookup(std::move(lookup)), ttl(ttl) {
+}
+
+std::vector<std::string> AsyncResolver::resolve(const std::string& name) {
+  assert(dispatcher != nullptr);
+  if (dispatcher->interrupted()) {
+    throw InterruptedException();
+  }
+
+  std::string key = kind + ':' + name;
+  std::vector<std::string> records;
+  if (DnsCache::instance().get(key, records)) {
+    return records;
+  }
+
+  Event event(*dispatcher);
+  auto state = std::make_shared<LookupState>();
+  state->dispatcher = dispatcher;
+  state->event = &event;
+  startLookup(state, lookup, name, key, ttl, false);
+
+  try {
+    event.wait();
+  } catch (InterruptedException&) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->dispatcher = nullptr;
+    state->event = nullptr;
+    throw;
+  }
+
+  std::lock_guard<std::mutex> lock(state->mutex);
+  assert(state->finished);
+  state->event = nullptr;
+  if (state->error) {
+    std::rethrow_exception(state->error);
+  }
+
+  return state->records;
+}
+
+bool AsyncResolver::resolveWithin(const std::string& kind, const std::string& name, const Lookup& lookup, std::chrono::seconds ttl,
+  std::chrono::milliseconds timeout, std::vector<std::string>& records) {
+  std::string key = kind + ':' + name;
+  if (DnsCache::instance().get(key, records)) {
+    return true;
+  }
+
+  if (!DnsCache::instance().beginLookup(key)) {
+    return false;
+  }
+
+  auto state = std::make_shared<LookupState>();
+  startLookup(state, lookup, name, key, ttl, true);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  if (!state->finishedCondition.wait_for(lock, timeout, [&] { return state->finished; })) {
+    return false;
+  }
+
+  if (state->error || state->records.empty()) {
+    return false;
+  }
+
+  records = state->records;
+  return true;
+}
+
+}
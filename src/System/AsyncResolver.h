@@ -0,0 +1,48 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace platform_system {
+
+class Dispatcher;
+
+// Runs blocking name lookups on a helper thread so the dispatcher keeps
+// serving other contexts. Successful results are kept in DnsCache for ttl;
+// failures are not cached. The lookup is injectable, which lets tests and
+// callers plug in a stub or hosts-file resolver.
+class AsyncResolver {
+public:
+  typedef std::function<std::vector<std::string>(const std::string&)> Lookup;
+
+  AsyncResolver(Dispatcher& dispatcher, const std::string& kind, Lookup lookup, std::chrono::seconds ttl);
+  AsyncResolver(const AsyncResolver&) = delete;
+  AsyncResolver& operator=(const AsyncResolver&) = delete;
+
+  // Suspends the calling context until the lookup finishes and rethrows its
+  // exception. Interrupting the context, e.g. from ContextGroupTimeout,
+  // abandons the wait with InterruptedException; the lookup still completes
+  // in the background and fills the cache.
+  std::vector<std::string> resolve(const std::string& name);
+
+  // For callers without a dispatcher: waits at most timeout and returns false
+  // on failure or timeout. At most one lookup per name runs at a time, so a
+  // lookup that outlives the wait is picked up from the cache later.
+  static bool resolveWithin(const std::string& kind, const std::string& name, const Lookup& lookup, std::chrono::seconds ttl,
+    std::chrono::milliseconds timeout, std::vector<std::string>& records);
+
+private:
+  Dispatcher* dispatcher;
+  std::string kind;
+  Lookup lookup;
+  std::chrono::seconds ttl;
+};
+
+}
@@ -0,0 +1,53 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "DnsCache.h"
+
+namespace platform_system {
+
+DnsCache& DnsCache::instance() {
+  static DnsCache cache;
+  return cache;
+}
+
+bool DnsCache::get(const std::string& key, std::vector<std::string>& records) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = entries.find(key);
+  if (it == entries.end()) {
+    return false;
+  }
+
+  if (it->second.expires <= std::chrono::steady_clock::now()) {
+    entries.erase(it);
+    return false;
+  }
+
+  records = it->second.records;
+  return true;
+}
+
+void DnsCache::put(const std::string& key, const std::vector<std::string>& records, std::chrono::seconds ttl) {
+  std::lock_guard<std::mutex> lock(mutex);
+  Entry& entry = entries[key];
+  entry.records = records;
+  entry.expires = std::chrono::steady_clock::now() + ttl;
+}
+
+void DnsCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+}
+
+bool DnsCache::beginLookup(const std::string& key) {
+  std::lock_guard<std::mutex> lock(mutex);
+  return runningLookups.insert(key).second;
+}
+
+void DnsCache::endLookup(const std::string& key) {
+  std::lock_guard<std::mutex> lock(mutex);
+  runningLookups.erase(key);
+}
+
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace platform_system {
+
+// Process-wide cache of name lookups. Keys are "<kind>:<name>" so address
+// and TXT records for the same name don't collide. Thread-safe.
+class DnsCache {
+public:
+  static DnsCache& instance();
+
+  bool get(const std::string& key, std::vector<std::string>& records);
+  void put(const std::string& key, const std::vector<std::string>& records, std::chrono::seconds ttl);
+  void clear();
+
+  // Marks a lookup for key as running; returns false if one already is.
+  bool beginLookup(const std::string& key);
+  void endLookup(const std::string& key);
+
+private:
+  struct Entry {
+    std::vector<std::string> records;
+    std::chrono::steady_clock::time_point expires;
+  };
+
+  std::mutex mutex;
+  std::map<std::string, Entry> entries;
+  std::set<std::string> runningLookups;
+};
+
+}
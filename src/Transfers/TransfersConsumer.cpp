@@ -568,7 +568,7 @@ void TransfersConsumer::processOutputs(const TransactionBlockInfo& blockInfo, Tr
       assert(subscribtionTxInfo.blockHeight == blockInfo.height);
     }
   } else {
-    auto messages = get_messages_from_extra(tx.getExtra(), tx.getTransactionPublicKey(), &sub.getKeys().spendSecretKey);
+    auto messages = tx.getMessages(&sub.getKeys().spendSecretKey);
     updated = sub.addTransaction(blockInfo, tx, transfers, std::move(messages));
     contains = updated;
   }
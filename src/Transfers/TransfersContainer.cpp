@@ -6,6 +6,9 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "TransfersContainer.h"
+
+#include <algorithm>
+
 #include "IWalletLegacy.h"
 #include "Common/StdInputStream.h"
 #include "Common/StdOutputStream.h"
@@ -685,6 +688,41 @@ void TransfersContainer::getOutputs(std::vector<TransactionOutputInformation>& t
   }
 }
 
+void TransfersContainer::getOutputsByAmount(std::vector<TransactionOutputInformation>& transfers, uint32_t flags, uint64_t minAmount, uint64_t maxAmount, size_t count) const {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  size_t first = transfers.size();
+  auto& index = m_availableTransfers.get<AmountIndex>();
+
+  // locked outputs stay in the index and are skipped, they are few compared to the unlocked ones
+  auto collect = [&](transaction_types::OutputType type) {
+    size_t collected = 0;
+    auto end = index.upper_bound(boost::make_tuple(type, maxAmount));
+    for (auto it = index.lower_bound(boost::make_tuple(type, minAmount)); it != end && collected < count; ++it) {
+      if (it->visible && isIncluded(*it, flags)) {
+        transfers.push_back(*it);
+        ++collected;
+      }
+    }
+  };
+
+  bool includeKey = (flags & IncludeTypeKey) != 0;
+  bool includeMultisignature = (flags & (IncludeTypeMultisignature | IncludeTypeDeposit)) != 0;
+  if (includeKey) {
+    collect(transaction_types::OutputType::Key);
+  }
+
+  if (includeMultisignature) {
+    collect(transaction_types::OutputType::Multisignature);
+  }
+
+  if (includeKey && includeMultisignature) {
+    std::stable_sort(transfers.begin() + first, transfers.end(), [](const TransactionOutputInformation& a, const TransactionOutputInformation& b) {
+      return a.amount < b.amount;
+    });
+    transfers.resize(std::min(transfers.size(), first + count));
+  }
+}
+
 bool TransfersContainer::getTransactionInformation(const crypto::Hash& transactionHash, TransactionInformation& info, uint64_t* amountIn, uint64_t* amountOut) const {
   std::lock_guard<std::mutex> lk(m_mutex);
   auto it = m_transactions.find(transactionHash);
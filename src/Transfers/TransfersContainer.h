@@ -12,6 +12,7 @@
 #include <mutex>
 
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/composite_key.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/mem_fun.hpp>
@@ -203,6 +204,7 @@ public:
   virtual size_t transactionsCount() const override;
   virtual uint64_t balance(uint32_t flags) const override;
   virtual void getOutputs(std::vector<TransactionOutputInformation>& transfers, uint32_t flags) const override;
+  virtual void getOutputsByAmount(std::vector<TransactionOutputInformation>& transfers, uint32_t flags, uint64_t minAmount, uint64_t maxAmount, size_t count) const override;
   virtual bool getTransactionInformation(const crypto::Hash& transactionHash, TransactionInformation& info,
     uint64_t* amountIn = nullptr, uint64_t* amountOut = nullptr) const override;
   virtual std::vector<TransactionOutputInformation> getTransactionOutputs(const crypto::Hash& transactionHash, uint32_t flags) const override;
@@ -222,6 +224,7 @@ private:
   struct SpentOutputDescriptorIndex { };
   struct TransferUnlockHeightIndex { };
   struct TransactionOutputKeyIndex { };
+  struct AmountIndex { };
 
   typedef boost::multi_index_container<
     TransactionInformation,
@@ -285,6 +288,14 @@ private:
           TransactionOutputKey,
           &TransactionOutputInformationEx::getTransactionOutputKey>,
         TransactionOutputKeyHasher
+      >,
+      boost::multi_index::ordered_non_unique <
+        boost::multi_index::tag<AmountIndex>,
+        boost::multi_index::composite_key <
+          TransactionOutputInformationEx,
+          BOOST_MULTI_INDEX_MEMBER(TransactionOutputInformation, transaction_types::OutputType, type),
+          BOOST_MULTI_INDEX_MEMBER(TransactionOutputInformation, uint64_t, amount)
+        >
       >
     >
   > AvailableTransfersMultiIndex;
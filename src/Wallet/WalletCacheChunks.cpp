@@ -0,0 +1,284 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "WalletCacheChunks.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+#include "Common/MemoryInputStream.h"
+#include "Common/StringOutputStream.h"
+#include "CryptoNoteCore/CryptoNoteSerialization.h"
+#include "Serialization/BinaryInputStreamSerializer.h"
+#include "Serialization/BinaryOutputStreamSerializer.h"
+
+namespace {
+
+#pragma pack(push, 1)
+struct SuffixHeader {
+  uint64_t directoryOffset;
+  uint64_t directorySize;
+  crypto::chacha8_iv directoryIv;
+};
+#pragma pack(pop)
+
+const uint64_t CHUNK_ALIGNMENT = 64;
+// suffixes smaller than this are never compacted
+const uint64_t COMPACTION_THRESHOLD = 1024 * 1024;
+
+uint64_t alignChunk(uint64_t size) {
+  return (std::max<uint64_t>(size, 1) + CHUNK_ALIGNMENT - 1) / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT;
+}
+
+const uint64_t DATA_START = alignChunk(sizeof(SuffixHeader));
+
+}
+
+namespace cn {
+
+WalletCacheChunks::WalletCacheChunks() {
+  reset();
+}
+
+void WalletCacheChunks::reset() {
+  m_known = false;
+  m_entries.clear();
+  m_directory = {0, 0};
+  m_lastWrittenChunks = 0;
+}
+
+void WalletCacheChunks::load(const ContainerStorage& storage, const crypto::chacha8_key& key) {
+  reset();
+
+  uint64_t suffixSize = storage.suffixSize();
+  if (suffixSize < DATA_START) {
+    throw std::runtime_error("Wallet cache is too small");
+  }
+
+  SuffixHeader header;
+  memcpy(&header, storage.suffix(), sizeof(header));
+  if (header.directoryOffset < DATA_START || header.directorySize > suffixSize || header.directoryOffset > suffixSize - header.directorySize) {
+    throw std::runtime_error("Wallet cache directory is out of bounds");
+  }
+
+  std::string directory(header.directorySize, '\0');
+  crypto::chacha8(storage.suffix() + header.directoryOffset, directory.size(), key, header.directoryIv, &directory[0]);
+
+  common::MemoryInputStream stream(directory.data(), directory.size());
+  BinaryInputStreamSerializer s(stream);
+  uint64_t count;
+  s(count, "count");
+  if (count > directory.size()) {
+    throw std::runtime_error("Wallet cache directory is corrupted");
+  }
+
+  std::vector<Entry> entries;
+  entries.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    Entry entry;
+    s(entry.type, "type");
+    s(entry.index, "index");
+    s(entry.offset, "offset");
+    s(entry.size, "size");
+    s(entry.iv, "iv");
+    s(entry.hash, "hash");
+
+    if (entry.offset < DATA_START || entry.size > suffixSize || entry.offset > suffixSize - entry.size) {
+      throw std::runtime_error("Wallet cache chunk is out of bounds");
+    }
+
+    entries.push_back(entry);
+  }
+
+  m_entries = std::move(entries);
+  m_directory = {header.directoryOffset, alignChunk(header.directorySize)};
+  m_known = true;
+}
+
+size_t WalletCacheChunks::chunkCount() const {
+  return m_entries.size();
+}
+
+void WalletCacheChunks::readChunk(const ContainerStorage& storage, const crypto::chacha8_key& key, size_t index, WalletCacheChunk& chunk) const {
+  const Entry& entry = m_entries.at(index);
+
+  chunk.type = static_cast<WalletCacheChunkType>(entry.type);
+  chunk.index = entry.index;
+  chunk.data.resize(entry.size);
+  crypto::chacha8(storage.suffix() + entry.offset, entry.size, key, entry.iv, &chunk.data[0]);
+
+  if (crypto::cn_fast_hash(chunk.data.data(), chunk.data.size()) != entry.hash) {
+    throw std::runtime_error("Wallet cache chunk is corrupted");
+  }
+}
+
+void WalletCacheChunks::save(ContainerStorage& storage, const crypto::chacha8_key& key, const IvGenerator& nextIv, const std::vector<WalletCacheChunk>& chunks) {
+  uint64_t suffixSize = storage.suffixSize();
+  if (!m_known || suffixSize < DATA_START || (suffixSize > COMPACTION_THRESHOLD && 2 * liveBytes() < suffixSize)) {
+    saveAll(storage, key, nextIv, chunks);
+    return;
+  }
+
+  std::map<std::pair<uint8_t, uint32_t>, const Entry*> previous;
+  for (const Entry& entry : m_entries) {
+    previous.emplace(std::make_pair(entry.type, entry.index), &entry);
+  }
+
+  // space used by the current directory stays untouched until the header switches
+  std::vector<Extent> used;
+  used.reserve(m_entries.size() + 1);
+  for (const Entry& entry : m_entries) {
+    used.push_back({entry.offset, alignChunk(entry.size)});
+  }
+  used.push_back(m_directory);
+  std::sort(used.begin(), used.end(), [](const Extent& a, const Extent& b) { return a.offset < b.offset; });
+
+  std::vector<Extent> gaps;
+  uint64_t position = DATA_START;
+  for (const Extent& extent : used) {
+    if (extent.offset > position) {
+      gaps.push_back({position, extent.offset - position});
+    }
+    position = std::max(position, extent.offset + extent.size);
+  }
+  if (suffixSize > position) {
+    gaps.push_back({position, suffixSize - position});
+  }
+
+  uint64_t end = std::max(suffixSize, position);
+  std::vector<Entry> entries;
+  std::vector<size_t> changed;
+  entries.reserve(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    Entry entry = makeEntry(chunks[i]);
+    auto it = previous.find(std::make_pair(entry.type, entry.index));
+    if (it != previous.end() && it->second->hash == entry.hash && it->second->size == entry.size) {
+      entries.push_back(*it->second);
+      continue;
+    }
+
+    entry.offset = allocate(gaps, end, alignChunk(entry.size));
+    entry.iv = nextIv();
+    entries.push_back(entry);
+    changed.push_back(i);
+  }
+
+  std::string directory = serializeDirectory(entries);
+  uint64_t directoryOffset = allocate(gaps, end, alignChunk(directory.size()));
+  if (end > storage.suffixSize()) {
+    storage.resizeSuffix(std::max(end, suffixSize + suffixSize / 2));
+  }
+
+  for (size_t i : changed) {
+    const Entry& entry = entries[i];
+    crypto::chacha8(chunks[i].data.data(), chunks[i].data.size(), key, entry.iv, reinterpret_cast<char*>(storage.suffix() + entry.offset));
+  }
+
+  writeDirectory(storage, key, nextIv, entries, directory, directoryOffset);
+  m_lastWrittenChunks = changed.size();
+}
+
+size_t WalletCacheChunks::lastWrittenChunks() const {
+  return m_lastWrittenChunks;
+}
+
+void WalletCacheChunks::saveAll(ContainerStorage& storage, const crypto::chacha8_key& key, const IvGenerator& nextIv, const std::vector<WalletCacheChunk>& chunks) {
+  std::vector<Entry> entries;
+  entries.reserve(chunks.size());
+
+  uint64_t end = DATA_START;
+  for (const WalletCacheChunk& chunk : chunks) {
+    Entry entry = makeEntry(chunk);
+    entry.offset = end;
+    entry.iv = nextIv();
+    entries.push_back(entry);
+    end += alignChunk(entry.size);
+  }
+
+  std::string directory = serializeDirectory(entries);
+  uint64_t directoryOffset = end;
+  end += alignChunk(directory.size());
+  storage.resizeSuffix(end);
+
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    crypto::chacha8(chunks[i].data.data(), chunks[i].data.size(), key, entries[i].iv, reinterpret_cast<char*>(storage.suffix() + entries[i].offset));
+  }
+
+  writeDirectory(storage, key, nextIv, entries, directory, directoryOffset);
+  m_lastWrittenChunks = chunks.size();
+}
+
+void WalletCacheChunks::writeDirectory(ContainerStorage& storage, const crypto::chacha8_key& key, const IvGenerator& nextIv, const std::vector<Entry>& entries, const std::string& directory, uint64_t offset) {
+  SuffixHeader header;
+  header.directoryOffset = offset;
+  header.directorySize = directory.size();
+  header.directoryIv = nextIv();
+  crypto::chacha8(directory.data(), directory.size(), key, header.directoryIv, reinterpret_cast<char*>(storage.suffix() + offset));
+
+  // chunks and directory reach the disk before the header points at them
+  storage.flush();
+  memcpy(storage.suffix(), &header, sizeof(header));
+
+  m_entries = entries;
+  m_directory = {offset, alignChunk(directory.size())};
+  m_known = true;
+}
+
+std::string WalletCacheChunks::serializeDirectory(const std::vector<Entry>& entries) const {
+  std::string directory;
+  common::StringOutputStream stream(directory);
+  BinaryOutputStreamSerializer s(stream);
+
+  uint64_t count = entries.size();
+  s(count, "count");
+  for (Entry entry : entries) {
+    s(entry.type, "type");
+    s(entry.index, "index");
+    s(entry.offset, "offset");
+    s(entry.size, "size");
+    s(entry.iv, "iv");
+    s(entry.hash, "hash");
+  }
+
+  return directory;
+}
+
+uint64_t WalletCacheChunks::liveBytes() const {
+  uint64_t bytes = DATA_START + m_directory.size;
+  for (const Entry& entry : m_entries) {
+    bytes += alignChunk(entry.size);
+  }
+
+  return bytes;
+}
+
+WalletCacheChunks::Entry WalletCacheChunks::makeEntry(const WalletCacheChunk& chunk) {
+  Entry entry;
+  entry.type = static_cast<uint8_t>(chunk.type);
+  entry.index = chunk.index;
+  entry.offset = 0;
+  entry.size = chunk.data.size();
+  entry.iv = crypto::chacha8_iv();
+  entry.hash = crypto::cn_fast_hash(chunk.data.data(), chunk.data.size());
+  return entry;
+}
+
+uint64_t WalletCacheChunks::allocate(std::vector<Extent>& gaps, uint64_t& end, uint64_t size) {
+  for (Extent& gap : gaps) {
+    if (gap.size >= size) {
+      uint64_t offset = gap.offset;
+      gap.offset += size;
+      gap.size -= size;
+      return offset;
+    }
+  }
+
+  uint64_t offset = end;
+  end += size;
+  return offset;
+}
+
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "crypto/chacha8.h"
+#include "crypto/hash.h"
+#include "Wallet/WalletIndices.h"
+
+namespace cn {
+
+enum class WalletCacheChunkType : uint8_t {
+  STATE = 0,
+  TRANSACTIONS = 1,
+  TRANSFERS = 2,
+  DEPOSITS = 3
+};
+
+struct WalletCacheChunk {
+  WalletCacheChunkType type;
+  uint32_t index;
+  std::string data;
+};
+
+/*
+  Wallet cache kept in the container suffix as independently encrypted chunks.
+  The suffix starts with a header locating an encrypted directory of chunks.
+  A save encrypts only the chunks whose content changed and writes them to
+  space the current directory does not use, then points the header at the
+  new directory.
+*/
+class WalletCacheChunks {
+public:
+  typedef std::function<crypto::chacha8_iv()> IvGenerator;
+
+  static const uint32_t RECORDS_PER_CHUNK = 1024;
+
+  WalletCacheChunks();
+
+  // Forgets the suffix layout, the next save rewrites the whole suffix
+  void reset();
+
+  void load(const ContainerStorage& storage, const crypto::chacha8_key& key);
+  size_t chunkCount() const;
+  void readChunk(const ContainerStorage& storage, const crypto::chacha8_key& key, size_t index, WalletCacheChunk& chunk) const;
+
+  void save(ContainerStorage& storage, const crypto::chacha8_key& key, const IvGenerator& nextIv, const std::vector<WalletCacheChunk>& chunks);
+  size_t lastWrittenChunks() const;
+
+private:
+  struct Entry {
+    uint8_t type;
+    uint32_t index;
+    uint64_t offset;
+    uint64_t size;
+    crypto::chacha8_iv iv;
+    crypto::Hash hash;
+  };
+
+  struct Extent {
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  void saveAll(ContainerStorage& storage, const crypto::chacha8_key& key, const IvGenerator& nextIv, const std::vector<WalletCacheChunk>& chunks);
+  void writeDirectory(ContainerStorage& storage, const crypto::chacha8_key& key, const IvGenerator& nextIv, const std::vector<Entry>& entries, const std::string& directory, uint64_t offset);
+  std::string serializeDirectory(const std::vector<Entry>& entries) const;
+  uint64_t liveBytes() const;
+
+  static Entry makeEntry(const WalletCacheChunk& chunk);
+  static uint64_t allocate(std::vector<Extent>& gaps, uint64_t& end, uint64_t size);
+
+  bool m_known;
+  std::vector<Entry> m_entries;
+  Extent m_directory;
+  size_t m_lastWrittenChunks;
+};
+
+}
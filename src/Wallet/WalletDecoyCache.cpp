@@ -0,0 +1,148 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "WalletDecoyCache.h"
+
+#include <algorithm>
+
+namespace cn {
+
+WalletDecoyCache::WalletDecoyCache(size_t poolSize, size_t refillThreshold, uint32_t maxAge) :
+  m_poolSize(poolSize), m_refillThreshold(refillThreshold), m_maxAge(maxAge), m_generation(0), m_refilling(false) {
+}
+
+void WalletDecoyCache::clear() {
+  m_pools.clear();
+  ++m_generation;
+  m_refilling = false;
+}
+
+void WalletDecoyCache::add(const std::vector<OutsForAmount>& outs, uint32_t height) {
+  for (const auto& outsForAmount : outs) {
+    Pool& pool = m_pools[outsForAmount.amount];
+    for (const auto& out : outsForAmount.outs) {
+      if (pool.indexes.insert(out.global_amount_index).second) {
+        pool.entries.push_back(Entry{out, height});
+      }
+    }
+  }
+}
+
+std::vector<WalletDecoyCache::AmountCount> WalletDecoyCache::missing(const std::vector<uint64_t>& amounts, uint64_t count, uint32_t currentHeight) {
+  std::vector<AmountCount> requests;
+  auto occurrences = countOccurrences(amounts);
+  for (uint64_t amount : amounts) {
+    auto occurrence = occurrences.find(amount);
+    if (occurrence == occurrences.end()) {
+      continue;
+    }
+
+    uint64_t needed = count * occurrence->second;
+    occurrences.erase(occurrence);
+
+    Pool& pool = m_pools[amount];
+    expire(pool, currentHeight);
+    if (pool.entries.size() < needed) {
+      requests.push_back(AmountCount{amount, needed - pool.entries.size() + m_poolSize});
+    }
+  }
+
+  return requests;
+}
+
+std::vector<WalletDecoyCache::OutsForAmount> WalletDecoyCache::draw(const std::vector<uint64_t>& amounts, uint64_t count, uint32_t currentHeight) {
+  std::vector<OutsForAmount> result;
+  result.reserve(amounts.size());
+  for (uint64_t amount : amounts) {
+    result.emplace_back();
+    OutsForAmount& outs = result.back();
+    outs.amount = amount;
+
+    auto it = m_pools.find(amount);
+    if (it == m_pools.end()) {
+      continue;
+    }
+
+    Pool& pool = it->second;
+    expire(pool, currentHeight);
+    // entries arrive in the daemon's random order, so taking from the back takes a random subset
+    while (outs.outs.size() < count && !pool.entries.empty()) {
+      outs.outs.push_back(pool.entries.back().out);
+      pool.indexes.erase(pool.entries.back().out.global_amount_index);
+      pool.entries.pop_back();
+    }
+  }
+
+  return result;
+}
+
+std::vector<WalletDecoyCache::AmountCount> WalletDecoyCache::refills(const std::vector<uint64_t>& amounts) const {
+  std::vector<AmountCount> requests;
+  auto occurrences = countOccurrences(amounts);
+  for (uint64_t amount : amounts) {
+    if (occurrences.erase(amount) == 0) {
+      continue;
+    }
+
+    size_t size = poolSize(amount);
+    if (size < m_refillThreshold) {
+      requests.push_back(AmountCount{amount, m_poolSize - size});
+    }
+  }
+
+  return requests;
+}
+
+bool WalletDecoyCache::beginRefill() {
+  if (m_refilling) {
+    return false;
+  }
+
+  m_refilling = true;
+  return true;
+}
+
+uint64_t WalletDecoyCache::generation() const {
+  return m_generation;
+}
+
+void WalletDecoyCache::finishRefill(uint64_t generation, const std::vector<OutsForAmount>& outs, uint32_t height) {
+  if (generation != m_generation) {
+    return;
+  }
+
+  m_refilling = false;
+  add(outs, height);
+}
+
+size_t WalletDecoyCache::poolSize(uint64_t amount) const {
+  auto it = m_pools.find(amount);
+  return it == m_pools.end() ? 0 : it->second.entries.size();
+}
+
+void WalletDecoyCache::expire(Pool& pool, uint32_t currentHeight) const {
+  if (currentHeight <= m_maxAge) {
+    return;
+  }
+
+  uint32_t oldest = currentHeight - m_maxAge;
+  auto expired = std::partition(pool.entries.begin(), pool.entries.end(), [oldest](const Entry& entry) { return entry.height >= oldest; });
+  for (auto it = expired; it != pool.entries.end(); ++it) {
+    pool.indexes.erase(it->out.global_amount_index);
+  }
+
+  pool.entries.erase(expired, pool.entries.end());
+}
+
+std::unordered_map<uint64_t, size_t> WalletDecoyCache::countOccurrences(const std::vector<uint64_t>& amounts) {
+  std::unordered_map<uint64_t, size_t> occurrences;
+  for (uint64_t amount : amounts) {
+    ++occurrences[amount];
+  }
+
+  return occurrences;
+}
+
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Rpc/CoreRpcServerCommandsDefinitions.h"
+
+namespace cn {
+
+/*
+  Per-amount pools of random outputs used as ring members. A send draws its
+  decoys from the pools instead of asking the node, and a decoy is handed out
+  only once. Pools are filled in bulk; entries older than maxAge blocks are
+  dropped and clear() discards everything when the chain is rolled back.
+*/
+class WalletDecoyCache {
+public:
+  typedef COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count AmountCount;
+  typedef COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount OutsForAmount;
+
+  WalletDecoyCache(size_t poolSize, size_t refillThreshold, uint32_t maxAge);
+
+  void clear();
+
+  // Adds outputs picked at the given height, skipping the ones a pool already holds
+  void add(const std::vector<OutsForAmount>& outs, uint32_t height);
+
+  // Counts to request before every occurrence of the amounts can take count decoys, pools are filled up as well
+  std::vector<AmountCount> missing(const std::vector<uint64_t>& amounts, uint64_t count, uint32_t currentHeight);
+
+  // Takes up to count decoys for every amount, the result is in the order of the amounts
+  std::vector<OutsForAmount> draw(const std::vector<uint64_t>& amounts, uint64_t count, uint32_t currentHeight);
+
+  // Counts to request for those of the amounts whose pools fell under the refill threshold
+  std::vector<AmountCount> refills(const std::vector<uint64_t>& amounts) const;
+
+  // At most one background refill at a time; an answer for an older generation is dropped
+  bool beginRefill();
+  uint64_t generation() const;
+  void finishRefill(uint64_t generation, const std::vector<OutsForAmount>& outs, uint32_t height);
+
+  size_t poolSize(uint64_t amount) const;
+
+private:
+  struct Entry {
+    COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::out_entry out;
+    uint32_t height;
+  };
+
+  struct Pool {
+    std::vector<Entry> entries;
+    std::unordered_set<uint64_t> indexes;
+  };
+
+  void expire(Pool& pool, uint32_t currentHeight) const;
+  static std::unordered_map<uint64_t, size_t> countOccurrences(const std::vector<uint64_t>& amounts);
+
+  const size_t m_poolSize;
+  const size_t m_refillThreshold;
+  const uint32_t m_maxAge;
+
+  std::unordered_map<uint64_t, Pool> m_pools;
+  uint64_t m_generation;
+  bool m_refilling;
+};
+
+}
@@ -51,6 +51,13 @@ using namespace logging;
 namespace
 {
 
+  /* Decoy pools hold enough for a handful of rings per amount and are topped
+     up in the background once a send leaves fewer than a quarter. Decoys
+     older than a day of blocks are not used. */
+  const size_t DECOY_POOL_SIZE = 64;
+  const size_t DECOY_REFILL_THRESHOLD = DECOY_POOL_SIZE / 4;
+  const uint32_t DECOY_MAX_AGE = 720;
+
   std::vector<uint64_t> split(uint64_t amount, uint64_t dustThreshold)
   {
     std::vector<uint64_t> amounts;
@@ -257,7 +264,8 @@ namespace cn
                                                                                                                                                                 m_synchronizer(currency, logger, m_blockchainSynchronizer, node),
                                                                                                                                                                 m_eventOccurred(m_dispatcher),
                                                                                                                                                                 m_readyEvent(m_dispatcher),
-                                                                                                                                                                m_transactionSoftLockTime(transactionSoftLockTime)
+                                                                                                                                                                m_transactionSoftLockTime(transactionSoftLockTime),
+                                                                                                                                                                m_decoyCache(std::make_shared<WalletDecoyCache>(DECOY_POOL_SIZE, DECOY_REFILL_THRESHOLD, DECOY_MAX_AGE))
   {
     m_upperTransactionSizeLimit = m_currency.transactionMaxSize();
     m_readyEvent.set();
@@ -460,13 +468,12 @@ namespace cn
 
     /* Select the wallet - If no source address was specified then it will pick funds from anywhere
      and the change will go to the primary address of the wallet container */
-    std::vector<WalletOuts> wallets = pickWallets({sourceAddress});
+    std::vector<WalletRecord *> wallets = pickSpendingWallets({sourceAddress});
 
     /* Select transfers, skipping amounts that cannot be mixed */
     uint64_t fee = 1000;
     uint64_t neededMoney = amount + fee;
     const uint64_t mixIn = cn::parameters::MINIMUM_MIXIN;
-    std::vector<WalletOuts> usableWallets = wallets;
     std::vector<OutputToTransfer> selectedTransfers;
     std::vector<outs_for_amount> mixinResult;
     uint64_t foundMoney = 0;
@@ -476,7 +483,7 @@ namespace cn
     {
       selectedTransfers.clear();
       mixinResult.clear();
-      foundMoney = selectTransfers(neededMoney, m_currency.defaultDustThreshold(), usableWallets, selectedTransfers);
+      foundMoney = selectTransfers(neededMoney, m_currency.defaultDustThreshold(), wallets, excludedAmounts, selectedTransfers);
 
       if (foundMoney < neededMoney)
       {
@@ -510,24 +517,6 @@ namespace cn
         excludedAmounts.insert(scarce.begin(), scarce.end());
         m_logger(WARNING, BRIGHT_YELLOW) << "Excluding " << scarce.size()
                                          << " unmixable amount(s) and retrying deposit selection";
-
-        usableWallets.clear();
-        for (const auto &wallet : wallets)
-        {
-          WalletOuts copy;
-          copy.wallet = wallet.wallet;
-          for (const auto &out : wallet.outs)
-          {
-            if (excludedAmounts.count(out.amount) == 0)
-            {
-              copy.outs.push_back(out);
-            }
-          }
-          if (!copy.outs.empty())
-          {
-            usableWallets.emplace_back(std::move(copy));
-          }
-        }
       }
     }
 
@@ -839,8 +828,6 @@ namespace cn
       });
     }
 
-    std::string containerData;
-    common::StringOutputStream containerStream(containerData);
     WalletSerializerV2 s(
         *this,
         m_viewPublicKey,
@@ -858,13 +845,19 @@ namespace cn
         m_uncommitedTransactions,
         const_cast<std::string &>(extra),
         m_transactionSoftLockTime);
-    s.save(containerStream, saveLevel);
-    encryptAndSaveContainerData(storage, key, containerData.data(), containerData.size());
+    std::vector<WalletCacheChunk> chunks;
+    s.save(chunks, saveLevel);
+
+    // only the opened container has a known chunk layout to update in place
+    WalletCacheChunks newStorageChunks;
+    WalletCacheChunks &cacheChunks = &storage == &m_containerStorage ? m_cacheChunks : newStorageChunks;
+    cacheChunks.save(storage, key, makeIvGenerator(storage), chunks);
+    reinterpret_cast<ContainerStoragePrefix *>(storage.prefix())->version = WalletSerializerV2::SERIALIZATION_VERSION;
     storage.flush();
 
     m_extra = extra;
 
-    m_logger(INFO) << "Container saving finished";
+    m_logger(INFO) << "Container saving finished, " << cacheChunks.lastWrittenChunks() << " of " << chunks.size() << " chunks written";
   }
 
   void WalletGreen::doShutdown()
@@ -878,6 +871,7 @@ namespace cn
     m_blockchainSynchronizer.removeObserver(this);
 
     m_containerStorage.close();
+    m_cacheChunks.reset();
     m_walletsContainer.clear();
     clearCaches(true, true);
 
@@ -1147,9 +1141,6 @@ namespace cn
   {
     assert(m_containerStorage.isOpened());
 
-    BinaryArray contanerData;
-    loadAndDecryptContainerData(m_containerStorage, m_key, contanerData);
-
     WalletSerializerV2 s(
         *this,
         m_viewPublicKey,
@@ -1168,8 +1159,31 @@ namespace cn
         extra,
         m_transactionSoftLockTime);
 
-    common::MemoryInputStream containerStream(contanerData.data(), contanerData.size());
-    s.load(containerStream, reinterpret_cast<const ContainerStoragePrefix *>(m_containerStorage.prefix())->version);
+    uint8_t version = reinterpret_cast<const ContainerStoragePrefix *>(m_containerStorage.prefix())->version;
+    if (version < WalletSerializerV2::CHUNKED_CACHE_VERSION)
+    {
+      BinaryArray contanerData;
+      loadAndDecryptContainerData(m_containerStorage, m_key, contanerData);
+
+      common::MemoryInputStream containerStream(contanerData.data(), contanerData.size());
+      s.load(containerStream, version);
+
+      // the next save rewrites the cache as chunks
+      m_cacheChunks.reset();
+    }
+    else
+    {
+      // chunks are decrypted one at a time straight from the mapped container
+      m_cacheChunks.load(m_containerStorage, m_key);
+
+      WalletCacheChunk chunk;
+      for (size_t i = 0; i < m_cacheChunks.chunkCount(); ++i)
+      {
+        m_cacheChunks.readChunk(m_containerStorage, m_key, i, chunk);
+        s.load(chunk);
+      }
+    }
+
     addedKeys = std::move(s.addedKeys());
     deletedKeys = std::move(s.deletedKeys());
 
@@ -1226,6 +1240,17 @@ namespace cn
     std::copy(suffix.begin(), suffix.end(), storage.suffix());
   }
 
+  WalletCacheChunks::IvGenerator WalletGreen::makeIvGenerator(ContainerStorage &storage)
+  {
+    return [&storage] {
+      // resizing the storage moves the prefix, so it is looked up on each call
+      auto *prefix = reinterpret_cast<ContainerStoragePrefix *>(storage.prefix());
+      crypto::chacha8_iv iv = prefix->nextIv;
+      incIv(prefix->nextIv);
+      return iv;
+    };
+  }
+
   void WalletGreen::incIv(crypto::chacha8_iv &iv)
   {
     static_assert(sizeof(uint64_t) == sizeof(crypto::chacha8_iv), "Bad crypto::chacha8_iv size");
@@ -1311,6 +1336,7 @@ namespace cn
         catch (const std::exception &e)
         {
           m_logger(ERROR, BRIGHT_RED) << "Failed to load cache: " << e.what() << ", reset wallet data";
+          m_cacheChunks.reset();
           clearCaches(true, true);
           subscribeWallets();
         }
@@ -1368,6 +1394,8 @@ namespace cn
     m_path = path;
     m_extra = extra;
 
+    rebuildTransactionPostings();
+
     m_state = WalletState::INITIALIZED;
 
     /* Backfill unlock jobs for deposits saved before one was scheduled at their term
@@ -1387,6 +1415,12 @@ namespace cn
       m_deposits.clear();
     }
 
+    if (clearTransactions || clearCachedData)
+    {
+      m_transactionPostings.clear();
+      m_decoyCache->clear();
+    }
+
     if (clearCachedData)
     {
       size_t walletIndex = 0;
@@ -1493,17 +1527,27 @@ namespace cn
     crypto::chacha8_key newKey;
     crypto::generate_chacha8_key(cnContext, newPassword, newKey);
 
-    m_containerStorage.atomicUpdate([this, newKey](ContainerStorage &newStorage)
+    WalletCacheChunks newCacheChunks;
+    m_containerStorage.atomicUpdate([this, newKey, &newCacheChunks](ContainerStorage &newStorage)
                                     {
     copyContainerStoragePrefix(m_containerStorage, m_key, newStorage, newKey);
     copyContainerStorageKeys(m_containerStorage, m_key, newStorage, newKey);
 
     if (m_containerStorage.suffixSize() > 0) {
-      BinaryArray containerData;
-      loadAndDecryptContainerData(m_containerStorage, m_key, containerData);
-      encryptAndSaveContainerData(newStorage, newKey, containerData.data(), containerData.size());
+      if (reinterpret_cast<const ContainerStoragePrefix *>(m_containerStorage.prefix())->version < WalletSerializerV2::CHUNKED_CACHE_VERSION) {
+        BinaryArray containerData;
+        loadAndDecryptContainerData(m_containerStorage, m_key, containerData);
+        encryptAndSaveContainerData(newStorage, newKey, containerData.data(), containerData.size());
+      } else if (m_cacheChunks.chunkCount() > 0) {
+        std::vector<WalletCacheChunk> chunks(m_cacheChunks.chunkCount());
+        for (size_t i = 0; i < chunks.size(); ++i) {
+          m_cacheChunks.readChunk(m_containerStorage, m_key, i, chunks[i]);
+        }
+        newCacheChunks.save(newStorage, newKey, makeIvGenerator(newStorage), chunks);
+      }
     } });
 
+    m_cacheChunks = std::move(newCacheChunks);
     m_key = newKey;
     m_password = newPassword;
 
@@ -1818,8 +1862,14 @@ namespace cn
       m_blockchain.push_back(m_currency.genesisBlockHash());
     }
 
+    for (auto transactionId : deletedTransactions)
+    {
+      updateTransactionPostings(transactionId);
+    }
+
     for (auto transactionId : updatedTransactions)
     {
+      updateTransactionPostings(transactionId);
       pushEvent(makeTransactionUpdatedEvent(transactionId));
     }
   }
@@ -2050,7 +2100,7 @@ namespace cn
   }
 
   void WalletGreen::prepareTransaction(
-      const std::vector<WalletOuts> &wallets,
+      const std::vector<WalletRecord *> &wallets,
       const std::vector<WalletOrder> &orders,
       const std::vector<WalletMessage> &messages,
       uint64_t fee,
@@ -2070,7 +2120,6 @@ namespace cn
     preparedTransaction.destinations = convertOrdersToTransfers(orders);
     preparedTransaction.neededMoney = countNeededMoney(preparedTransaction.destinations, fee);
 
-    std::vector<WalletOuts> usableWallets = wallets;
     std::vector<OutputToTransfer> selectedTransfers;
     std::vector<outs_for_amount> mixinResult;
     uint64_t foundMoney = 0;
@@ -2080,7 +2129,7 @@ namespace cn
     {
       selectedTransfers.clear();
       mixinResult.clear();
-      foundMoney = selectTransfers(preparedTransaction.neededMoney, m_currency.defaultDustThreshold(), usableWallets, selectedTransfers);
+      foundMoney = selectTransfers(preparedTransaction.neededMoney, m_currency.defaultDustThreshold(), wallets, excludedAmounts, selectedTransfers);
 
       if (foundMoney < preparedTransaction.neededMoney)
       {
@@ -2119,24 +2168,6 @@ namespace cn
         excludedAmounts.insert(scarce.begin(), scarce.end());
         m_logger(WARNING, BRIGHT_YELLOW) << "Excluding " << scarce.size()
                                          << " unmixable amount(s) and retrying transfer selection";
-
-        usableWallets.clear();
-        for (const auto &wallet : wallets)
-        {
-          WalletOuts copy;
-          copy.wallet = wallet.wallet;
-          for (const auto &out : wallet.outs)
-          {
-            if (excludedAmounts.count(out.amount) == 0)
-            {
-              copy.outs.push_back(out);
-            }
-          }
-          if (!copy.outs.empty())
-          {
-            usableWallets.emplace_back(std::move(copy));
-          }
-        }
       }
     }
 
@@ -2184,15 +2215,7 @@ namespace cn
     validateTransactionParameters(transactionParameters);
     cn::AccountPublicAddress changeDestination = getChangeDestination(transactionParameters.changeDestination, transactionParameters.sourceAddresses);
 
-    std::vector<WalletOuts> wallets;
-    if (!transactionParameters.sourceAddresses.empty())
-    {
-      wallets = pickWallets(transactionParameters.sourceAddresses);
-    }
-    else
-    {
-      wallets = pickWalletsWithMoney();
-    }
+    std::vector<WalletRecord *> wallets = pickSpendingWallets(transactionParameters.sourceAddresses);
 
     PreparedTransaction preparedTransaction;
     prepareTransaction(
@@ -2973,84 +2996,216 @@ namespace cn
 
     throwIfStopped();
 
-    auto getRandomOutsByAmountsCompleted = std::promise<std::error_code>();
-    auto getRandomOutsByAmountsWaitFuture = getRandomOutsByAmountsCompleted.get_future();
-
-    /* Request one extra so we can skip our own output if the daemon returns it
+    /* Take one extra so we can skip our own output if it was picked as a decoy
        (same approach as WalletLegacy). Final ring size stays mixIn + 1 real. */
     const uint64_t outsCount = mixIn + 1;
-    m_node.getRandomOutsByAmounts(std::move(amounts), outsCount, mixinResult, [&getRandomOutsByAmountsCompleted](std::error_code ec) {
-      auto detachedPromise = std::move(getRandomOutsByAmountsCompleted);
-      detachedPromise.set_value(ec);
-    });
-    std::error_code ec = getRandomOutsByAmountsWaitFuture.get();
+    const uint32_t currentHeight = m_node.getLastKnownBlockHeight();
 
-    if (ec)
+    /* Only amounts the pools cannot serve cost a round trip, fetched in one
+       bulk request that also fills their pools. */
+    auto missing = m_decoyCache->missing(amounts, outsCount, currentHeight);
+    if (!missing.empty())
     {
-      throw std::system_error(ec);
+      std::vector<outs_for_amount> fetched;
+      uint32_t height = 0;
+
+      auto getRandomOutsCompleted = std::promise<std::error_code>();
+      auto getRandomOutsWaitFuture = getRandomOutsCompleted.get_future();
+
+      m_node.getRandomOutsBulk(std::move(missing), fetched, height, [&getRandomOutsCompleted](std::error_code ec) {
+        auto detachedPromise = std::move(getRandomOutsCompleted);
+        detachedPromise.set_value(ec);
+      });
+      std::error_code ec = getRandomOutsWaitFuture.get();
+
+      if (ec)
+      {
+        throw std::system_error(ec);
+      }
+
+      m_decoyCache->add(fetched, height);
     }
 
+    mixinResult = m_decoyCache->draw(amounts, outsCount, currentHeight);
+    refillDecoys(amounts);
+
     checkIfEnoughMixins(mixinResult, mixIn);
   }
 
+  void WalletGreen::refillDecoys(const std::vector<uint64_t> &amounts)
+  {
+    auto refills = m_decoyCache->refills(amounts);
+    if (refills.empty() || !m_decoyCache->beginRefill())
+    {
+      return;
+    }
+
+    /* The answer outlives this call and may arrive after the wallet is gone,
+       so it is kept in shared state and merged only while the cache exists. */
+    struct DecoyRefill
+    {
+      std::vector<outs_for_amount> outs;
+      uint32_t height = 0;
+    };
+
+    auto refill = std::make_shared<DecoyRefill>();
+    std::weak_ptr<WalletDecoyCache> cache = m_decoyCache;
+    uint64_t generation = m_decoyCache->generation();
+    platform_system::Dispatcher &dispatcher = m_dispatcher;
+
+    m_node.getRandomOutsBulk(std::move(refills), refill->outs, refill->height, [refill, cache, generation, &dispatcher](std::error_code ec) {
+      dispatcher.remoteSpawn([refill, cache, generation, ec]() {
+        if (auto decoyCache = cache.lock())
+        {
+          decoyCache->finishRefill(generation, ec ? std::vector<outs_for_amount>() : refill->outs, refill->height);
+        }
+      });
+    });
+  }
+
   uint64_t WalletGreen::selectTransfers(
       uint64_t neededMoney,
       uint64_t dustThreshold,
-      const std::vector<WalletOuts> &wallets,
+      const std::vector<WalletRecord *> &wallets,
+      const std::set<uint64_t> &excludedAmounts,
       std::vector<OutputToTransfer> &selectedTransfers) const
   {
     uint64_t foundMoney = 0;
 
-    using OutputData = std::pair<WalletRecord *, TransactionOutputInformation>;
-    std::vector<OutputData> walletOuts;
-    std::unordered_map<uint64_t, std::vector<OutputData>> buckets;
+    /* Outputs of one wallet within one bucket, read in growing batches from the
+       container's amount index so only the outputs that get picked are copied. */
+    struct OutputQueue
+    {
+      WalletRecord *wallet;
+      std::vector<TransactionOutputInformation> outs;
+      size_t next;
+      bool exhausted;
+    };
 
-    for (const auto &wallet : wallets)
+    struct Bucket
     {
-      for (const auto &out : wallet.outs)
-      {
-        auto numberOfDigits = static_cast<int>(floor(log10(out.amount)) + 1);
+      uint64_t minAmount;
+      uint64_t maxAmount;
+      std::vector<OutputQueue> queues;
+    };
 
-        if (out.amount > dustThreshold)
+    /* Bucket by number of digits, ignoring dust */
+    std::vector<Bucket> buckets;
+    uint64_t bucketStart = 1;
+    for (int digits = 1; digits <= std::numeric_limits<uint64_t>::digits10 + 1; ++digits)
+    {
+      uint64_t bucketEnd = digits > std::numeric_limits<uint64_t>::digits10 ? std::numeric_limits<uint64_t>::max() : bucketStart * 10 - 1;
+      if (bucketEnd > dustThreshold)
+      {
+        Bucket bucket;
+        bucket.minAmount = std::max(bucketStart, dustThreshold + 1);
+        bucket.maxAmount = bucketEnd;
+        for (WalletRecord *wallet : wallets)
         {
-          buckets[numberOfDigits].emplace_back(
-              std::piecewise_construct,
-              std::forward_as_tuple(wallet.wallet),
-              std::forward_as_tuple(out));
+          bucket.queues.push_back(OutputQueue{wallet, {}, 0, false});
         }
+        buckets.push_back(std::move(bucket));
       }
+      bucketStart *= 10;
     }
 
-    while (foundMoney < neededMoney && !buckets.empty())
+    /* Containers can change between batches, never pick an output twice */
+    std::unordered_set<crypto::PublicKey> selectedKeys;
+
+    auto head = [&](const Bucket &bucket, OutputQueue &queue) -> const TransactionOutputInformation * {
+      for (;;)
+      {
+        for (; queue.next < queue.outs.size(); ++queue.next)
+        {
+          const TransactionOutputInformation &out = queue.outs[queue.next];
+          if (excludedAmounts.count(out.amount) == 0 && selectedKeys.count(out.outputKey) == 0)
+          {
+            return &out;
+          }
+        }
+
+        if (queue.exhausted)
+        {
+          return nullptr;
+        }
+
+        /* A larger batch starts with the outputs already passed over */
+        size_t count = std::max<size_t>(8, queue.outs.size() * 2);
+        queue.outs.clear();
+        queue.wallet->container->getOutputsByAmount(queue.outs, ITransfersContainer::IncludeKeyUnlocked, bucket.minAmount, bucket.maxAmount, count);
+        queue.exhausted = queue.outs.size() < count;
+      }
+    };
+
+    bool picked = true;
+    while (foundMoney < neededMoney && picked)
     {
-      /* Take one element from each bucket, smallest first. */
-      for (auto bucket = buckets.begin(); bucket != buckets.end();)
+      picked = false;
+
+      /* Take one output from each bucket, smallest bucket first. */
+      for (auto &bucket : buckets)
       {
-        /* Bucket has been exhausted, remove from list */
-        if (bucket->second.empty())
+        if (foundMoney >= neededMoney)
         {
-          bucket = buckets.erase(bucket);
+          break;
         }
-        else
+
+        OutputQueue *bestQueue = nullptr;
+        const TransactionOutputInformation *best = nullptr;
+        for (auto &queue : bucket.queues)
         {
-          /** Add the amount to the selected transfers so long as 
-           * foundMoney is still less than neededMoney. This prevents 
-           * larger outputs than we need when we already have enough funds */
-          if (foundMoney < neededMoney)
+          const TransactionOutputInformation *out = head(bucket, queue);
+          if (out != nullptr && (best == nullptr || out->amount < best->amount))
           {
-            auto out = bucket->second.back();
-            selectedTransfers.emplace_back(OutputToTransfer{std::move(out.second), std::move(out.first)});
-            foundMoney += out.second.amount;
+            bestQueue = &queue;
+            best = out;
           }
+        }
 
-          /* Remove amount we just added */
-          bucket->second.pop_back();
-          bucket++;
+        if (best == nullptr)
+        {
+          continue;
         }
+
+        selectedTransfers.emplace_back(OutputToTransfer{*best, bestQueue->wallet});
+        selectedKeys.insert(best->outputKey);
+        foundMoney += best->amount;
+        ++bestQueue->next;
+        picked = true;
       }
     }
+
     return foundMoney;
-  };
+  }
+
+  std::vector<WalletRecord *> WalletGreen::pickSpendingWallets(const std::vector<std::string> &addresses) const
+  {
+    std::vector<WalletRecord *> wallets;
+    if (addresses.empty())
+    {
+      for (const auto &wallet : m_walletsContainer.get<RandomAccessIndex>())
+      {
+        if (wallet.actualBalance != 0)
+        {
+          wallets.push_back(const_cast<WalletRecord *>(&wallet));
+        }
+      }
+    }
+    else
+    {
+      wallets.reserve(addresses.size());
+      for (const auto &address : addresses)
+      {
+        const auto &wallet = getWalletRecord(address);
+        if (wallet.actualBalance != 0)
+        {
+          wallets.push_back(const_cast<WalletRecord *>(&wallet));
+        }
+      }
+    }
+
+    return wallets;
+  }
 
   std::vector<WalletGreen::WalletOuts> WalletGreen::pickWalletsWithMoney() const
   {
@@ -3259,6 +3414,32 @@ namespace cn
     return getTransactionsInBlocks(blockIndex, count);
   }
 
+  std::vector<TransactionsInBlockInfo> WalletGreen::getTransactions(const crypto::Hash &blockHash, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const
+  {
+    throwIfNotInitialized();
+    throwIfStopped();
+
+    auto &hashIndex = m_blockchain.get<BlockHashIndex>();
+    auto it = hashIndex.find(blockHash);
+    if (it == hashIndex.end())
+    {
+      throw std::system_error(make_error_code(error::OBJECT_NOT_FOUND), "block not found");
+    }
+
+    auto heightIt = m_blockchain.project<BlockHeightIndex>(it);
+
+    auto blockIndex = static_cast<uint32_t>(std::distance(m_blockchain.get<BlockHeightIndex>().begin(), heightIt));
+    return getTransactionsInBlocks(blockIndex, count, filter, cursor);
+  }
+
+  std::vector<TransactionsInBlockInfo> WalletGreen::getTransactions(uint32_t blockIndex, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const
+  {
+    throwIfNotInitialized();
+    throwIfStopped();
+
+    return getTransactionsInBlocks(blockIndex, count, filter, cursor);
+  }
+
   std::vector<DepositsInBlockInfo> WalletGreen::getDeposits(uint32_t blockIndex, size_t count) const
   {
     throwIfNotInitialized();
@@ -3450,6 +3631,9 @@ namespace cn
 
     auto &blockHeightIndex = m_blockchain.get<BlockHeightIndex>();
     blockHeightIndex.erase(std::next(blockHeightIndex.begin(), blockIndex), blockHeightIndex.end());
+
+    // pooled decoys may come from the detached blocks
+    m_decoyCache->clear();
   }
 
   void WalletGreen::onTransactionDeleteBegin(const crypto::PublicKey &viewPublicKey, const crypto::Hash &transactionHash)
@@ -3903,6 +4087,7 @@ namespace cn
 
     updated |= updateTransactionTransfers(transactionId, containerAmountsList, -static_cast<int64_t>(transactionInfo.totalAmountIn),
                                           static_cast<int64_t>(transactionInfo.totalAmountOut));
+    updateTransactionPostings(transactionId);
 
     if (isNew)
     {
@@ -3992,6 +4177,7 @@ namespace cn
     if (updated)
     {
       auto transactionId = getTransactionId(transactionHash);
+      updateTransactionPostings(transactionId);
       pushEvent(makeTransactionUpdatedEvent(transactionId));
     }
   }
@@ -4695,6 +4881,91 @@ namespace cn
     return result;
   }
 
+  std::vector<TransactionsInBlockInfo> WalletGreen::getTransactionsInBlocks(uint32_t blockIndex, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const
+  {
+    if (count == 0)
+    {
+      throw std::system_error(make_error_code(error::WRONG_PARAMETERS), "blocks count must be greater than zero");
+    }
+
+    if (blockIndex >= m_blockchain.size())
+    {
+      throw std::system_error(make_error_code(error::OBJECT_NOT_FOUND), "block not found");
+    }
+
+    typedef WalletTransactionPostings::Position Position;
+
+    auto stopIndex = static_cast<uint32_t>(std::min<size_t>(m_blockchain.size(), blockIndex + count));
+    Position from = std::max(Position(blockIndex, 0), Position(cursor.blockIndex, cursor.transactionId));
+
+    std::vector<Position> positions;
+    if (filter.paymentId || !filter.addresses.empty())
+    {
+      positions = m_transactionPostings.find(filter.addresses, filter.paymentId.get_ptr(), from, stopIndex, filter.limit);
+    }
+    else
+    {
+      // nothing to look up, walk the blocks
+      auto &blockHeightIndex = m_transactions.get<BlockHeightIndex>();
+      auto &transactionIdIndex = m_transactions.get<RandomAccessIndex>();
+      for (uint32_t height = from.first; height < stopIndex && positions.size() < filter.limit; ++height)
+      {
+        std::vector<Position> blockPositions;
+        auto upperBound = blockHeightIndex.upper_bound(height);
+        for (auto it = blockHeightIndex.lower_bound(height); it != upperBound; ++it)
+        {
+          if (it->state == WalletTransactionState::SUCCEEDED)
+          {
+            auto transactionId = static_cast<size_t>(std::distance(transactionIdIndex.begin(), m_transactions.project<RandomAccessIndex>(it)));
+            blockPositions.emplace_back(height, transactionId);
+          }
+        }
+
+        std::sort(blockPositions.begin(), blockPositions.end());
+        for (const auto &position : blockPositions)
+        {
+          if (!(position < from) && positions.size() < filter.limit)
+          {
+            positions.push_back(position);
+          }
+        }
+      }
+    }
+
+    std::vector<TransactionsInBlockInfo> result;
+    auto &transactionIdIndex = m_transactions.get<RandomAccessIndex>();
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+      const Position &position = positions[i];
+      if (i == 0 || positions[i - 1].first != position.first)
+      {
+        TransactionsInBlockInfo info;
+        info.blockHash = m_blockchain[position.first];
+        result.emplace_back(std::move(info));
+      }
+
+      const WalletTransaction &walletTransaction = transactionIdIndex[position.second];
+      WalletTransactionWithTransfers transaction;
+      transaction.transaction = walletTransaction;
+      transaction.transfers = getTransactionTransfers(walletTransaction);
+
+      result.back().transactions.emplace_back(std::move(transaction));
+    }
+
+    if (!positions.empty() && positions.size() == filter.limit)
+    {
+      cursor.blockIndex = positions.back().first;
+      cursor.transactionId = positions.back().second + 1;
+    }
+    else
+    {
+      cursor.blockIndex = stopIndex;
+      cursor.transactionId = 0;
+    }
+
+    return result;
+  }
+
   crypto::Hash WalletGreen::getBlockHashByIndex(uint32_t blockIndex) const
   {
     assert(blockIndex < m_blockchain.size());
@@ -4895,15 +5166,7 @@ namespace cn
 
     cn::AccountPublicAddress changeDestination = getChangeDestination(sendingTransaction.changeDestination, sendingTransaction.sourceAddresses);
 
-    std::vector<WalletOuts> wallets;
-    if (!sendingTransaction.sourceAddresses.empty())
-    {
-      wallets = pickWallets(sendingTransaction.sourceAddresses);
-    }
-    else
-    {
-      wallets = pickWalletsWithMoney();
-    }
+    std::vector<WalletRecord *> wallets = pickSpendingWallets(sendingTransaction.sourceAddresses);
 
     PreparedTransaction preparedTransaction;
     crypto::SecretKey txSecretKey;
@@ -4956,45 +5219,54 @@ namespace cn
            transaction.totalAmount > 0 && !transaction.extra.empty();
   }
 
-  void WalletGreen::pushToPaymentsIndex(const crypto::Hash &paymentId, size_t txId)
+  void WalletGreen::updateTransactionPostings(size_t transactionId)
   {
-    m_paymentIds[paymentId].push_back(txId);
-  }
+    const WalletTransaction &transaction = m_transactions.get<RandomAccessIndex>()[transactionId];
+    if (transaction.state != WalletTransactionState::SUCCEEDED || transaction.blockHeight == WALLET_UNCONFIRMED_TRANSACTION_HEIGHT)
+    {
+      m_transactionPostings.remove(transactionId);
+      return;
+    }
 
-  void WalletGreen::buildPaymentIds()
-  {
-    size_t begin = 0;
-    size_t end = getTransactionCount();
-    std::vector<uint8_t> extra;
-    for (auto txId = begin; txId != end; ++txId)
+    std::vector<std::string> addresses;
+    auto bounds = getTransactionTransfersRange(transactionId);
+    for (auto it = bounds.first; it != bounds.second; ++it)
     {
-      const WalletTransaction& tx = getTransaction(txId);
-      PaymentId paymentId;
-      extra.insert(extra.begin(), tx.extra.begin(), tx.extra.end());
-      if (canInsertTransactionToIndex(tx) && getPaymentIdFromTxExtra(extra, paymentId))
+      if (!it->second.address.empty())
       {
-        pushToPaymentsIndex(paymentId, txId);
+        addresses.push_back(it->second.address);
       }
-      extra.clear();
+    }
+
+    PaymentId paymentId;
+    bool hasPaymentId = getPaymentIdFromTxExtra(common::asBinaryArray(transaction.extra), paymentId);
+    m_transactionPostings.update(transactionId, transaction.blockHeight, addresses, hasPaymentId ? &paymentId : nullptr);
+  }
+
+  void WalletGreen::rebuildTransactionPostings()
+  {
+    m_transactionPostings.clear();
+    for (size_t transactionId = 0; transactionId < m_transactions.size(); ++transactionId)
+    {
+      updateTransactionPostings(transactionId);
     }
   }
 
   std::vector<PaymentIdTransactions> WalletGreen::getTransactionsByPaymentIds(const std::vector<crypto::Hash> &paymentIds)
   {
-    buildPaymentIds();
     std::vector<PaymentIdTransactions> payments(paymentIds.size());
     auto payment = payments.begin();
     for (auto &key : paymentIds)
     {
       payment->paymentId = key;
-      auto it = m_paymentIds.find(key);
-      if (it != m_paymentIds.end())
+      auto positions = m_transactionPostings.find({}, &key, WalletTransactionPostings::Position(0, 0), WALLET_UNCONFIRMED_TRANSACTION_HEIGHT);
+      for (const auto &position : positions)
       {
-        std::transform(it->second.begin(), it->second.end(), std::back_inserter(payment->transactions),
-                       [this](size_t txId)
-                       {
-                         return getTransaction(txId);
-                       });
+        const WalletTransaction &transaction = m_transactions.get<RandomAccessIndex>()[position.second];
+        if (canInsertTransactionToIndex(transaction))
+        {
+          payment->transactions.push_back(transaction);
+        }
       }
 
       ++payment;
@@ -9,11 +9,16 @@
 
 #include "IWallet.h"
 
+#include <memory>
 #include <queue>
+#include <set>
 #include <unordered_map>
 
 #include "IFusionManager.h"
+#include "WalletCacheChunks.h"
+#include "WalletDecoyCache.h"
 #include "WalletIndices.h"
+#include "WalletTransactionPostings.h"
 #include "Common/StringOutputStream.h"
 #include "Logging/LoggerRef.h"
 #include <System/Dispatcher.h>
@@ -91,6 +96,8 @@ public:
 
   std::vector<TransactionsInBlockInfo> getTransactions(const crypto::Hash &blockHash, size_t count) const override;
   std::vector<TransactionsInBlockInfo> getTransactions(uint32_t blockIndex, size_t count) const override;
+  std::vector<TransactionsInBlockInfo> getTransactions(const crypto::Hash &blockHash, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const override;
+  std::vector<TransactionsInBlockInfo> getTransactions(uint32_t blockIndex, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const override;
   
   std::vector<DepositsInBlockInfo> getDeposits(const crypto::Hash &blockHash, size_t count) const override;
   std::vector<DepositsInBlockInfo> getDeposits(uint32_t blockIndex, size_t count) const override;
@@ -243,6 +250,7 @@ protected:
   std::vector<WalletOuts> pickWalletsWithMoney() const;
   WalletOuts pickWallet(const std::string &address) const;
   std::vector<WalletOuts> pickWallets(const std::vector<std::string> &addresses) const;
+  std::vector<WalletRecord *> pickSpendingWallets(const std::vector<std::string> &addresses) const;
 
   void updateBalance(cn::ITransfersContainer *container);
   void unlockBalances(uint32_t height);
@@ -268,7 +276,7 @@ protected:
     uint64_t changeAmount;
   };
 
-  void prepareTransaction(const std::vector<WalletOuts> &wallets,
+  void prepareTransaction(const std::vector<WalletRecord *> &wallets,
                           const std::vector<WalletOrder> &orders,
                           const std::vector<WalletMessage> &messages,
                           uint64_t fee,
@@ -291,6 +299,7 @@ protected:
   void requestMixinOuts(const std::vector<OutputToTransfer> &selectedTransfers,
                         uint64_t mixIn,
                         std::vector<outs_for_amount> &mixinResult);
+  void refillDecoys(const std::vector<uint64_t> &amounts);
 
   void prepareInputs(const std::vector<OutputToTransfer> &selectedTransfers,
                      std::vector<outs_for_amount> &mixinResult,
@@ -299,7 +308,8 @@ protected:
 
   uint64_t selectTransfers(uint64_t needeMoney,
                            uint64_t dustThreshold,
-                           const std::vector<WalletOuts> &wallets,
+                           const std::vector<WalletRecord *> &wallets,
+                           const std::set<uint64_t> &excludedAmounts,
                            std::vector<OutputToTransfer> &selectedTransfers) const;
 
   std::vector<ReceiverAmounts> splitDestinations(const std::vector<WalletTransfer> &destinations,
@@ -341,6 +351,7 @@ protected:
   void initTransactionPool();
   static void loadAndDecryptContainerData(ContainerStorage& storage, const crypto::chacha8_key& key, BinaryArray& containerData);
   static void encryptAndSaveContainerData(ContainerStorage& storage, const crypto::chacha8_key& key, const void* containerData, size_t containerDataSize);
+  static WalletCacheChunks::IvGenerator makeIvGenerator(ContainerStorage& storage);
   void loadWalletCache(std::unordered_set<crypto::PublicKey>& addedKeys, std::unordered_set<crypto::PublicKey>& deletedKeys, std::string& extra);
 
   void copyContainerStorageKeys(const ContainerStorage& src, const crypto::chacha8_key& srcKey, ContainerStorage& dst, const crypto::chacha8_key& dstKey) const;
@@ -375,6 +386,7 @@ protected:
 
   TransfersRange getTransactionTransfersRange(size_t transactionIndex) const;
   std::vector<TransactionsInBlockInfo> getTransactionsInBlocks(uint32_t blockIndex, size_t count) const;
+  std::vector<TransactionsInBlockInfo> getTransactionsInBlocks(uint32_t blockIndex, size_t count, const WalletTransactionFilter &filter, WalletTransactionCursor &cursor) const;
   std::vector<DepositsInBlockInfo> getDepositsInBlocks(uint32_t blockIndex, size_t count) const;
   crypto::Hash getBlockHashByIndex(uint32_t blockIndex) const;
 
@@ -387,8 +399,8 @@ protected:
   void deleteContainerFromUnlockTransactionJobs(const ITransfersContainer *container);
   std::vector<size_t> deleteTransfersForAddress(const std::string &address, std::vector<size_t> &deletedTransactions);
   void deleteFromUncommitedTransactions(const std::vector<size_t> &deletedTransactions);
-  void pushToPaymentsIndex(const crypto::Hash &paymentId, size_t txId);
-  void buildPaymentIds();
+  void updateTransactionPostings(size_t transactionId);
+  void rebuildTransactionPostings();
   std::vector<std::string> getMessagesFromExtra(const std::string &extra) const;
 
   cn::WalletEvent makeTransactionUpdatedEvent(size_t id);
@@ -407,6 +419,7 @@ private:
   WalletDeposits m_deposits;
   WalletsContainer m_walletsContainer;
   ContainerStorage m_containerStorage;
+  WalletCacheChunks m_cacheChunks;
   UnlockTransactionJobs m_unlockTransactionsJob;
   WalletTransactions m_transactions;
   WalletTransfers m_transfers;                               //sorted
@@ -440,7 +453,8 @@ private:
   uint32_t m_transactionSoftLockTime;
 
   BlockHashesContainer m_blockchain;
-  WalletPaymentIds m_paymentIds;
+  WalletTransactionPostings m_transactionPostings;
+  std::shared_ptr<WalletDecoyCache> m_decoyCache;
 };
 
 } //namespace cn
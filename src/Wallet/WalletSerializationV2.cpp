@@ -17,6 +17,8 @@
 
 #include "WalletSerializationV2.h"
 #include "IWallet.h"
+#include "Common/MemoryInputStream.h"
+#include "Common/StringOutputStream.h"
 #include "CryptoNoteCore/CryptoNoteSerialization.h"
 #include "Serialization/BinaryInputStreamSerializer.h"
 #include "Serialization/BinaryOutputStreamSerializer.h"
@@ -224,27 +226,83 @@ void WalletSerializerV2::load(common::IInputStream& source, uint8_t version) {
   s(m_extra, "extra");
 }
 
-void WalletSerializerV2::save(common::IOutputStream& destination, WalletSaveLevel saveLevel) {
-  cn::BinaryOutputStreamSerializer s(destination);
+void WalletSerializerV2::load(const WalletCacheChunk& chunk) {
+  common::MemoryInputStream source(chunk.data.data(), chunk.data.size());
+  cn::BinaryInputStreamSerializer s(source);
 
-  uint8_t saveLevelValue = static_cast<uint8_t>(saveLevel);
-  s(saveLevelValue, "saveLevel");
+  switch (chunk.type) {
+  case WalletCacheChunkType::STATE: {
+    uint8_t saveLevelValue;
+    s(saveLevelValue, "saveLevel");
+    WalletSaveLevel saveLevel = static_cast<WalletSaveLevel>(saveLevelValue);
 
-  saveKeyListAndBanalces(s, saveLevel == WalletSaveLevel::SAVE_ALL);
+    loadKeyListAndBanalces(s, saveLevel == WalletSaveLevel::SAVE_ALL);
 
-  if (saveLevel == WalletSaveLevel::SAVE_KEYS_AND_TRANSACTIONS || saveLevel == WalletSaveLevel::SAVE_ALL) {
-    saveTransactions(s);
-    saveTransfers(s);
-    saveDeposits(s);
+    if (saveLevel == WalletSaveLevel::SAVE_ALL) {
+      loadTransfersSynchronizer(s);
+      loadUnlockTransactionsJobs(s);
+      s(m_uncommitedTransactions, "uncommitedTransactions");
+    }
+
+    s(m_extra, "extra");
+    break;
   }
 
-  if (saveLevel == WalletSaveLevel::SAVE_ALL) {
-    saveTransfersSynchronizer(s);
-    saveUnlockTransactionsJobs(s);
-    s(m_uncommitedTransactions, "uncommitedTransactions");
+  case WalletCacheChunkType::TRANSACTIONS:
+    loadTransactions(s);
+    break;
+
+  case WalletCacheChunkType::TRANSFERS:
+    loadTransfers(s);
+    break;
+
+  case WalletCacheChunkType::DEPOSITS:
+    loadDeposits(s);
+    break;
+
+  default:
+    throw std::runtime_error("Unknown wallet cache chunk type");
   }
+}
 
-  s(m_extra, "extra");
+void WalletSerializerV2::save(std::vector<WalletCacheChunk>& chunks, WalletSaveLevel saveLevel) {
+  chunks.clear();
+  chunks.push_back({WalletCacheChunkType::STATE, 0, std::string()});
+
+  {
+    common::StringOutputStream destination(chunks.back().data);
+    cn::BinaryOutputStreamSerializer s(destination);
+
+    uint8_t saveLevelValue = static_cast<uint8_t>(saveLevel);
+    s(saveLevelValue, "saveLevel");
+
+    saveKeyListAndBanalces(s, saveLevel == WalletSaveLevel::SAVE_ALL);
+
+    if (saveLevel == WalletSaveLevel::SAVE_ALL) {
+      saveTransfersSynchronizer(s);
+      saveUnlockTransactionsJobs(s);
+      s(m_uncommitedTransactions, "uncommitedTransactions");
+    }
+
+    s(m_extra, "extra");
+  }
+
+  if (saveLevel == WalletSaveLevel::SAVE_KEYS_AND_TRANSACTIONS || saveLevel == WalletSaveLevel::SAVE_ALL) {
+    appendChunks(chunks, WalletCacheChunkType::TRANSACTIONS, m_transactions.size(), &WalletSerializerV2::saveTransactions);
+    appendChunks(chunks, WalletCacheChunkType::TRANSFERS, m_transfers.size(), &WalletSerializerV2::saveTransfers);
+    appendChunks(chunks, WalletCacheChunkType::DEPOSITS, m_deposits.size(), &WalletSerializerV2::saveDeposits);
+  }
+}
+
+void WalletSerializerV2::appendChunks(std::vector<WalletCacheChunk>& chunks, WalletCacheChunkType type, size_t count, RangeSaver saveRange) {
+  uint32_t index = 0;
+  for (size_t first = 0; first < count; first += WalletCacheChunks::RECORDS_PER_CHUNK) {
+    chunks.push_back({type, index++, std::string()});
+
+    common::StringOutputStream destination(chunks.back().data);
+    cn::BinaryOutputStreamSerializer s(destination);
+    (this->*saveRange)(s, first, std::min<size_t>(WalletCacheChunks::RECORDS_PER_CHUNK, count - first));
+  }
 }
 
 std::unordered_set<crypto::PublicKey>& WalletSerializerV2::addedKeys() {
@@ -380,22 +438,24 @@ void WalletSerializerV2::loadDeposits(cn::ISerializer& serializer) {
   }
 }
 
-void WalletSerializerV2::saveTransactions(cn::ISerializer& serializer) {
-  uint64_t count = m_transactions.size();
-  serializer(count, "transactionCount");
+void WalletSerializerV2::saveTransactions(cn::ISerializer& serializer, size_t first, size_t count) {
+  uint64_t transactionCount = count;
+  serializer(transactionCount, "transactionCount");
 
-  for (const auto& tx : m_transactions) {
-    WalletTransactionDtoV2 dto(tx);
+  auto& index = m_transactions.get<RandomAccessIndex>();
+  for (size_t i = first; i < first + count; ++i) {
+    WalletTransactionDtoV2 dto(index[i]);
     serializer(dto, "transaction");
   }
 }
 
-void WalletSerializerV2::saveDeposits(cn::ISerializer& serializer) {
-  uint64_t count = m_deposits.size();
-  serializer(count, "depositCount");
+void WalletSerializerV2::saveDeposits(cn::ISerializer& serializer, size_t first, size_t count) {
+  uint64_t depositCount = count;
+  serializer(depositCount, "depositCount");
 
-  for (const auto& tx : m_deposits) {
-    WalletDepositDtoV2 dto(tx);
+  auto& index = m_deposits.get<RandomAccessIndex>();
+  for (size_t i = first; i < first + count; ++i) {
+    WalletDepositDtoV2 dto(index[i]);
     serializer(dto, "deposit");
   }
 }
@@ -422,11 +482,12 @@ void WalletSerializerV2::loadTransfers(cn::ISerializer& serializer) {
   }
 }
 
-void WalletSerializerV2::saveTransfers(cn::ISerializer& serializer) {
-  uint64_t count = m_transfers.size();
-  serializer(count, "transferCount");
+void WalletSerializerV2::saveTransfers(cn::ISerializer& serializer, size_t first, size_t count) {
+  uint64_t transferCount = count;
+  serializer(transferCount, "transferCount");
 
-  for (const auto& kv : m_transfers) {
+  for (size_t i = first; i < first + count; ++i) {
+    const auto& kv = m_transfers[i];
     uint64_t txId = kv.first;
 
     WalletTransferDtoV2 tr(kv.second);
@@ -21,6 +21,7 @@
 #include "Common/IOutputStream.h"
 #include "Serialization/ISerializer.h"
 #include "Transfers/TransfersSynchronizer.h"
+#include "Wallet/WalletCacheChunks.h"
 #include "Wallet/WalletIndices.h"
 #include "IWallet.h"
 
@@ -47,27 +48,36 @@ public:
     uint32_t transactionSoftLockTime
   );
 
+  // whole cache written as one blob, versions before CHUNKED_CACHE_VERSION
   void load(common::IInputStream& source, uint8_t version);
-  void save(common::IOutputStream& destination, WalletSaveLevel saveLevel);
+
+  // the state chunk has to be loaded first, table chunks in index order
+  void load(const WalletCacheChunk& chunk);
+  void save(std::vector<WalletCacheChunk>& chunks, WalletSaveLevel saveLevel);
 
   std::unordered_set<crypto::PublicKey>& addedKeys();
   std::unordered_set<crypto::PublicKey>& deletedKeys();
 
   static const uint8_t MIN_VERSION = 6;
-  static const uint8_t SERIALIZATION_VERSION = 6;
+  static const uint8_t CHUNKED_CACHE_VERSION = 7;
+  static const uint8_t SERIALIZATION_VERSION = 7;
 
 private:
+  typedef void (WalletSerializerV2::*RangeSaver)(cn::ISerializer& serializer, size_t first, size_t count);
+
+  void appendChunks(std::vector<WalletCacheChunk>& chunks, WalletCacheChunkType type, size_t count, RangeSaver saveRange);
+
   void loadKeyListAndBanalces(cn::ISerializer& serializer, bool saveCache);
   void saveKeyListAndBanalces(cn::ISerializer& serializer, bool saveCache);
     
   void loadTransactions(cn::ISerializer& serializer);
-  void saveTransactions(cn::ISerializer& serializer);
+  void saveTransactions(cn::ISerializer& serializer, size_t first, size_t count);
 
   void loadDeposits(cn::ISerializer& serializer);
-  void saveDeposits(cn::ISerializer& serializer);
+  void saveDeposits(cn::ISerializer& serializer, size_t first, size_t count);
 
   void loadTransfers(cn::ISerializer& serializer);
-  void saveTransfers(cn::ISerializer& serializer);
+  void saveTransfers(cn::ISerializer& serializer, size_t first, size_t count);
 
   void loadTransfersSynchronizer(cn::ISerializer& serializer);
   void saveTransfersSynchronizer(cn::ISerializer& serializer);
@@ -0,0 +1,129 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "WalletTransactionPostings.h"
+
+#include <algorithm>
+
+namespace cn {
+
+void WalletTransactionPostings::clear() {
+  m_entries.clear();
+  m_addresses.clear();
+  m_paymentIds.clear();
+}
+
+void WalletTransactionPostings::update(size_t transactionId, uint32_t blockIndex, const std::vector<std::string>& addresses, const crypto::Hash* paymentId) {
+  remove(transactionId);
+
+  Entry entry;
+  entry.blockIndex = blockIndex;
+  entry.addresses = addresses;
+  std::sort(entry.addresses.begin(), entry.addresses.end());
+  entry.addresses.erase(std::unique(entry.addresses.begin(), entry.addresses.end()), entry.addresses.end());
+  entry.hasPaymentId = paymentId != nullptr;
+  entry.paymentId = paymentId != nullptr ? *paymentId : crypto::Hash();
+
+  Position position(blockIndex, transactionId);
+  for (const std::string& address : entry.addresses) {
+    m_addresses[address].insert(position);
+  }
+
+  if (entry.hasPaymentId) {
+    m_paymentIds[entry.paymentId].insert(position);
+  }
+
+  m_entries.emplace(transactionId, std::move(entry));
+}
+
+void WalletTransactionPostings::remove(size_t transactionId) {
+  auto it = m_entries.find(transactionId);
+  if (it == m_entries.end()) {
+    return;
+  }
+
+  const Entry& entry = it->second;
+  Position position(entry.blockIndex, transactionId);
+  for (const std::string& address : entry.addresses) {
+    auto postings = m_addresses.find(address);
+    postings->second.erase(position);
+    if (postings->second.empty()) {
+      m_addresses.erase(postings);
+    }
+  }
+
+  if (entry.hasPaymentId) {
+    auto postings = m_paymentIds.find(entry.paymentId);
+    postings->second.erase(position);
+    if (postings->second.empty()) {
+      m_paymentIds.erase(postings);
+    }
+  }
+
+  m_entries.erase(it);
+}
+
+std::vector<WalletTransactionPostings::Position> WalletTransactionPostings::find(const std::vector<std::string>& addresses, const crypto::Hash* paymentId,
+  Position from, uint32_t endBlockIndex, size_t limit) const {
+  std::vector<Position> positions;
+  Position end(endBlockIndex, 0);
+  if (limit == 0 || !(from < end)) {
+    return positions;
+  }
+
+  if (paymentId != nullptr) {
+    auto postings = m_paymentIds.find(*paymentId);
+    if (postings == m_paymentIds.end()) {
+      return positions;
+    }
+
+    for (auto it = postings->second.lower_bound(from); it != postings->second.end() && *it < end && positions.size() < limit; ++it) {
+      if (addresses.empty() || hasAnyAddress(m_entries.at(it->second), addresses)) {
+        positions.push_back(*it);
+      }
+    }
+
+    return positions;
+  }
+
+  // the first 'limit' positions of the union are among the first 'limit' of each list
+  for (const std::string& address : addresses) {
+    auto postings = m_addresses.find(address);
+    if (postings != m_addresses.end()) {
+      collect(postings->second, from, end, limit, positions);
+    }
+  }
+
+  std::sort(positions.begin(), positions.end());
+  positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+  if (positions.size() > limit) {
+    positions.resize(limit);
+  }
+
+  return positions;
+}
+
+size_t WalletTransactionPostings::size() const {
+  return m_entries.size();
+}
+
+void WalletTransactionPostings::collect(const Postings& postings, Position from, Position end, size_t limit, std::vector<Position>& positions) {
+  size_t collected = 0;
+  for (auto it = postings.lower_bound(from); it != postings.end() && *it < end && collected < limit; ++it, ++collected) {
+    positions.push_back(*it);
+  }
+}
+
+bool WalletTransactionPostings::hasAnyAddress(const Entry& entry, const std::vector<std::string>& addresses) {
+  for (const std::string& address : addresses) {
+    if (std::binary_search(entry.addresses.begin(), entry.addresses.end(), address)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}
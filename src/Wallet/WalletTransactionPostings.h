@@ -0,0 +1,63 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <limits>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "crypto/hash.h"
+
+namespace cn {
+
+/*
+  Postings of confirmed wallet transactions by transfer address and by payment id.
+  Every posting list is kept sorted by (block index, transaction id), so a filtered
+  query walks only the transactions it returns.
+*/
+class WalletTransactionPostings {
+public:
+  // block index, transaction id
+  typedef std::pair<uint32_t, size_t> Position;
+
+  void clear();
+
+  // Replaces whatever was indexed for the transaction
+  void update(size_t transactionId, uint32_t blockIndex, const std::vector<std::string>& addresses, const crypto::Hash* paymentId);
+  void remove(size_t transactionId);
+
+  // Positions in [from, (endBlockIndex, 0)) of transactions with a transfer to one of the addresses
+  // and, if paymentId is not null, carrying that payment id. Empty addresses match any transfer
+  // when paymentId is given and nothing otherwise
+  std::vector<Position> find(const std::vector<std::string>& addresses, const crypto::Hash* paymentId, Position from, uint32_t endBlockIndex,
+    size_t limit = std::numeric_limits<size_t>::max()) const;
+
+  size_t size() const;
+
+private:
+  struct Entry {
+    uint32_t blockIndex;
+    std::vector<std::string> addresses;
+    bool hasPaymentId;
+    crypto::Hash paymentId;
+  };
+
+  typedef std::set<Position> Postings;
+
+  static void collect(const Postings& postings, Position from, Position end, size_t limit, std::vector<Position>& positions);
+  static bool hasAnyAddress(const Entry& entry, const std::vector<std::string>& addresses);
+
+  std::unordered_map<size_t, Entry> m_entries;
+  std::unordered_map<std::string, Postings> m_addresses;
+  std::unordered_map<crypto::Hash, Postings, boost::hash<crypto::Hash>> m_paymentIds;
+};
+
+}
@@ -3,6 +3,8 @@
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <vector>
+
 #include "pow_hash/cn_slow_hash.hpp"
 #include "cryptonight.hpp"
 
@@ -33,4 +35,60 @@ void cn_conceal_slow_hash_v0(cn_context &context, const void *data, size_t lengt
 void cn_gpu_hash_v0(cn_context &context, const void *data, size_t length, Hash &hash) {
     context.cn_gpu_state.hash(data, length, reinterpret_cast<char *>(&hash));
 }
+
+namespace {
+
+template<bool SOFT_AES, cryptonight_algo ALGO>
+void cryptonight_hash_lanes(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		cryptonight_hash_multi<SOFT_AES, ALGO, 4>(data + i, length, hashes + i, contexts + i);
+	for (; i + 2 <= count; i += 2)
+		cryptonight_hash_multi<SOFT_AES, ALGO, 2>(data + i, length, hashes + i, contexts + i);
+	for (; i < count; ++i)
+		cryptonight_hash_multi<SOFT_AES, ALGO, 1>(data + i, length, hashes + i, contexts + i);
+}
+
+template<cryptonight_algo ALGO>
+void cryptonight_hash_lanes(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count) {
+	if(hw_check_aes())
+		cryptonight_hash_lanes<false, ALGO>(contexts, data, length, hashes, count);
+	else
+		cryptonight_hash_lanes<true, ALGO>(contexts, data, length, hashes, count);
+}
+
+}
+
+void cn_slow_hash_v0_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count) {
+	cryptonight_hash_lanes<CRYPTONIGHT>(contexts, data, length, hashes, count);
+}
+
+void cn_fast_slow_hash_v1_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count) {
+	cryptonight_hash_lanes<CRYPTONIGHT_FAST_V8>(contexts, data, length, hashes, count);
+}
+
+void cn_conceal_slow_hash_v0_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count) {
+	cryptonight_hash_lanes<CRYPTONIGHT_CONCEAL>(contexts, data, length, hashes, count);
+}
+
+void cn_gpu_hash_v0_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count) {
+	// the cn_gpu main loop is bound by its float arithmetic, not by scratchpad latency
+	for (size_t i = 0; i < count; ++i)
+		cn_gpu_hash_v0(*contexts[i], data[i], length, hashes[i]);
+}
+
+void cn_slow_hash_nonces(cn_context *const *contexts, cn_slow_hash_multi_fn hash_fn, const void *blob, size_t length, size_t nonce_offset,
+                         const uint32_t *nonces, size_t count, Hash *hashes) {
+	assert(nonce_offset + sizeof(uint32_t) <= length);
+	std::vector<uint8_t> lanes(count * length);
+	std::vector<const void *> data(count);
+	for (size_t i = 0; i < count; ++i) {
+		uint8_t *lane = lanes.data() + i * length;
+		memcpy(lane, blob, length);
+		memcpy(lane + nonce_offset, &nonces[i], sizeof(uint32_t));
+		data[i] = lane;
+	}
+
+	hash_fn(contexts, data.data(), length, hashes, count);
+}
 }
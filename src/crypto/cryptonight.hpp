@@ -238,8 +238,10 @@ inline __m128 _mm_set1_ps_epi32(uint32_t x)
 	return _mm_castsi128_ps(_mm_set1_epi32(x));
 }
 
-template<bool SOFT_AES, cryptonight_algo ALGO>
-void cryptonight_hash(const void* input, size_t len, void* output, cn_context& ctx0)
+// Hashes N equal length inputs in one pass, lane n in ctx[n]. The lanes are
+// independent, interleaving them lets their scratchpad accesses overlap.
+template<bool SOFT_AES, cryptonight_algo ALGO, size_t N>
+void cryptonight_hash_multi(const void* const* input, size_t len, Hash* output, cn_context* const* ctx)
 {
 	constexpr size_t MEMORY = cn_select_memory<ALGO>();
 	constexpr uint32_t MASK = cn_select_mask<ALGO>();
@@ -249,111 +251,135 @@ void cryptonight_hash(const void* input, size_t len, void* output, cn_context& c
 
 	if(MONERO_TWEAK && len < 43)
 	{
-		memset(output, 0, 32);
+		for(size_t n = 0; n < N; n++)
+			memset(&output[n], 0, 32);
 		return;
 	}
 
-	keccak((const uint8_t *)input, static_cast<uint8_t>(len), ctx0.hash_state, 200);
+	uint64_t mc[N];
+	uint8_t* l[N];
+	uint64_t al[N];
+	uint64_t ah[N];
+	__m128i bx[N];
+	__m128 conc_var[N];
+	uint64_t idx[N];
 
-	uint64_t mc0;
-	if(MONERO_TWEAK)
+	for(size_t n = 0; n < N; n++)
 	{
-		mc0  =  *reinterpret_cast<const uint64_t*>(reinterpret_cast<const uint8_t*>(input) + 35);
-		mc0 ^=  *(reinterpret_cast<const uint64_t*>(ctx0.hash_state) + 24);
-	}
+		keccak((const uint8_t *)input[n], static_cast<uint8_t>(len), ctx[n]->hash_state, 200);
+
+		if(MONERO_TWEAK)
+		{
+			mc[n]  =  *reinterpret_cast<const uint64_t*>(reinterpret_cast<const uint8_t*>(input[n]) + 35);
+			mc[n] ^=  *(reinterpret_cast<const uint64_t*>(ctx[n]->hash_state) + 24);
+		}
 
-	// Optim - 99% time boundary
-	cn_explode_scratchpad<SOFT_AES, MEMORY,ALGO>((__m128i*)ctx0.hash_state, (__m128i*)ctx0.long_state);
+		// Optim - 99% time boundary
+		cn_explode_scratchpad<SOFT_AES, MEMORY,ALGO>((__m128i*)ctx[n]->hash_state, (__m128i*)ctx[n]->long_state);
 
-	uint8_t* l0 = ctx0.long_state;
-	uint64_t* h0 = (uint64_t*)ctx0.hash_state;
+		l[n] = ctx[n]->long_state;
+		uint64_t* h = (uint64_t*)ctx[n]->hash_state;
 
-	uint64_t al0 = h0[0] ^ h0[4];
-	uint64_t ah0 = h0[1] ^ h0[5];
-	__m128i bx0 = _mm_set_epi64x(h0[3] ^ h0[7], h0[2] ^ h0[6]);
-	__m128 conc_var = _mm_setzero_ps();
+		al[n] = h[0] ^ h[4];
+		ah[n] = h[1] ^ h[5];
+		bx[n] = _mm_set_epi64x(h[3] ^ h[7], h[2] ^ h[6]);
+		conc_var[n] = _mm_setzero_ps();
+		idx[n] = h[0] ^ h[4];
+	}
 
-	uint64_t idx0 = h0[0] ^ h0[4];
 	// Optim - 90% time boundary
 	for(size_t i = 0; i < ITER; i++)
 	{
-		__m128i cx;
-		cx = _mm_load_si128((__m128i *)&l0[idx0 & MASK]);
-
-		if(CONC_VARIANT)
+		for(size_t n = 0; n < N; n++)
 		{
-			__m128 r = _mm_cvtepi32_ps(cx);
-			__m128 c_old = conc_var;
-			r = _mm_add_ps(r, conc_var);
-			r = _mm_mul_ps(r, _mm_mul_ps(r, r));
-			r = _mm_and_ps(_mm_set1_ps_epi32(0x807FFFFF), r);
-			r = _mm_or_ps(_mm_set1_ps_epi32(0x40000000), r);
-			conc_var = _mm_add_ps(conc_var, r);
-
-			c_old = _mm_and_ps(_mm_set1_ps_epi32(0x807FFFFF), c_old);
-			c_old = _mm_or_ps(_mm_set1_ps_epi32(0x40000000), c_old);
-			__m128 nc = _mm_mul_ps(c_old, _mm_set1_ps(536870880.0f));
-			cx = _mm_xor_si128(cx, _mm_cvttps_epi32(nc));
-		}
-
-		if(SOFT_AES) {
-			cx = soft_aesenc(cx, _mm_set_epi64x(ah0, al0));
-		} else {
-			#if !defined(ARM)
-				cx = _mm_aesenc_si128(cx, _mm_set_epi64x(ah0, al0));
-			#endif
+			__m128i cx;
+			cx = _mm_load_si128((__m128i *)&l[n][idx[n] & MASK]);
+
+			if(CONC_VARIANT)
+			{
+				__m128 r = _mm_cvtepi32_ps(cx);
+				__m128 c_old = conc_var[n];
+				r = _mm_add_ps(r, conc_var[n]);
+				r = _mm_mul_ps(r, _mm_mul_ps(r, r));
+				r = _mm_and_ps(_mm_set1_ps_epi32(0x807FFFFF), r);
+				r = _mm_or_ps(_mm_set1_ps_epi32(0x40000000), r);
+				conc_var[n] = _mm_add_ps(conc_var[n], r);
+
+				c_old = _mm_and_ps(_mm_set1_ps_epi32(0x807FFFFF), c_old);
+				c_old = _mm_or_ps(_mm_set1_ps_epi32(0x40000000), c_old);
+				__m128 nc = _mm_mul_ps(c_old, _mm_set1_ps(536870880.0f));
+				cx = _mm_xor_si128(cx, _mm_cvttps_epi32(nc));
+			}
+
+			if(SOFT_AES) {
+				cx = soft_aesenc(cx, _mm_set_epi64x(ah[n], al[n]));
+			} else {
+				#if !defined(ARM)
+					cx = _mm_aesenc_si128(cx, _mm_set_epi64x(ah[n], al[n]));
+				#endif
+			}
+
+			if(MONERO_TWEAK)
+				cryptonight_monero_tweak((uint64_t*)&l[n][idx[n] & MASK], _mm_xor_si128(bx[n], cx));
+			else
+				_mm_store_si128((__m128i *)&l[n][idx[n] & MASK], _mm_xor_si128(bx[n], cx));
+
+			idx[n] = _mm_cvtsi128_si64(cx);
+			bx[n] = cx;
+
+			uint64_t hi, lo, cl, ch;
+			cl = ((uint64_t*)&l[n][idx[n] & MASK])[0];
+			ch = ((uint64_t*)&l[n][idx[n] & MASK])[1];
+
+			lo = _umul128(idx[n], cl, &hi);
+			al[n] += hi;
+			ah[n] += lo;
+
+			((uint64_t*)&l[n][idx[n] & MASK])[0] = al[n];
+
+			if(MONERO_TWEAK)
+				((uint64_t*)&l[n][idx[n] & MASK])[1] = ah[n] ^ mc[n];
+			else
+				((uint64_t*)&l[n][idx[n] & MASK])[1] = ah[n];
+
+			ah[n] ^= ch;
+			al[n] ^= cl;
+			idx[n] = al[n];
 		}
-
-		if(MONERO_TWEAK)
-			cryptonight_monero_tweak((uint64_t*)&l0[idx0 & MASK], _mm_xor_si128(bx0, cx));
-		else
-			_mm_store_si128((__m128i *)&l0[idx0 & MASK], _mm_xor_si128(bx0, cx));
-
-		idx0 = _mm_cvtsi128_si64(cx);
-		bx0 = cx;
-
-		uint64_t hi, lo, cl, ch;
-		cl = ((uint64_t*)&l0[idx0 & MASK])[0];
-		ch = ((uint64_t*)&l0[idx0 & MASK])[1];
-
-		lo = _umul128(idx0, cl, &hi);
-		al0 += hi;
-		ah0 += lo;
-
-		((uint64_t*)&l0[idx0 & MASK])[0] = al0;
-
-		if(MONERO_TWEAK)
-			((uint64_t*)&l0[idx0 & MASK])[1] = ah0 ^ mc0;
-		else
-			((uint64_t*)&l0[idx0 & MASK])[1] = ah0;
-
-		ah0 ^= ch;
-		al0 ^= cl;
-		idx0 = al0;
 	}
 
-	// Optim - 90% time boundary
-	cn_implode_scratchpad<SOFT_AES, MEMORY,ALGO>((__m128i*)ctx0.long_state, (__m128i*)ctx0.hash_state);
+	for(size_t n = 0; n < N; n++)
+	{
+		// Optim - 90% time boundary
+		cn_implode_scratchpad<SOFT_AES, MEMORY,ALGO>((__m128i*)ctx[n]->long_state, (__m128i*)ctx[n]->hash_state);
 
-	// Optim - 99% time boundary
+		// Optim - 99% time boundary
 
-	keccakf((uint64_t*)ctx0.hash_state, 24);
+		keccakf((uint64_t*)ctx[n]->hash_state, 24);
 
-	switch(ctx0.hash_state[0] & 3)
-	{
-	case 0:
-		blake256_hash(ctx0.hash_state, (uint8_t*)output);
-		break;
-	case 1:
-		groestl_hash(ctx0.hash_state, (uint8_t*)output);
-		break;
-	case 2:
-		jh_hash(ctx0.hash_state, (uint8_t*)output);
-		break;
-	case 3:
-		skein_hash(ctx0.hash_state, (uint8_t*)output);
-		break;
+		switch(ctx[n]->hash_state[0] & 3)
+		{
+		case 0:
+			blake256_hash(ctx[n]->hash_state, (uint8_t*)&output[n]);
+			break;
+		case 1:
+			groestl_hash(ctx[n]->hash_state, (uint8_t*)&output[n]);
+			break;
+		case 2:
+			jh_hash(ctx[n]->hash_state, (uint8_t*)&output[n]);
+			break;
+		case 3:
+			skein_hash(ctx[n]->hash_state, (uint8_t*)&output[n]);
+			break;
+		}
 	}
 }
 
+template<bool SOFT_AES, cryptonight_algo ALGO>
+void cryptonight_hash(const void* input, size_t len, void* output, cn_context& ctx0)
+{
+	cn_context* ctx = &ctx0;
+	cryptonight_hash_multi<SOFT_AES, ALGO, 1>(&input, len, reinterpret_cast<Hash*>(output), &ctx);
+}
+
 }
\ No newline at end of file
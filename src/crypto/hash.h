@@ -11,8 +11,8 @@
 
 #include <CryptoTypes.h>
 #include "generic-ops.h"
-#include <boost/align/aligned_alloc.hpp>
 #include "pow_hash/cn_slow_hash.hpp"
+#include "scratchpad_pool.h"
 
 /* Standard Cryptonight */
 #define CN_PAGE_SIZE                    2097152
@@ -44,26 +44,33 @@ namespace crypto {
     return h;
   }
 
+  /*
+    Hashing context for the slow hashes. Its scratchpad comes from the shared
+    pool and all algorithm variants, cn_gpu included, hash in that one pad.
+  */
   class cn_context {
   public:
 
-    cn_context()
+    cn_context() :
+      pad(scratchpad_pool::instance().acquire()),
+      cn_gpu_state(cn_v3_hash_t::make_borrowed(pad.long_state, pad.hash_state)),
+      long_state(pad.long_state),
+      hash_state(pad.hash_state)
     {
-        long_state = (uint8_t*)boost::alignment::aligned_alloc(4096, CN_PAGE_SIZE);
-        hash_state = (uint8_t*)boost::alignment::aligned_alloc(4096, 4096);
     }
 
     ~cn_context()
     {
-        if(long_state != nullptr)
-            boost::alignment::aligned_free(long_state);
-        if(hash_state != nullptr)
-            boost::alignment::aligned_free(hash_state);
+        scratchpad_pool::instance().release(pad);
     }
 
     cn_context(const cn_context &) = delete;
     void operator=(const cn_context &) = delete;
 
+  private:
+    scratchpad pad;
+
+  public:
     cn_v3_hash_t cn_gpu_state;
     uint8_t* long_state = nullptr;
     uint8_t* hash_state = nullptr;
@@ -74,6 +81,27 @@ namespace crypto {
   void cn_conceal_slow_hash_v0(cn_context &context, const void *data, size_t length, Hash &hash);  
   void cn_gpu_hash_v0(cn_context &context, const void *data, size_t length, Hash &hash);  
 
+  typedef void (*cn_slow_hash_fn)(cn_context &context, const void *data, size_t length, Hash &hash);
+
+  /*
+    Throughput variants hashing `count` equal length inputs, lane i in its own
+    contexts[i]. Lanes are interleaved four or two at a time, so the memory
+    latency of one lane's scratchpad accesses overlaps with the others' work.
+  */
+  typedef void (*cn_slow_hash_multi_fn)(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count);
+
+  void cn_slow_hash_v0_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count);
+  void cn_fast_slow_hash_v1_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count);
+  void cn_conceal_slow_hash_v0_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count);
+  void cn_gpu_hash_v0_multi(cn_context *const *contexts, const void *const *data, size_t length, Hash *hashes, size_t count);
+
+  /*
+    Hashes `count` variants of a hashing blob, lane i with the 4-byte nonce at
+    nonce_offset replaced by nonces[i].
+  */
+  void cn_slow_hash_nonces(cn_context *const *contexts, cn_slow_hash_multi_fn hash_fn, const void *blob, size_t length, size_t nonce_offset,
+                           const uint32_t *nonces, size_t count, Hash *hashes);
+
   inline void tree_hash(const Hash *hashes, size_t count, Hash &root_hash) {
     tree_hash(reinterpret_cast<const char (*)[HASH_SIZE]>(hashes), count, reinterpret_cast<char *>(&root_hash));
   }
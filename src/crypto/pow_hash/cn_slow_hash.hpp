@@ -181,6 +181,12 @@ class cn_slow_hash
 		return cn_pow_hash_v3(t.lpad.as_void(), t.spad.as_void());
 	}
 
+	// Factory function for an object hashing in externally owned pads of at least MEMORY and 4096 bytes
+	static cn_slow_hash make_borrowed(void* lptr, void* sptr)
+	{
+		return cn_slow_hash(lptr, sptr);
+	}
+
 	cn_slow_hash& operator=(cn_slow_hash&& other) noexcept
 	{
 		if(this == &other)
@@ -0,0 +1,102 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "scratchpad_pool.h"
+
+#include <new>
+
+#include <boost/align/aligned_alloc.hpp>
+
+#include "hash.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace crypto {
+
+  scratchpad_pool& scratchpad_pool::instance() {
+    // never destroyed, contexts with static storage may release pads during exit
+    static scratchpad_pool* pool = new scratchpad_pool();
+    return *pool;
+  }
+
+  scratchpad scratchpad_pool::acquire() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_idle.empty()) {
+        scratchpad pad = m_idle.back();
+        m_idle.pop_back();
+        return pad;
+      }
+    }
+
+    return allocate();
+  }
+
+  void scratchpad_pool::release(const scratchpad& pad) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_idle.size() < MAX_IDLE_PADS) {
+        m_idle.push_back(pad);
+        return;
+      }
+    }
+
+    deallocate(pad);
+  }
+
+  size_t scratchpad_pool::idle_count() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idle.size();
+  }
+
+  scratchpad scratchpad_pool::allocate() {
+    scratchpad pad = {nullptr, nullptr, false};
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    void* mapping = mmap(nullptr, CN_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED) {
+      pad.long_state = static_cast<uint8_t*>(mapping);
+      pad.huge_page_mapping = true;
+    }
+#endif
+
+    if (pad.long_state == nullptr) {
+      // aligned to the huge page size so the kernel can back it with a single transparent huge page
+      pad.long_state = static_cast<uint8_t*>(boost::alignment::aligned_alloc(CN_PAGE_SIZE, CN_PAGE_SIZE));
+      if (pad.long_state == nullptr) {
+        throw std::bad_alloc();
+      }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      madvise(pad.long_state, CN_PAGE_SIZE, MADV_HUGEPAGE);
+#endif
+    }
+
+    pad.hash_state = static_cast<uint8_t*>(boost::alignment::aligned_alloc(4096, 4096));
+    if (pad.hash_state == nullptr) {
+      deallocate(pad);
+      throw std::bad_alloc();
+    }
+
+    return pad;
+  }
+
+  void scratchpad_pool::deallocate(const scratchpad& pad) {
+    if (pad.huge_page_mapping) {
+#if defined(__linux__)
+      munmap(pad.long_state, CN_PAGE_SIZE);
+#endif
+    } else if (pad.long_state != nullptr) {
+      boost::alignment::aligned_free(pad.long_state);
+    }
+
+    if (pad.hash_state != nullptr) {
+      boost::alignment::aligned_free(pad.hash_state);
+    }
+  }
+
+}
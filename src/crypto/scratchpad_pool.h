@@ -0,0 +1,53 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <mutex>
+#include <vector>
+
+namespace crypto {
+
+  /*
+    Scratchpad memory for the slow hashes: a CN_PAGE_SIZE long state and a
+    4096 byte hash state. All algorithm variants of a cn_context share it.
+  */
+  struct scratchpad {
+    uint8_t* long_state;
+    uint8_t* hash_state;
+    bool huge_page_mapping;
+  };
+
+  /*
+    Process wide pool of scratchpads. Long states come from a MAP_HUGETLB
+    mapping when huge pages are reserved, else from 2 MiB aligned memory
+    advised for transparent huge pages, else from plain aligned memory.
+    Released pads are kept for reuse, up to MAX_IDLE_PADS.
+  */
+  class scratchpad_pool {
+  public:
+    static const size_t MAX_IDLE_PADS = 16;
+
+    static scratchpad_pool& instance();
+
+    scratchpad acquire();
+    void release(const scratchpad& pad);
+
+    size_t idle_count();
+
+  private:
+    scratchpad_pool() = default;
+
+    static scratchpad allocate();
+    static void deallocate(const scratchpad& pad);
+
+    std::mutex m_mutex;
+    std::vector<scratchpad> m_idle;
+  };
+
+}
@@ -5,11 +5,15 @@
 
 #include <sstream>
 
+#include <boost/filesystem.hpp>
 #include <boost/variant/get.hpp>
 
 #include "Common/StringTools.h"
 #include "CryptoNoteCore/CryptoNoteFormatUtils.h"
+#include "CryptoNoteCore/CryptoNoteSerialization.h"
 #include "CryptoNoteCore/CryptoNoteTools.h"
+#include "Serialization/BinarySerializationTools.h"
+#include "Serialization/SerializationOverloads.h"
 
 namespace cn
 {
@@ -18,6 +22,7 @@ namespace chain_audit
   namespace
   {
     const uint64_t COINBASE_REWARD_OVERCLAIM_TOLERANCE = 10;
+    const uint8_t AUDIT_PROGRESS_VERSION = 1;
 
     Finding makeFinding(Severity severity, const std::string &code,
                         uint32_t height, uint32_t txIndex,
@@ -99,6 +104,70 @@ namespace chain_audit
     }
   }
 
+  void Finding::serialize(ISerializer &s)
+  {
+    uint8_t severityValue = static_cast<uint8_t>(severity);
+    s(severityValue, "severity");
+    if (severityValue > static_cast<uint8_t>(Severity::Critical))
+    {
+      throw std::runtime_error("invalid finding severity");
+    }
+    severity = static_cast<Severity>(severityValue);
+
+    s(code, "code");
+    s(height, "height");
+    s(txIndex, "txIndex");
+    s(outputIndex, "outputIndex");
+    s(blockHash, "blockHash");
+    s(txHash, "txHash");
+    s(message, "message");
+    s(hasAmountDelta, "hasAmountDelta");
+    s(actualAmount, "actualAmount");
+    s(expectedAmount, "expectedAmount");
+    s(deltaAmount, "deltaAmount");
+    s(consensusTolerance, "consensusTolerance");
+    s(consensusAccepted, "consensusAccepted");
+  }
+
+  void AuditProgress::serialize(ISerializer &s)
+  {
+    uint8_t version = AUDIT_PROGRESS_VERSION;
+    s(version, "version");
+    if (version != AUDIT_PROGRESS_VERSION)
+    {
+      throw std::runtime_error("unsupported audit progress version");
+    }
+
+    s(network, "network");
+    s(includeInfo, "includeInfo");
+    s(startHeight, "startHeight");
+    s(endHeight, "endHeight");
+    s(nextHeight, "nextHeight");
+    s(scannedBlocks, "scannedBlocks");
+    s(scannedTransactions, "scannedTransactions");
+    s(findings, "findings");
+  }
+
+  bool saveProgress(const std::string &fileName, const AuditProgress &progress)
+  {
+    // Write beside the target and rename, so an interrupted save leaves the
+    // previous checkpoint intact.
+    const std::string tempFileName = fileName + ".tmp";
+    if (!storeToBinaryFile(progress, tempFileName))
+    {
+      return false;
+    }
+
+    boost::system::error_code ec;
+    boost::filesystem::rename(tempFileName, fileName, ec);
+    return !ec;
+  }
+
+  bool loadProgress(const std::string &fileName, AuditProgress &progress)
+  {
+    return loadFromBinaryFile(progress, fileName);
+  }
+
   const char *severityName(Severity severity)
   {
     switch (severity)
@@ -11,6 +11,7 @@
 #include "CryptoNoteCore/CryptoNoteBasic.h"
 #include "CryptoNoteCore/Currency.h"
 #include "crypto/hash.h"
+#include "Serialization/ISerializer.h"
 
 namespace cn
 {
@@ -40,6 +41,8 @@ namespace chain_audit
     uint64_t deltaAmount = 0;
     uint64_t consensusTolerance = 0;
     bool consensusAccepted = false;
+
+    void serialize(ISerializer &s);
   };
 
   struct BlockAuditContext
@@ -54,6 +57,22 @@ namespace chain_audit
     bool collectInfoFindings = true;
   };
 
+  // Resumable state of a scan: every height below nextHeight has been audited
+  // and its findings are kept here in height order.
+  struct AuditProgress
+  {
+    std::string network;
+    bool includeInfo = false;
+    uint32_t startHeight = 0;
+    uint32_t endHeight = 0;
+    uint32_t nextHeight = 0;
+    uint64_t scannedBlocks = 0;
+    uint64_t scannedTransactions = 0;
+    std::vector<Finding> findings;
+
+    void serialize(ISerializer &s);
+  };
+
   const char *severityName(Severity severity);
   std::string outputTypeName(const TransactionOutputTarget &target);
   std::string inputTypeName(const TransactionInput &input);
@@ -72,5 +91,8 @@ namespace chain_audit
                   const std::vector<Transaction> &transactions,
                   const BlockAuditContext &context,
                   std::vector<Finding> &findings);
+
+  bool saveProgress(const std::string &fileName, const AuditProgress &progress);
+  bool loadProgress(const std::string &fileName, AuditProgress &progress);
 }
 }
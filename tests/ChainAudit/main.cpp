@@ -4,12 +4,14 @@
 #include "ChainAudit/ChainAudit.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <list>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 #include <boost/variant/get.hpp>
@@ -32,18 +34,32 @@ namespace
   {
     std::string dataDir;
     std::string outFile;
+    std::string checkpointFile;
     bool testnet = false;
     bool includeInfo = false;
     uint32_t startHeight = 0;
     uint32_t endHeight = 0;
+    uint32_t threads = 1;
+    uint32_t chunkSize = 1000;
+  };
+
+  struct ChunkResult
+  {
+    std::vector<cn::chain_audit::Finding> findings;
+    uint64_t scannedTransactions = 0;
+    bool failed = false;
+    std::string error;
   };
 
   void usage()
   {
     std::cout
         << "conceal-chain-audit --data-dir <path> [--start N] [--end N] [--testnet] [--include-info] [--out file]\n"
+        << "                    [--threads N] [--chunk N] [--checkpoint file]\n"
         << "\n"
         << "Read-only monetary scanner for local Conceal chain data.\n"
+        << "Blocks are audited by --threads workers in ranges of --chunk heights. With --checkpoint,\n"
+        << "progress is saved after every batch and a rerun with the same range resumes from it.\n"
         << "Classic SwappedVector data dirs only; refuses --data-dir that contains mdbx_blocks.\n";
   }
 
@@ -62,6 +78,7 @@ namespace
   {
     Config cfg;
     cfg.dataDir = tools::getDefaultDataDirectory(false);
+    cfg.threads = std::max(1u, std::thread::hardware_concurrency());
 
     for (int i = 1; i < argc; ++i)
     {
@@ -84,7 +101,8 @@ namespace
         cfg.includeInfo = true;
       }
       else if ((arg == "--data-dir" || arg == "--out" || arg == "--start" ||
-                arg == "--end") &&
+                arg == "--end" || arg == "--threads" || arg == "--chunk" ||
+                arg == "--checkpoint") &&
                i + 1 >= argc)
       {
         throw std::runtime_error(arg + " requires a value");
@@ -97,6 +115,24 @@ namespace
       {
         cfg.outFile = argv[++i];
       }
+      else if (arg == "--checkpoint")
+      {
+        cfg.checkpointFile = argv[++i];
+      }
+      else if (arg == "--threads")
+      {
+        if (!parseUint32(argv[++i], cfg.threads) || cfg.threads == 0)
+        {
+          throw std::runtime_error("invalid --threads value");
+        }
+      }
+      else if (arg == "--chunk")
+      {
+        if (!parseUint32(argv[++i], cfg.chunkSize) || cfg.chunkSize == 0)
+        {
+          throw std::runtime_error("invalid --chunk value");
+        }
+      }
       else if (arg == "--start")
       {
         if (!parseUint32(argv[++i], cfg.startHeight))
@@ -182,6 +218,14 @@ namespace
     return includeInfo || finding.severity != cn::chain_audit::Severity::Info;
   }
 
+  bool readBlockSummary(cn::core &core, uint32_t height, crypto::Hash &blockHash,
+                        size_t &blockSize, uint64_t &generatedCoins)
+  {
+    blockHash = core.getBlockIdByHeight(height);
+    return blockHash != cn::NULL_HASH && core.getBlockSize(blockHash, blockSize) &&
+           core.getAlreadyGeneratedCoins(blockHash, generatedCoins);
+  }
+
   bool vectorFromList(const std::list<cn::Transaction> &in,
                       std::vector<cn::Transaction> &out)
   {
@@ -238,6 +282,52 @@ namespace
       }
     }
   }
+
+  // Runs the per-block and per-transaction checks for one chunk. Cross-block
+  // state is already in the contexts, so chunks are independent of each other.
+  void auditChunk(cn::core &core, const cn::Currency &currency,
+                  const std::vector<cn::chain_audit::BlockAuditContext> &contexts,
+                  size_t begin, size_t end, ChunkResult &result)
+  {
+    try
+    {
+      for (size_t i = begin; i < end; ++i)
+      {
+        cn::chain_audit::BlockAuditContext context = contexts[i];
+        std::list<cn::Block> blocks;
+        std::list<cn::Transaction> txsList;
+        if (!core.get_blocks(context.height, 1, blocks, txsList) || blocks.empty())
+        {
+          result.failed = true;
+          result.error = "failed to read block " + std::to_string(context.height);
+          return;
+        }
+
+        std::vector<cn::Transaction> txs;
+        vectorFromList(txsList, txs);
+        const cn::Block &block = blocks.front();
+        context.cumulativeBlockSize = cn::chain_audit::cumulativeBlockSize(block, txs);
+
+        cn::chain_audit::auditBlock(currency, block, txs, context, result.findings);
+
+        if (context.inCheckpointZone && context.collectInfoFindings)
+        {
+          for (size_t t = 0; t < txs.size(); ++t)
+          {
+            auditCheckpointReferences(core, txs[t], context.height, static_cast<uint32_t>(t + 1),
+                                      context.blockHash, result.findings);
+          }
+        }
+
+        result.scannedTransactions += txs.size() + 1;
+      }
+    }
+    catch (const std::exception &e)
+    {
+      result.failed = true;
+      result.error = e.what();
+    }
+  }
 }
 
 int main(int argc, char **argv)
@@ -302,123 +392,140 @@ int main(int argc, char **argv)
       return 2;
     }
 
-    std::vector<size_t> recentBlockSizes;
-    recentBlockSizes.reserve(currency.rewardBlocksWindow());
+    cn::chain_audit::AuditProgress progress;
+    progress.network = cfg.testnet ? "testnet" : "mainnet";
+    progress.includeInfo = cfg.includeInfo;
+    progress.startHeight = cfg.startHeight;
+    progress.endHeight = endHeight;
+    progress.nextHeight = cfg.startHeight;
 
-    uint64_t previousGeneratedCoins = 0;
-    if (cfg.startHeight > 0)
+    if (!cfg.checkpointFile.empty() && std::ifstream(cfg.checkpointFile.c_str()).good())
     {
-      std::list<cn::Block> previousBlocks;
-      std::list<cn::Transaction> previousTxsList;
-      if (!core.get_blocks(cfg.startHeight - 1, 1, previousBlocks,
-                           previousTxsList) ||
-          previousBlocks.empty())
+      cn::chain_audit::AuditProgress saved;
+      if (!cn::chain_audit::loadProgress(cfg.checkpointFile, saved))
       {
-        std::cerr << "failed to read block " << (cfg.startHeight - 1)
-                  << std::endl;
+        std::cerr << "failed to load checkpoint " << cfg.checkpointFile << std::endl;
         return 2;
       }
-      const crypto::Hash previousBlockHash =
-          cn::get_block_hash(previousBlocks.front());
-      if (!core.getAlreadyGeneratedCoins(previousBlockHash,
-                                         previousGeneratedCoins))
+      if (saved.network != progress.network || saved.includeInfo != progress.includeInfo ||
+          saved.startHeight != progress.startHeight || saved.endHeight != progress.endHeight ||
+          saved.nextHeight < saved.startHeight || saved.nextHeight > saved.endHeight + 1)
       {
-        std::cerr << "failed to read emitted coins for block "
-                  << (cfg.startHeight - 1) << std::endl;
+        std::cerr << "checkpoint " << cfg.checkpointFile
+                  << " was written for a different scan, remove it to start over" << std::endl;
         return 2;
       }
+      progress = std::move(saved);
+      std::cerr << "resuming from height " << progress.nextHeight << std::endl;
     }
 
+    // Seed the cross-block state from the stored block cache: the emitted coins
+    // before the first height to scan and the sizes of the reward window.
+    uint64_t previousGeneratedCoins = 0;
+    std::vector<size_t> recentBlockSizes;
+    recentBlockSizes.reserve(currency.rewardBlocksWindow() + 1);
     const uint32_t medianSeedStart =
-        cfg.startHeight > currency.rewardBlocksWindow()
-            ? cfg.startHeight -
+        progress.nextHeight > currency.rewardBlocksWindow()
+            ? progress.nextHeight -
                   static_cast<uint32_t>(currency.rewardBlocksWindow())
             : 0;
-    for (uint32_t h = medianSeedStart; h < cfg.startHeight; ++h)
+    for (uint32_t h = medianSeedStart; h < progress.nextHeight; ++h)
     {
-      std::list<cn::Block> blocks;
-      std::list<cn::Transaction> txsList;
-      if (!core.get_blocks(h, 1, blocks, txsList) || blocks.empty())
+      crypto::Hash blockHash;
+      size_t blockSize = 0;
+      if (!readBlockSummary(core, h, blockHash, blockSize, previousGeneratedCoins))
       {
         std::cerr << "failed to read block " << h << std::endl;
         return 2;
       }
-      std::vector<cn::Transaction> txs;
-      vectorFromList(txsList, txs);
+      recentBlockSizes.push_back(blockSize);
+    }
 
-      recentBlockSizes.push_back(cn::chain_audit::cumulativeBlockSize(blocks.front(), txs));
-      if (recentBlockSizes.size() > currency.rewardBlocksWindow())
+    const uint64_t batchSize = static_cast<uint64_t>(cfg.chunkSize) * cfg.threads;
+    while (progress.nextHeight <= endHeight)
+    {
+      const uint32_t batchEnd = static_cast<uint32_t>(
+          std::min<uint64_t>(endHeight, progress.nextHeight + batchSize - 1));
+
+      // Sequential prefix pass: emitted coins and median sizes only need the
+      // stored per-block summaries, not the block bodies.
+      std::vector<cn::chain_audit::BlockAuditContext> contexts;
+      contexts.reserve(batchEnd - progress.nextHeight + 1);
+      for (uint32_t h = progress.nextHeight; h <= batchEnd; ++h)
       {
-        recentBlockSizes.erase(recentBlockSizes.begin());
+        cn::chain_audit::BlockAuditContext context;
+        size_t blockSize = 0;
+        if (!readBlockSummary(core, h, context.blockHash, blockSize, context.storedGeneratedCoins))
+        {
+          std::cerr << "failed to read block " << h << std::endl;
+          return 2;
+        }
+
+        std::vector<size_t> medianSource = recentBlockSizes;
+        context.height = h;
+        context.previousGeneratedCoins = previousGeneratedCoins;
+        context.medianBlockSize = common::medianValue(medianSource);
+        context.cumulativeBlockSize = blockSize;
+        context.inCheckpointZone = checkpointZoneEnd != 0 && h <= checkpointZoneEnd;
+        context.collectInfoFindings = cfg.includeInfo;
+        contexts.push_back(context);
+
+        previousGeneratedCoins = context.storedGeneratedCoins;
+        recentBlockSizes.push_back(blockSize);
+        if (recentBlockSizes.size() > currency.rewardBlocksWindow())
+        {
+          recentBlockSizes.erase(recentBlockSizes.begin());
+        }
       }
-    }
 
-    std::vector<cn::chain_audit::Finding> findings;
-    uint64_t scannedBlocks = 0;
-    uint64_t scannedTransactions = 0;
+      const size_t chunkCount = (contexts.size() + cfg.chunkSize - 1) / cfg.chunkSize;
+      std::vector<ChunkResult> results(chunkCount);
+      std::atomic<size_t> nextChunk(0);
+      auto worker = [&]()
+      {
+        for (size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+        {
+          const size_t begin = chunk * cfg.chunkSize;
+          const size_t end = std::min(contexts.size(), begin + cfg.chunkSize);
+          auditChunk(core, currency, contexts, begin, end, results[chunk]);
+        }
+      };
 
-    for (uint32_t h = cfg.startHeight; h <= endHeight; ++h)
-    {
-      std::list<cn::Block> blocks;
-      std::list<cn::Transaction> txsList;
-      if (!core.get_blocks(h, 1, blocks, txsList) || blocks.empty())
+      std::vector<std::thread> workers;
+      for (size_t i = 1; i < std::min<size_t>(cfg.threads, chunkCount); ++i)
       {
-        std::cerr << "failed to read block " << h << std::endl;
-        return 2;
+        workers.emplace_back(worker);
       }
-
-      std::vector<cn::Transaction> txs;
-      vectorFromList(txsList, txs);
-      const cn::Block &block = blocks.front();
-      const crypto::Hash blockHash = cn::get_block_hash(block);
-      uint64_t storedGeneratedCoins = 0;
-      if (!core.getAlreadyGeneratedCoins(blockHash, storedGeneratedCoins))
+      worker();
+      for (auto &thread : workers)
       {
-        std::cerr << "failed to read emitted coins for block " << h << std::endl;
-        return 2;
+        thread.join();
       }
 
-      std::vector<size_t> medianSource = recentBlockSizes;
-      const size_t medianBlockSize = common::medianValue(medianSource);
-      const size_t blockSize = cn::chain_audit::cumulativeBlockSize(block, txs);
-
-      cn::chain_audit::BlockAuditContext context;
-      context.height = h;
-      context.blockHash = blockHash;
-      context.previousGeneratedCoins = previousGeneratedCoins;
-      context.storedGeneratedCoins = storedGeneratedCoins;
-      context.medianBlockSize = medianBlockSize;
-      context.cumulativeBlockSize = blockSize;
-      context.inCheckpointZone = checkpointZoneEnd != 0 && h <= checkpointZoneEnd;
-      context.collectInfoFindings = cfg.includeInfo;
-
-      cn::chain_audit::auditBlock(currency, block, txs, context, findings);
-
-      if (context.inCheckpointZone && cfg.includeInfo)
+      for (auto &result : results)
       {
-        for (size_t i = 0; i < txs.size(); ++i)
+        if (result.failed)
         {
-          auditCheckpointReferences(core, txs[i], h, static_cast<uint32_t>(i + 1),
-                                    blockHash, findings);
+          std::cerr << result.error << std::endl;
+          return 2;
         }
+        progress.findings.insert(progress.findings.end(), result.findings.begin(), result.findings.end());
+        progress.scannedTransactions += result.scannedTransactions;
       }
+      progress.scannedBlocks += contexts.size();
+      progress.nextHeight = batchEnd + 1;
 
-      previousGeneratedCoins = storedGeneratedCoins;
-      recentBlockSizes.push_back(blockSize);
-      if (recentBlockSizes.size() > currency.rewardBlocksWindow())
+      if (!cfg.checkpointFile.empty() && !cn::chain_audit::saveProgress(cfg.checkpointFile, progress))
       {
-        recentBlockSizes.erase(recentBlockSizes.begin());
+        std::cerr << "failed to write checkpoint " << cfg.checkpointFile << std::endl;
+        return 2;
       }
-      ++scannedBlocks;
-      scannedTransactions += txs.size() + 1;
 
-      if (h % 10000 == 0)
-      {
-        std::cerr << "scanned height " << h << " / " << endHeight << "\r";
-      }
+      std::cerr << "scanned height " << batchEnd << " / " << endHeight << "\r";
     }
     std::cerr << std::endl;
 
+    const std::vector<cn::chain_audit::Finding> &findings = progress.findings;
     std::ostringstream report;
     report << "{\n"
            << "  \"tool\": \"conceal-chain-audit\",\n"
@@ -428,8 +535,8 @@ int main(int argc, char **argv)
            << "  \"end_height\": " << endHeight << ",\n"
            << "  \"chain_height\": " << chainHeight << ",\n"
            << "  \"checkpoint_zone_end\": " << checkpointZoneEnd << ",\n"
-           << "  \"blocks_scanned\": " << scannedBlocks << ",\n"
-           << "  \"transactions_scanned\": " << scannedTransactions << ",\n"
+           << "  \"blocks_scanned\": " << progress.scannedBlocks << ",\n"
+           << "  \"transactions_scanned\": " << progress.scannedTransactions << ",\n"
            << "  \"findings\": [\n";
 
     bool first = true;
@@ -17,6 +17,23 @@ using namespace std;
 typedef crypto::Hash chash;
 
 crypto::cn_context *context;
+crypto::cn_context *lanes[4];
+
+// Hashes the same input in every lane of the interleaved kernel, all lanes must agree
+static void slow_hash_lanes(const void *data, size_t length, char *hash, size_t count) {
+  const void *inputs[4];
+  chash results[4];
+  for (size_t i = 0; i < count; i++) {
+    inputs[i] = data;
+  }
+  crypto::cn_slow_hash_v0_multi(lanes, inputs, length, results, count);
+  for (size_t i = 1; i < count; i++) {
+    if (results[i] != results[0]) {
+      throw ios_base::failure("Interleaved lanes disagree");
+    }
+  }
+  *reinterpret_cast<chash *>(hash) = results[0];
+}
 
 extern "C" {
 #ifdef _MSC_VER
@@ -33,13 +50,21 @@ extern "C" {
   static void slow_hash(const void *data, size_t length, char *hash) {
     cn_slow_hash_v0(*context, data, length, *reinterpret_cast<chash *>(hash));
   }
+
+  static void slow_hash_2(const void *data, size_t length, char *hash) {
+    slow_hash_lanes(data, length, hash, 2);
+  }
+
+  static void slow_hash_4(const void *data, size_t length, char *hash) {
+    slow_hash_lanes(data, length, hash, 4);
+  }
 }
 
 extern "C" typedef void hash_f(const void *, size_t, char *);
 struct hash_func {
   const string name;
   hash_f &f;
-} hashes[] = {{"fast", crypto::cn_fast_hash}, {"slow", slow_hash}, {"tree", hash_tree}};
+} hashes[] = {{"fast", crypto::cn_fast_hash}, {"slow", slow_hash}, {"slow-2", slow_hash_2}, {"slow-4", slow_hash_4}, {"tree", hash_tree}};
 
 int main(int argc, char *argv[]) {
   hash_f *f;
@@ -66,6 +91,11 @@ int main(int argc, char *argv[]) {
   if (f == slow_hash) {
     context = new crypto::cn_context();
   }
+  if (f == slow_hash_2 || f == slow_hash_4) {
+    for (size_t i = 0; i < 4; i++) {
+      lanes[i] = new crypto::cn_context();
+    }
+  }
   input.open(argv[2], ios_base::in);
   for (;;) {
     ++test;
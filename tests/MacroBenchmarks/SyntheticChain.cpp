@@ -0,0 +1,237 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "SyntheticChain.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "CryptoNoteCore/CryptoNoteFormatUtils.h"
+#include "CryptoNoteCore/CryptoNoteTools.h"
+#include "CryptoNoteCore/TransactionExtra.h"
+
+using namespace cn;
+
+SyntheticChain::SyntheticChain(const Currency& currency, logging::ILogger& logger) :
+  m_currency(currency), m_logger(logger, "SyntheticChain"), m_generator(currency), m_random(0x636f6e6365616cULL) {
+}
+
+void SyntheticChain::generate(const SyntheticChainConfig& config) {
+  if (config.senderCount < 2) {
+    throw std::invalid_argument("at least two sender accounts are required");
+  }
+
+  const size_t funder = config.senderCount;
+  const size_t miner = config.senderCount + 1;
+
+  m_accounts.resize(config.senderCount + 2);
+  for (auto& account : m_accounts) {
+    account.generate();
+  }
+  m_unspent.assign(m_accounts.size(), std::vector<OwnedOutput>());
+
+  const Block& genesis = m_currency.genesisBlock();
+  std::vector<size_t> blockSizes;
+  m_generator.addBlock(genesis, 0, 0, blockSizes, 0);
+  registerTransaction(genesis.baseTransaction, 0, {});
+  m_lastBlock = genesis;
+
+  // The funder mines enough coins to pay every sender, then the miner buries
+  // those rewards until they are unlocked.
+  const size_t fundingBlocks = config.senderCount * 4;
+  for (size_t i = 0; i < fundingBlocks; ++i) {
+    makeNextBlock(funder, {});
+  }
+  for (size_t i = 0; i < m_currency.minedMoneyUnlockWindow(); ++i) {
+    makeNextBlock(miner, {});
+  }
+
+  uint64_t funds = 0;
+  for (const auto& output : m_unspent[funder]) {
+    funds += output.amount;
+  }
+
+  // Every transfer spends two outputs of the transfer amount, so give each sender
+  // twice as many outputs as it will send transactions.
+  const size_t transfers = config.blockCount * config.transactionsPerBlock + config.poolTransactions;
+  const size_t outputsPerSender = 2 * (transfers / config.senderCount + 1) + config.maxMixin;
+  const uint64_t fundingFees = m_currency.minimumFee() * config.senderCount;
+  m_transferAmount = 1;
+  while (m_transferAmount * 10 * outputsPerSender * config.senderCount + fundingFees <= funds) {
+    m_transferAmount *= 10;
+  }
+  if (m_transferAmount <= m_currency.minimumFee()) {
+    throw std::runtime_error("funding blocks do not cover the requested transfers");
+  }
+
+  for (size_t sender = 0; sender < config.senderCount; ++sender) {
+    std::vector<TransactionDestinationEntry> destinations(outputsPerSender,
+      TransactionDestinationEntry(m_transferAmount, m_accounts[sender].getAccountKeys().address));
+    PendingTransaction pending;
+    if (!makeTransaction(funder, destinations, 0, pending.transaction)) {
+      throw std::runtime_error("failed to construct funding transaction");
+    }
+    pending.owners = {funder, sender};
+    std::vector<PendingTransaction> transactions;
+    transactions.push_back(std::move(pending));
+    makeNextBlock(miner, std::move(transactions));
+  }
+
+  for (size_t height = 0; height < config.blockCount; ++height) {
+    std::vector<PendingTransaction> transactions;
+    for (size_t i = 0; i < config.transactionsPerBlock; ++i) {
+      size_t from = (height * config.transactionsPerBlock + i) % config.senderCount;
+      size_t to = (from + 1 + m_random() % (config.senderCount - 1)) % config.senderCount;
+      PendingTransaction pending;
+      if (makeTransfer(from, to, (height + i) % (config.maxMixin + 1), pending)) {
+        transactions.push_back(std::move(pending));
+      }
+    }
+    makeNextBlock(miner, std::move(transactions));
+  }
+
+  for (size_t i = 0; i < config.poolTransactions; ++i) {
+    size_t from = i % config.senderCount;
+    PendingTransaction pending;
+    if (makeTransfer(from, (from + 1) % config.senderCount, i % (config.maxMixin + 1), pending)) {
+      m_poolTransactions.push_back(std::move(pending.transaction));
+    }
+  }
+}
+
+void SyntheticChain::makeNextBlock(size_t minerOwner, std::vector<PendingTransaction>&& transactions) {
+  std::list<Transaction> transactionList;
+  for (const auto& pending : transactions) {
+    transactionList.push_back(pending.transaction);
+  }
+
+  Block block;
+  if (!m_generator.constructBlock(block, m_lastBlock, m_accounts[minerOwner], transactionList)) {
+    throw std::runtime_error("failed to construct block");
+  }
+
+  const uint32_t height = nextHeight();
+  registerTransaction(block.baseTransaction, height + static_cast<uint32_t>(m_currency.minedMoneyUnlockWindow()), {minerOwner});
+
+  std::vector<Transaction> blockTransactions;
+  blockTransactions.reserve(transactions.size());
+  for (auto& pending : transactions) {
+    registerTransaction(pending.transaction, height + 1, pending.owners);
+    blockTransactions.push_back(std::move(pending.transaction));
+  }
+
+  m_transactionCount += blockTransactions.size();
+  m_blocks.emplace_back(block, std::move(blockTransactions));
+  m_lastBlock = block;
+}
+
+void SyntheticChain::registerTransaction(const Transaction& transaction, uint32_t unlockHeight, const std::vector<size_t>& owners) {
+  crypto::PublicKey transactionKey = getTransactionPublicKeyFromExtra(transaction.extra);
+
+  std::vector<crypto::KeyDerivation> derivations(owners.size());
+  for (size_t i = 0; i < owners.size(); ++i) {
+    crypto::generate_key_derivation(transactionKey, m_accounts[owners[i]].getAccountKeys().viewSecretKey, derivations[i]);
+  }
+
+  for (size_t index = 0; index < transaction.outputs.size(); ++index) {
+    const TransactionOutput& output = transaction.outputs[index];
+    if (output.target.type() != typeid(KeyOutput)) {
+      continue;
+    }
+
+    const KeyOutput& keyOutput = boost::get<KeyOutput>(output.target);
+    auto& outputs = m_outputs[output.amount];
+    outputs.push_back({keyOutput.key, transactionKey, index, unlockHeight});
+
+    for (size_t i = 0; i < owners.size(); ++i) {
+      if (is_out_to_acc(m_accounts[owners[i]].getAccountKeys(), keyOutput, derivations[i], index)) {
+        m_unspent[owners[i]].push_back({output.amount, static_cast<uint32_t>(outputs.size() - 1)});
+        break;
+      }
+    }
+  }
+}
+
+bool SyntheticChain::makeTransaction(size_t from, const std::vector<TransactionDestinationEntry>& destinations, size_t mixin, Transaction& transaction) {
+  uint64_t needed = m_currency.minimumFee();
+  for (const auto& destination : destinations) {
+    needed += destination.amount;
+  }
+
+  const uint32_t height = nextHeight();
+  auto& unspent = m_unspent[from];
+  std::vector<size_t> selected;
+  uint64_t found = 0;
+  for (size_t i = 0; i < unspent.size() && found < needed; ++i) {
+    const OwnedOutput& owned = unspent[i];
+    const auto& outputs = m_outputs[owned.amount];
+    if (outputs[owned.globalIndex].unlockHeight > height || (mixin > 0 && owned.amount != m_transferAmount)) {
+      continue;
+    }
+
+    selected.push_back(i);
+    found += owned.amount;
+  }
+
+  if (found < needed) {
+    return false;
+  }
+
+  std::vector<TransactionSourceEntry> sources;
+  for (size_t i : selected) {
+    const OwnedOutput& owned = unspent[i];
+    const auto& outputs = m_outputs[owned.amount];
+    const GlobalOutput& real = outputs[owned.globalIndex];
+
+    std::vector<uint32_t> ring{owned.globalIndex};
+    for (size_t attempt = 0; ring.size() <= mixin && attempt < mixin * 8; ++attempt) {
+      uint32_t decoy = static_cast<uint32_t>(m_random() % outputs.size());
+      if (outputs[decoy].unlockHeight <= height && std::find(ring.begin(), ring.end(), decoy) == ring.end()) {
+        ring.push_back(decoy);
+      }
+    }
+    std::sort(ring.begin(), ring.end());
+
+    TransactionSourceEntry source;
+    for (uint32_t index : ring) {
+      if (index == owned.globalIndex) {
+        source.realOutput = source.outputs.size();
+      }
+      source.outputs.emplace_back(index, outputs[index].key);
+    }
+    source.realTransactionPublicKey = real.transactionKey;
+    source.realOutputIndexInTransaction = real.indexInTransaction;
+    source.amount = owned.amount;
+    sources.push_back(source);
+  }
+
+  std::vector<TransactionDestinationEntry> allDestinations(destinations);
+  if (found > needed) {
+    allDestinations.emplace_back(found - needed, m_accounts[from].getAccountKeys().address);
+  }
+
+  crypto::SecretKey transactionKey;
+  if (!constructTransaction(m_accounts[from].getAccountKeys(), sources, allDestinations, std::vector<uint8_t>(), transaction, 0, m_logger.getLogger(), transactionKey)) {
+    return false;
+  }
+
+  for (auto it = selected.rbegin(); it != selected.rend(); ++it) {
+    unspent.erase(unspent.begin() + *it);
+  }
+
+  return true;
+}
+
+bool SyntheticChain::makeTransfer(size_t from, size_t to, size_t mixin, PendingTransaction& pending) {
+  std::vector<TransactionDestinationEntry> destinations{
+    TransactionDestinationEntry(m_transferAmount, m_accounts[to].getAccountKeys().address)};
+
+  if (!makeTransaction(from, destinations, mixin, pending.transaction) &&
+      (mixin == 0 || !makeTransaction(from, destinations, 0, pending.transaction))) {
+    return false;
+  }
+
+  pending.owners = {from, to};
+  return true;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "CryptoNoteCore/Account.h"
+#include "CryptoNoteCore/Currency.h"
+#include "CryptoNoteCore/IBlock.h"
+#include "Logging/LoggerRef.h"
+
+#include "TestGenerator/TestGenerator.h"
+
+struct SyntheticChainConfig {
+  size_t blockCount = 200;
+  size_t transactionsPerBlock = 8;
+  size_t maxMixin = 4;
+  size_t senderCount = 16;
+  size_t poolTransactions = 200;
+};
+
+class SyntheticBlock : public cn::IBlock {
+public:
+  SyntheticBlock(const cn::Block& block, std::vector<cn::Transaction>&& transactions) :
+    m_block(block), m_transactions(std::move(transactions)) {
+  }
+
+  virtual const cn::Block& getBlock() const override { return m_block; }
+  virtual size_t getTransactionCount() const override { return m_transactions.size(); }
+  virtual const cn::Transaction& getTransaction(size_t index) const override { return m_transactions[index]; }
+
+private:
+  cn::Block m_block;
+  std::vector<cn::Transaction> m_transactions;
+};
+
+// Builds a chain on top of the currency genesis block with test_generator: a funder
+// mines coins and spreads them to a set of sender accounts, then every block carries
+// transfers between the senders with ring sizes from 1 to maxMixin + 1. Output global
+// indices are tracked incrementally, so generation stays linear in the chain length.
+class SyntheticChain {
+public:
+  SyntheticChain(const cn::Currency& currency, logging::ILogger& logger);
+
+  void generate(const SyntheticChainConfig& config);
+
+  const std::vector<SyntheticBlock>& blocks() const { return m_blocks; }
+  const std::vector<cn::Transaction>& poolTransactions() const { return m_poolTransactions; }
+  size_t transactionCount() const { return m_transactionCount; }
+  uint64_t transferAmount() const { return m_transferAmount; }
+
+private:
+  struct GlobalOutput {
+    crypto::PublicKey key;
+    crypto::PublicKey transactionKey;
+    size_t indexInTransaction;
+    uint32_t unlockHeight;
+  };
+
+  struct OwnedOutput {
+    uint64_t amount;
+    uint32_t globalIndex;
+  };
+
+  struct PendingTransaction {
+    cn::Transaction transaction;
+    std::vector<size_t> owners;
+  };
+
+  uint32_t nextHeight() const { return static_cast<uint32_t>(m_blocks.size() + 1); }
+  void makeNextBlock(size_t minerOwner, std::vector<PendingTransaction>&& transactions);
+  void registerTransaction(const cn::Transaction& transaction, uint32_t unlockHeight, const std::vector<size_t>& owners);
+  bool makeTransaction(size_t from, const std::vector<cn::TransactionDestinationEntry>& destinations, size_t mixin, cn::Transaction& transaction);
+  bool makeTransfer(size_t from, size_t to, size_t mixin, PendingTransaction& pending);
+
+  const cn::Currency& m_currency;
+  logging::LoggerRef m_logger;
+  test_generator m_generator;
+  std::mt19937_64 m_random;
+  cn::Block m_lastBlock;
+  // senders first, then the funder and the miner
+  std::vector<cn::AccountBase> m_accounts;
+  std::map<uint64_t, std::vector<GlobalOutput>> m_outputs;
+  std::vector<std::vector<OwnedOutput>> m_unspent;
+  std::vector<SyntheticBlock> m_blocks;
+  std::vector<cn::Transaction> m_poolTransactions;
+  size_t m_transactionCount = 0;
+  uint64_t m_transferAmount = 0;
+};
@@ -0,0 +1,486 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include "Common/CommandLine.h"
+#include "Common/JsonValue.h"
+#include "Common/StringTools.h"
+#include "CryptoNoteCore/CoreConfig.h"
+#include "CryptoNoteCore/Core.h"
+#include "CryptoNoteCore/CryptoNoteFormatUtils.h"
+#include "CryptoNoteCore/CryptoNoteTools.h"
+#include "CryptoNoteCore/MinerConfig.h"
+#include "CryptoNoteCore/TransactionApi.h"
+#include "CryptoNoteCore/UpgradeDetector.h"
+#include "CryptoNoteProtocol/CryptoNoteProtocolHandlerCommon.h"
+#include "Logging/ConsoleLogger.h"
+#include "Rpc/CoreRpcServerCommandsDefinitions.h"
+#include "Serialization/SerializationTools.h"
+#include "Transfers/CommonTypes.h"
+#include "Transfers/TransfersConsumer.h"
+
+#include "SyntheticChain.h"
+#include "version.h"
+
+using namespace cn;
+using common::JsonValue;
+
+namespace po = boost::program_options;
+
+namespace {
+
+const command_line::arg_descriptor<size_t> arg_blocks = {"blocks", "Number of transfer blocks in the synthetic chain", 200};
+const command_line::arg_descriptor<size_t> arg_txs_per_block = {"txs-per-block", "Transfers per block", 8};
+const command_line::arg_descriptor<size_t> arg_max_mixin = {"max-mixin", "Maximum mixin of generated transfers", 4};
+const command_line::arg_descriptor<size_t> arg_senders = {"senders", "Number of sending accounts", 16};
+const command_line::arg_descriptor<size_t> arg_pool_txs = {"pool-txs", "Transactions kept out of the chain for the pool benchmark", 200};
+const command_line::arg_descriptor<size_t> arg_iterations = {"iterations", "Repetitions of each latency measurement", 50};
+const command_line::arg_descriptor<size_t> arg_scan_blocks = {"scan-blocks", "Blocks scanned by the TransfersConsumer benchmark", 50};
+const command_line::arg_descriptor<std::vector<size_t>> arg_view_keys = {"view-keys", "View key counts for the TransfersConsumer benchmark (default 1 100 1000)"};
+const command_line::arg_descriptor<std::string> arg_data_dir = {"data-dir", "Scratch directory for the benchmark blockchain", ""};
+const command_line::arg_descriptor<std::string> arg_output = {"output", "Write JSON results to this file instead of stdout", ""};
+
+const size_t ADD_CHAIN_BATCH_SIZE = 128;
+
+typedef std::chrono::steady_clock Clock;
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+JsonValue makeRate(size_t count, double seconds, const std::string& unit) {
+  JsonValue result(JsonValue::OBJECT);
+  result.insert("count", static_cast<JsonValue::Integer>(count));
+  result.insert("seconds", seconds);
+  result.insert(unit + "PerSecond", seconds > 0 ? count / seconds : 0.0);
+  return result;
+}
+
+JsonValue makeLatency(size_t iterations, double seconds) {
+  JsonValue result(JsonValue::OBJECT);
+  result.insert("iterations", static_cast<JsonValue::Integer>(iterations));
+  result.insert("averageMs", iterations > 0 ? seconds * 1000 / iterations : 0.0);
+  return result;
+}
+
+// TransfersConsumer only calls the node for outputs that belong to a subscription,
+// which the randomly generated view keys never own.
+class NodeStub : public INode {
+public:
+  virtual bool addObserver(INodeObserver* observer) override { return true; }
+  virtual bool removeObserver(INodeObserver* observer) override { return true; }
+  virtual void init(const Callback& callback) override { callback(std::error_code()); }
+  virtual bool shutdown() override { return true; }
+
+  virtual size_t getPeerCount() const override { return 0; }
+  virtual uint32_t getLastLocalBlockHeight() const override { return 0; }
+  virtual uint32_t getLastKnownBlockHeight() const override { return 0; }
+  virtual uint32_t getLocalBlockCount() const override { return 0; }
+  virtual uint32_t getKnownBlockCount() const override { return 0; }
+  virtual uint64_t getLastLocalBlockTimestamp() const override { return 0; }
+
+  virtual void relayTransaction(const Transaction& transaction, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getRandomOutsByAmounts(std::vector<uint64_t>&& amounts, uint64_t outsCount, std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getRandomOutsBulk(std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts, std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result, uint32_t& height, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getNewBlocks(std::vector<crypto::Hash>&& knownBlockIds, std::vector<block_complete_entry>& newBlocks, uint32_t& startHeight, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getTransactionOutsGlobalIndices(const crypto::Hash& transactionHash, std::vector<uint32_t>& outsGlobalIndices, const Callback& callback) override { callback(std::error_code()); }
+  virtual void queryBlocks(std::vector<crypto::Hash>&& knownBlockIds, uint64_t timestamp, std::vector<BlockShortEntry>& newBlocks, uint32_t& startHeight, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getPoolSymmetricDifference(std::vector<crypto::Hash>&& knownPoolTxIds, crypto::Hash knownBlockId, bool& isBcActual, std::vector<std::unique_ptr<ITransactionReader>>& newTxs, std::vector<crypto::Hash>& deletedTxIds, const Callback& callback) override { isBcActual = true; callback(std::error_code()); }
+  virtual void getMultisignatureOutputByGlobalIndex(uint64_t amount, uint32_t gindex, MultisignatureOutput& out, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getTransaction(const crypto::Hash& transactionHash, Transaction& transaction, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getBlocks(const std::vector<uint32_t>& blockHeights, std::vector<std::vector<BlockDetails>>& blocks, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getBlocks(const std::vector<crypto::Hash>& blockHashes, std::vector<BlockDetails>& blocks, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getBlocks(uint64_t timestampBegin, uint64_t timestampEnd, uint32_t blocksNumberLimit, std::vector<BlockDetails>& blocks, uint32_t& blocksNumberWithinTimestamps, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getTransactions(const std::vector<crypto::Hash>& transactionHashes, std::vector<TransactionDetails>& transactions, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getTransactionsByPaymentId(const crypto::Hash& paymentId, std::vector<TransactionDetails>& transactions, const Callback& callback) override { callback(std::error_code()); }
+  virtual void getPoolTransactions(uint64_t timestampBegin, uint64_t timestampEnd, uint32_t transactionsNumberLimit, std::vector<TransactionDetails>& transactions, uint64_t& transactionsNumberWithinTimestamps, const Callback& callback) override { callback(std::error_code()); }
+  virtual void isSynchronized(bool& syncStatus, const Callback& callback) override { syncStatus = true; callback(std::error_code()); }
+};
+
+JsonValue benchmarkAddChain(core& node, const SyntheticChain& chain) {
+  const auto& blocks = chain.blocks();
+  size_t added = 0;
+
+  auto start = Clock::now();
+  for (size_t offset = 0; offset < blocks.size(); offset += ADD_CHAIN_BATCH_SIZE) {
+    std::vector<const IBlock*> batch;
+    for (size_t i = offset; i < std::min(blocks.size(), offset + ADD_CHAIN_BATCH_SIZE); ++i) {
+      batch.push_back(&blocks[i]);
+    }
+
+    size_t batchAdded = node.addChain(batch);
+    added += batchAdded;
+    if (batchAdded != batch.size()) {
+      throw std::runtime_error("core::addChain rejected a synthetic block");
+    }
+  }
+  double seconds = secondsSince(start);
+
+  JsonValue result = makeRate(added, seconds, "blocks");
+  result.insert("transactions", static_cast<JsonValue::Integer>(chain.transactionCount()));
+  result.insert("transactionsPerSecond", seconds > 0 ? chain.transactionCount() / seconds : 0.0);
+  return result;
+}
+
+JsonValue benchmarkQueryBlocksLite(core& node, size_t iterations) {
+  std::vector<crypto::Hash> knownBlockIds{node.getBlockIdByHeight(0)};
+  size_t entriesCount = 0;
+
+  auto start = Clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    uint32_t startHeight;
+    uint32_t currentHeight;
+    uint32_t fullOffset;
+    std::vector<BlockShortInfo> entries;
+    if (!node.queryBlocksLite(knownBlockIds, 0, startHeight, currentHeight, fullOffset, entries)) {
+      throw std::runtime_error("queryBlocksLite failed");
+    }
+    entriesCount = entries.size();
+  }
+
+  JsonValue result = makeLatency(iterations, secondsSince(start));
+  result.insert("entries", static_cast<JsonValue::Integer>(entriesCount));
+  return result;
+}
+
+template <typename T>
+JsonValue benchmarkDecode(const T& value, size_t iterations) {
+  std::string payload = storeToBinaryKeyValue(value);
+
+  auto start = Clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    T decoded;
+    if (!loadFromBinaryKeyValue(decoded, payload)) {
+      throw std::runtime_error("failed to decode KV binary payload");
+    }
+  }
+
+  JsonValue result = makeLatency(iterations, secondsSince(start));
+  result.insert("payloadBytes", static_cast<JsonValue::Integer>(payload.size()));
+  return result;
+}
+
+// Decoding of the portable storage payloads of /getblocks.bin and /queryblockslite.bin
+JsonValue benchmarkKvDecode(core& node, const SyntheticChain& chain, size_t iterations) {
+  COMMAND_RPC_GET_BLOCKS_FAST::response blocksResponse;
+  for (const SyntheticBlock& block : chain.blocks()) {
+    if (blocksResponse.blocks.size() == COMMAND_RPC_GET_BLOCKS_FAST_MAX_COUNT) {
+      break;
+    }
+
+    block_complete_entry entry;
+    entry.block = common::asString(toBinaryArray(block.getBlock()));
+    for (size_t t = 0; t < block.getTransactionCount(); ++t) {
+      entry.txs.push_back(common::asString(toBinaryArray(block.getTransaction(t))));
+    }
+    blocksResponse.blocks.push_back(std::move(entry));
+  }
+
+  COMMAND_RPC_QUERY_BLOCKS_LITE::response liteResponse;
+  std::vector<crypto::Hash> knownBlockIds{node.getBlockIdByHeight(0)};
+  uint32_t startHeight;
+  uint32_t currentHeight;
+  uint32_t fullOffset;
+  if (!node.queryBlocksLite(knownBlockIds, 0, startHeight, currentHeight, fullOffset, liteResponse.items)) {
+    throw std::runtime_error("queryBlocksLite failed");
+  }
+  liteResponse.startHeight = startHeight;
+  liteResponse.currentHeight = currentHeight;
+  liteResponse.fullOffset = fullOffset;
+  liteResponse.status = CORE_RPC_STATUS_OK;
+
+  JsonValue result(JsonValue::OBJECT);
+  result.insert("getBlocksFast", benchmarkDecode(blocksResponse, iterations));
+  result.insert("queryBlocksLite", benchmarkDecode(liteResponse, iterations));
+  return result;
+}
+
+// Binary encoding and decoding of the chain's blocks and transactions, as done for storage and relay
+JsonValue benchmarkBinaryRoundTrip(const SyntheticChain& chain, size_t iterations) {
+  std::vector<BinaryArray> blockBlobs;
+  std::vector<BinaryArray> transactionBlobs;
+  size_t bytes = 0;
+  auto start = Clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    blockBlobs.clear();
+    transactionBlobs.clear();
+    bytes = 0;
+    for (const SyntheticBlock& block : chain.blocks()) {
+      blockBlobs.push_back(toBinaryArray(block.getBlock()));
+      bytes += blockBlobs.back().size();
+      for (size_t t = 0; t < block.getTransactionCount(); ++t) {
+        transactionBlobs.push_back(toBinaryArray(block.getTransaction(t)));
+        bytes += transactionBlobs.back().size();
+      }
+    }
+  }
+  double encodeSeconds = secondsSince(start);
+
+  start = Clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    for (const BinaryArray& blob : blockBlobs) {
+      Block block;
+      if (!fromBinaryArray(block, blob)) {
+        throw std::runtime_error("failed to decode block");
+      }
+    }
+
+    for (const BinaryArray& blob : transactionBlobs) {
+      Transaction transaction;
+      if (!fromBinaryArray(transaction, blob)) {
+        throw std::runtime_error("failed to decode transaction");
+      }
+    }
+  }
+  double decodeSeconds = secondsSince(start);
+
+  JsonValue result(JsonValue::OBJECT);
+  result.insert("blocks", static_cast<JsonValue::Integer>(blockBlobs.size()));
+  result.insert("transactions", static_cast<JsonValue::Integer>(transactionBlobs.size()));
+  result.insert("bytes", static_cast<JsonValue::Integer>(bytes));
+  result.insert("encode", makeLatency(iterations, encodeSeconds));
+  result.insert("decode", makeLatency(iterations, decodeSeconds));
+  return result;
+}
+
+JsonValue benchmarkRandomOuts(core& node, const SyntheticChain& chain, size_t outsCount, size_t iterations) {
+  COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_request request;
+  request.amounts.push_back(chain.transferAmount());
+  request.outs_count = outsCount;
+
+  auto start = Clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_response response;
+    if (!node.get_random_outs_for_amounts(request, response)) {
+      throw std::runtime_error("getRandomOutsByAmount failed");
+    }
+  }
+
+  JsonValue result = makeLatency(iterations, secondsSince(start));
+  result.insert("outsCount", static_cast<JsonValue::Integer>(outsCount));
+  return result;
+}
+
+JsonValue benchmarkBlockTemplate(core& node, const SyntheticChain& chain, size_t iterations) {
+  const auto& transactions = chain.poolTransactions();
+  AccountBase miner;
+  miner.generate();
+
+  JsonValue results(JsonValue::ARRAY);
+  size_t added = 0;
+  std::vector<size_t> poolSizes{0, transactions.size() / 8, transactions.size() / 4, transactions.size() / 2, transactions.size()};
+  for (size_t poolSize : poolSizes) {
+    for (; added < poolSize; ++added) {
+      tx_verification_context tvc = boost::value_initialized<tx_verification_context>();
+      node.handle_incoming_tx(toBinaryArray(transactions[added]), tvc, false);
+    }
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+      Block block;
+      difficulty_type difficulty;
+      uint32_t height;
+      if (!node.get_block_template(block, miner.getAccountKeys().address, difficulty, height, BinaryArray())) {
+        throw std::runtime_error("get_block_template failed");
+      }
+    }
+
+    JsonValue result = makeLatency(iterations, secondsSince(start));
+    result.insert("poolSize", static_cast<JsonValue::Integer>(node.get_pool_transactions_count()));
+    results.pushBack(result);
+  }
+
+  return results;
+}
+
+JsonValue benchmarkTransfersConsumer(const Currency& currency, logging::ILogger& logger, const SyntheticChain& chain,
+                                     size_t scanBlocks, const std::vector<size_t>& viewKeyCounts) {
+  const auto& blocks = chain.blocks();
+  scanBlocks = std::min(scanBlocks, blocks.size());
+  const uint32_t startHeight = static_cast<uint32_t>(blocks.size() - scanBlocks + 1);
+
+  std::vector<CompleteBlock> completeBlocks(scanBlocks);
+  size_t transactionCount = 0;
+  for (size_t i = 0; i < scanBlocks; ++i) {
+    const SyntheticBlock& block = blocks[blocks.size() - scanBlocks + i];
+    CompleteBlock& completeBlock = completeBlocks[i];
+    completeBlock.blockHash = get_block_hash(block.getBlock());
+    completeBlock.block = block.getBlock();
+    completeBlock.transactions.push_back(createTransaction(block.getBlock().baseTransaction));
+    for (size_t t = 0; t < block.getTransactionCount(); ++t) {
+      completeBlock.transactions.push_back(createTransaction(block.getTransaction(t)));
+    }
+    transactionCount += completeBlock.transactions.size();
+  }
+
+  NodeStub nodeStub;
+  JsonValue results(JsonValue::ARRAY);
+  for (size_t viewKeys : viewKeyCounts) {
+    std::vector<std::unique_ptr<TransfersConsumer>> consumers;
+    for (size_t i = 0; i < viewKeys; ++i) {
+      AccountBase account;
+      account.generate();
+      consumers.emplace_back(new TransfersConsumer(currency, nodeStub, logger, account.getAccountKeys().viewSecretKey));
+      consumers.back()->addSubscription({account.getAccountKeys(), {0, 0}, 1});
+    }
+
+    auto start = Clock::now();
+    for (auto& consumer : consumers) {
+      if (!consumer->onNewBlocks(completeBlocks.data(), startHeight, static_cast<uint32_t>(completeBlocks.size()))) {
+        throw std::runtime_error("TransfersConsumer failed to process blocks");
+      }
+    }
+    double seconds = secondsSince(start);
+
+    JsonValue result = makeRate(scanBlocks, seconds, "blocks");
+    result.insert("viewKeys", static_cast<JsonValue::Integer>(viewKeys));
+    result.insert("transactions", static_cast<JsonValue::Integer>(transactionCount));
+    result.insert("keyTransactionsPerSecond", seconds > 0 ? viewKeys * transactionCount / seconds : 0.0);
+    results.pushBack(result);
+  }
+
+  return results;
+}
+
+JsonValue makeConfig(const SyntheticChainConfig& config, size_t iterations) {
+  JsonValue result(JsonValue::OBJECT);
+  result.insert("blocks", static_cast<JsonValue::Integer>(config.blockCount));
+  result.insert("transactionsPerBlock", static_cast<JsonValue::Integer>(config.transactionsPerBlock));
+  result.insert("maxMixin", static_cast<JsonValue::Integer>(config.maxMixin));
+  result.insert("senders", static_cast<JsonValue::Integer>(config.senderCount));
+  result.insert("poolTransactions", static_cast<JsonValue::Integer>(config.poolTransactions));
+  result.insert("iterations", static_cast<JsonValue::Integer>(iterations));
+  return result;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  po::options_description descOptions("Allowed options");
+  command_line::add_arg(descOptions, command_line::arg_help);
+  command_line::add_arg(descOptions, arg_blocks);
+  command_line::add_arg(descOptions, arg_txs_per_block);
+  command_line::add_arg(descOptions, arg_max_mixin);
+  command_line::add_arg(descOptions, arg_senders);
+  command_line::add_arg(descOptions, arg_pool_txs);
+  command_line::add_arg(descOptions, arg_iterations);
+  command_line::add_arg(descOptions, arg_scan_blocks);
+  command_line::add_arg(descOptions, arg_view_keys);
+  command_line::add_arg(descOptions, arg_data_dir);
+  command_line::add_arg(descOptions, arg_output);
+
+  po::variables_map vm;
+  bool r = command_line::handle_error_helper(descOptions, [&]() {
+    po::store(po::parse_command_line(argc, argv, descOptions), vm);
+    po::notify(vm);
+    return true;
+  });
+  if (!r) {
+    return 1;
+  }
+
+  if (command_line::get_arg(vm, command_line::arg_help)) {
+    std::cout << descOptions << std::endl;
+    return 0;
+  }
+
+  SyntheticChainConfig chainConfig;
+  chainConfig.blockCount = command_line::get_arg(vm, arg_blocks);
+  chainConfig.transactionsPerBlock = command_line::get_arg(vm, arg_txs_per_block);
+  chainConfig.maxMixin = command_line::get_arg(vm, arg_max_mixin);
+  chainConfig.senderCount = command_line::get_arg(vm, arg_senders);
+  chainConfig.poolTransactions = command_line::get_arg(vm, arg_pool_txs);
+  const size_t iterations = command_line::get_arg(vm, arg_iterations);
+  std::vector<size_t> viewKeyCounts = command_line::get_arg(vm, arg_view_keys);
+  if (viewKeyCounts.empty()) {
+    viewKeyCounts = {1, 100, 1000};
+  }
+
+  boost::filesystem::path dataDir = command_line::get_arg(vm, arg_data_dir);
+  bool removeDataDir = dataDir.empty();
+  if (removeDataDir) {
+    dataDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("conceal-macro-benchmarks-%%%%-%%%%");
+  }
+
+  try {
+    logging::ConsoleLogger logger(logging::ERROR);
+    // Version 1 blocks all the way, so test_generator blocks pass validation
+    Currency currency = CurrencyBuilder(logger).upgradeHeightV2(UpgradeDetectorBase::UNDEF_HEIGHT).currency();
+
+    JsonValue report(JsonValue::OBJECT);
+    report.insert("version", std::string(PROJECT_VERSION_LONG));
+    report.insert("config", makeConfig(chainConfig, iterations));
+
+    auto start = Clock::now();
+    SyntheticChain chain(currency, logger);
+    chain.generate(chainConfig);
+    JsonValue generation = makeRate(chain.blocks().size(), secondsSince(start), "blocks");
+    generation.insert("transactions", static_cast<JsonValue::Integer>(chain.transactionCount()));
+    report.insert("chainGeneration", generation);
+    report.insert("binaryRoundTrip", benchmarkBinaryRoundTrip(chain, iterations));
+
+    boost::filesystem::remove_all(dataDir);
+    CoreConfig coreConfig;
+    coreConfig.configFolder = dataDir.string();
+    MinerConfig minerConfig;
+    cryptonote_protocol_stub protocol;
+
+    {
+      core node(currency, &protocol, logger);
+      if (!node.init(coreConfig, minerConfig, false)) {
+        throw std::runtime_error("failed to initialize core");
+      }
+
+      report.insert("addChain", benchmarkAddChain(node, chain));
+      report.insert("queryBlocksLite", benchmarkQueryBlocksLite(node, iterations));
+      report.insert("kvBinaryDecode", benchmarkKvDecode(node, chain, iterations));
+      report.insert("getRandomOutsByAmount", benchmarkRandomOuts(node, chain, chainConfig.maxMixin, iterations));
+      report.insert("fillBlockTemplate", benchmarkBlockTemplate(node, chain, iterations));
+      node.deinit();
+    }
+
+    // Without the cache file the blockchain has to rebuild it from blocks.dat on load
+    boost::filesystem::remove(dataDir / currency.blocksCacheFileName());
+    boost::filesystem::remove(dataDir / (currency.blocksCacheFileName() + ".bkp"));
+    {
+      core node(currency, &protocol, logger);
+      start = Clock::now();
+      if (!node.init(coreConfig, minerConfig, true)) {
+        throw std::runtime_error("failed to reload core");
+      }
+      report.insert("rebuildCache", makeRate(node.get_current_blockchain_height(), secondsSince(start), "blocks"));
+      node.deinit();
+    }
+
+    report.insert("transfersConsumerScan", benchmarkTransfersConsumer(currency, logger, chain,
+      command_line::get_arg(vm, arg_scan_blocks), viewKeyCounts));
+
+    std::string outputFile = command_line::get_arg(vm, arg_output);
+    if (outputFile.empty()) {
+      std::cout << report << std::endl;
+    } else {
+      std::ofstream output(outputFile);
+      output << report << std::endl;
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Benchmark failed: " << e.what() << std::endl;
+    if (removeDataDir) {
+      boost::filesystem::remove_all(dataDir);
+    }
+    return 1;
+  }
+
+  if (removeDataDir) {
+    boost::filesystem::remove_all(dataDir);
+  }
+
+  return 0;
+}
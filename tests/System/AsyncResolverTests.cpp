@@ -0,0 +1,143 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <System/AsyncResolver.h>
+#include <System/ContextGroup.h>
+#include <System/ContextGroupTimeout.h>
+#include <System/Dispatcher.h>
+#include <System/DnsCache.h>
+#include <System/InterruptedException.h>
+#include <System/Timer.h>
+#include <gtest/gtest.h>
+
+using namespace platform_system;
+
+namespace {
+
+// Stub resolver: answers "<name>-record", counts calls and can be held until released.
+struct StubLookup {
+  std::shared_ptr<std::atomic<int>> calls = std::make_shared<std::atomic<int>>(0);
+  std::shared_ptr<std::promise<void>> release;
+  std::shared_future<void> released;
+
+  void hold() {
+    release = std::make_shared<std::promise<void>>();
+    released = release->get_future().share();
+  }
+
+  AsyncResolver::Lookup lookup() const {
+    auto calls = this->calls;
+    auto released = this->released;
+    return [calls, released](const std::string& name) {
+      ++*calls;
+      if (released.valid()) {
+        released.wait();
+      }
+
+      if (name == "fail") {
+        throw std::runtime_error("lookup failed");
+      }
+
+      return std::vector<std::string>{name + "-record"};
+    };
+  }
+};
+
+}
+
+class AsyncResolverTests : public testing::Test {
+public:
+  AsyncResolverTests() : contextGroup(dispatcher) {
+    DnsCache::instance().clear();
+  }
+
+  Dispatcher dispatcher;
+  ContextGroup contextGroup;
+  StubLookup stub;
+};
+
+TEST_F(AsyncResolverTests, resolvesThroughLookup) {
+  AsyncResolver resolver(dispatcher, "test", stub.lookup(), std::chrono::seconds(60));
+  ASSERT_EQ(std::vector<std::string>{"seed-record"}, resolver.resolve("seed"));
+  ASSERT_EQ(1, *stub.calls);
+}
+
+TEST_F(AsyncResolverTests, cachesResultsForTtl) {
+  AsyncResolver resolver(dispatcher, "test", stub.lookup(), std::chrono::seconds(60));
+  resolver.resolve("seed");
+  resolver.resolve("seed");
+  ASSERT_EQ(1, *stub.calls);
+
+  AsyncResolver expiring(dispatcher, "expiring", stub.lookup(), std::chrono::seconds(0));
+  expiring.resolve("seed");
+  expiring.resolve("seed");
+  ASSERT_EQ(3, *stub.calls);
+}
+
+TEST_F(AsyncResolverTests, failuresAreNotCached) {
+  AsyncResolver resolver(dispatcher, "test", stub.lookup(), std::chrono::seconds(60));
+  ASSERT_THROW(resolver.resolve("fail"), std::runtime_error);
+  ASSERT_THROW(resolver.resolve("fail"), std::runtime_error);
+  ASSERT_EQ(2, *stub.calls);
+}
+
+TEST_F(AsyncResolverTests, dispatcherRunsOtherContextsWhileResolving) {
+  stub.hold();
+  AsyncResolver resolver(dispatcher, "test", stub.lookup(), std::chrono::seconds(60));
+  bool otherContextRan = false;
+  contextGroup.spawn([&] {
+    Timer(dispatcher).sleep(std::chrono::milliseconds(10));
+    otherContextRan = true;
+    stub.release->set_value();
+  });
+
+  ASSERT_EQ(std::vector<std::string>{"seed-record"}, resolver.resolve("seed"));
+  ASSERT_TRUE(otherContextRan);
+  contextGroup.wait();
+}
+
+TEST_F(AsyncResolverTests, timeoutInterruptsResolve) {
+  stub.hold();
+  AsyncResolver resolver(dispatcher, "test", stub.lookup(), std::chrono::seconds(60));
+  {
+    ContextGroupTimeout timeout(dispatcher, contextGroup, std::chrono::milliseconds(20));
+    contextGroup.spawn([&] {
+      ASSERT_THROW(resolver.resolve("seed"), InterruptedException);
+    });
+    contextGroup.wait();
+  }
+
+  stub.release->set_value();
+  std::vector<std::string> records;
+  for (int i = 0; i < 100 && !DnsCache::instance().get("test:seed", records); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  ASSERT_EQ(std::vector<std::string>{"seed-record"}, records);
+  ASSERT_EQ(std::vector<std::string>{"seed-record"}, resolver.resolve("seed"));
+  ASSERT_EQ(1, *stub.calls);
+}
+
+TEST_F(AsyncResolverTests, resolveWithinGivesUpAfterTimeout) {
+  stub.hold();
+  std::vector<std::string> records;
+  ASSERT_FALSE(AsyncResolver::resolveWithin("test", "seed", stub.lookup(), std::chrono::seconds(60), std::chrono::milliseconds(10), records));
+  ASSERT_FALSE(AsyncResolver::resolveWithin("test", "seed", stub.lookup(), std::chrono::seconds(60), std::chrono::milliseconds(10), records));
+  ASSERT_EQ(1, *stub.calls);
+
+  stub.release->set_value();
+  for (int i = 0; i < 100 && !DnsCache::instance().get("test:seed", records); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  records.clear();
+  ASSERT_TRUE(AsyncResolver::resolveWithin("test", "seed", stub.lookup(), std::chrono::seconds(60), std::chrono::milliseconds(10), records));
+  ASSERT_EQ(std::vector<std::string>{"seed-record"}, records);
+}
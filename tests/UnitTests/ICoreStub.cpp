@@ -68,6 +68,26 @@ bool ICoreStub::get_random_outs_for_amounts(const cn::COMMAND_RPC_GET_RANDOM_OUT
   return randomOutsResult;
 }
 
+bool ICoreStub::get_random_outs_bulk(const cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request& req,
+    cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response& res) {
+  for (const auto& amountCount : req.amounts) {
+    cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::outs_for_amount outs;
+    outs.amount = amountCount.amount;
+    for (const auto& stubOuts : randomOuts.outs) {
+      if (stubOuts.amount == amountCount.amount) {
+        auto count = std::min<size_t>(stubOuts.outs.size(), amountCount.count);
+        outs.outs.assign(stubOuts.outs.begin(), stubOuts.outs.begin() + count);
+        break;
+      }
+    }
+
+    res.outs.push_back(std::move(outs));
+  }
+
+  res.height = topHeight;
+  return randomOutsResult;
+}
+
 bool ICoreStub::get_tx_outputs_gindexs(const crypto::Hash& tx_id, std::vector<uint32_t>& indexs) {
   std::copy(globalIndices.begin(), globalIndices.end(), std::back_inserter(indexs));
   return globalIndicesResult;
@@ -81,6 +101,14 @@ bool ICoreStub::handle_incoming_tx(cn::BinaryArray const& tx_blob, cn::tx_verifi
   return true;
 }
 
+bool ICoreStub::preverify_incoming_tx(const cn::BinaryArray& tx_blob, cn::Transaction& tx, crypto::Hash& tx_hash, cn::tx_verification_context& tvc) {
+  return true;
+}
+
+bool ICoreStub::handle_preverified_tx(const cn::Transaction& tx, const crypto::Hash& tx_hash, size_t blob_size, cn::tx_verification_context& tvc, bool keeped_by_block) {
+  return true;
+}
+
 bool ICoreStub::handle_incoming_block(const cn::Block &b, cn::block_verification_context &bvc, bool control_miner, bool relay_block)
 {
   return false;
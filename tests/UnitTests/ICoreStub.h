@@ -32,9 +32,13 @@ public:
     uint32_t& totalBlockCount, uint32_t& startBlockIndex) override;
   virtual bool get_random_outs_for_amounts(const cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_request& req,
       cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS_response& res) override;
+  virtual bool get_random_outs_bulk(const cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_request& req,
+      cn::COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK_response& res) override;
   virtual bool get_tx_outputs_gindexs(const crypto::Hash& tx_id, std::vector<uint32_t>& indexs) override;
   virtual cn::i_cryptonote_protocol* get_protocol() override;
   virtual bool handle_incoming_tx(cn::BinaryArray const& tx_blob, cn::tx_verification_context& tvc, bool keeped_by_block) override;
+  virtual bool preverify_incoming_tx(const cn::BinaryArray& tx_blob, cn::Transaction& tx, crypto::Hash& tx_hash, cn::tx_verification_context& tvc) override;
+  virtual bool handle_preverified_tx(const cn::Transaction& tx, const crypto::Hash& tx_hash, size_t blob_size, cn::tx_verification_context& tvc, bool keeped_by_block) override;
   virtual std::vector<cn::Transaction> getPoolTransactions() override;
   virtual bool getPoolTransaction(const crypto::Hash &tx_hash, cn::Transaction &transaction) override;
   virtual bool getPoolChanges(const crypto::Hash& tailBlockId, const std::vector<crypto::Hash>& knownTxsIds,
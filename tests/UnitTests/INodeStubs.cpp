@@ -199,31 +199,61 @@ void INodeTrivialRefreshStub::doGetRandomOutsByAmounts(std::vector<uint64_t> amo
 
   for (uint64_t amount: amounts)
   {
-    COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount out;
-    out.amount = amount;
-
-    uint64_t count = std::min(outsCount, m_maxMixin);
+    result.push_back(makeRandomOuts(amount, outsCount));
+  }
 
-    for (uint32_t i = 0; i < count; ++i)
-    {
-      crypto::PublicKey key;
-      crypto::SecretKey sk;
-      generate_keys(key, sk);
+  lock.unlock();
+  callback(std::error_code());
+}
 
-      COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::out_entry e;
-      e.global_amount_index = i;
-      e.out_key = key;
+void INodeTrivialRefreshStub::getRandomOutsBulk(std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count>&& amounts, std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result,
+  uint32_t& height, const Callback& callback)
+{
+  m_asyncCounter.addAsyncContext();
+  std::thread task(&INodeTrivialRefreshStub::doGetRandomOutsBulk, this, amounts, std::ref(result), std::ref(height), callback);
+  task.detach();
+}
 
-      out.outs.push_back(e);
-    }
+void INodeTrivialRefreshStub::doGetRandomOutsBulk(std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_BULK::amount_count> amounts, std::vector<COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount>& result,
+  uint32_t& height, const Callback& callback)
+{
+  ContextCounterHolder counterHolder(m_asyncCounter);
+  std::unique_lock<std::mutex> lock(m_walletLock);
 
-    result.push_back(std::move(out));
+  for (const auto& amountCount : amounts)
+  {
+    result.push_back(makeRandomOuts(amountCount.amount, amountCount.count));
   }
 
+  height = static_cast<uint32_t>(m_blockchainGenerator.getBlockchain().size());
+
   lock.unlock();
   callback(std::error_code());
 }
 
+COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount INodeTrivialRefreshStub::makeRandomOuts(uint64_t amount, uint64_t outsCount)
+{
+  COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::outs_for_amount out;
+  out.amount = amount;
+
+  uint64_t count = std::min(outsCount, m_maxMixin);
+
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    crypto::PublicKey key;
+    crypto::SecretKey sk;
+    generate_keys(key, sk);
+
+    COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::out_entry e;
+    e.global_amount_index = i;
+    e.out_key = key;
+
+    out.outs.push_back(e);
+  }
+
+  return out;
+}
+
 void INodeTrivialRefreshStub::queryBlocks(std::vector<crypto::Hash>&& knownBlockIds, uint64_t timestamp,
         std::vector<BlockShortEntry>& newBlocks, uint32_t& startHeight, const Callback& callback) {
   auto resultHolder = std::make_shared<std::vector<block_complete_entry>>();
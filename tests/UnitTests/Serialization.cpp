@@ -5,8 +5,11 @@
 
 #include "gtest/gtest.h"
 
+#include "Common/MemoryInputStream.h"
 #include "Common/StdInputStream.h"
 #include "Common/StdOutputStream.h"
+#include "Common/VectorOutputStream.h"
+#include "CryptoNoteCore/CryptoNoteTools.h"
 #include "Serialization/BinaryInputStreamSerializer.h"
 #include "Serialization/BinaryOutputStreamSerializer.h"
 #include "Serialization/BinarySerializationTools.h"
@@ -43,6 +46,79 @@ TEST(BinarySerializer, uint16) {
   }
 }
 
+TEST(BinarySerializer, memoryAndStreamDecodingAgree) {
+  uint64_t u64 = 0xfedcba9876543210;
+  int32_t i32 = -5;
+  std::string str = "memory input";
+  bool flag = true;
+
+  BinaryArray blob;
+  {
+    VectorOutputStream os(blob);
+    BinaryOutputStreamSerializer s(os);
+    s(u64, "u64");
+    s(i32, "i32");
+    s(str, "str");
+    s(flag, "flag");
+  }
+
+  std::stringstream ss(std::string(blob.begin(), blob.end()));
+  StdInputStream streamInput(ss);
+  MemoryInputStream memoryInput(blob.data(), blob.size());
+  for (IInputStream* input : std::vector<IInputStream*>{&streamInput, &memoryInput}) {
+    BinaryInputStreamSerializer s(*input);
+    uint64_t t64 = 0;
+    int32_t t32 = 0;
+    std::string tstr;
+    bool tflag = false;
+    s(t64, "u64");
+    s(t32, "i32");
+    s(tstr, "str");
+    s(tflag, "flag");
+
+    ASSERT_EQ(u64, t64);
+    ASSERT_EQ(i32, t32);
+    ASSERT_EQ(str, tstr);
+    ASSERT_TRUE(tflag);
+  }
+
+  ASSERT_TRUE(memoryInput.endOfStream());
+}
+
+TEST(BinarySerializer, memoryDecodingRejectsMalformedVarints) {
+  auto decode = [](const BinaryArray& blob) {
+    MemoryInputStream input(blob.data(), blob.size());
+    BinaryInputStreamSerializer s(input);
+    uint16_t value;
+    s(value, "value");
+  };
+
+  ASSERT_NO_THROW(decode({0xff, 0xff, 0x03}));
+  ASSERT_THROW(decode({0xff, 0xff, 0x04}), std::runtime_error);
+  ASSERT_THROW(decode({0x80, 0x00}), std::runtime_error);
+  ASSERT_THROW(decode({0x80}), std::runtime_error);
+  ASSERT_THROW(decode({}), std::runtime_error);
+}
+
+TEST(BinarySerializer, objectBinarySizeMatchesSerializedSize) {
+  Transaction tx;
+  tx.version = 1;
+  tx.unlockTime = 1000;
+  KeyInput input;
+  input.amount = 123456789;
+  input.outputIndexes = {1, 200, 40000};
+  tx.inputs.push_back(input);
+  tx.signatures.resize(1);
+  tx.signatures[0].resize(input.outputIndexes.size());
+  tx.extra.resize(300, 1);
+
+  ASSERT_EQ(toBinaryArray(tx).size(), getObjectBinarySize(tx));
+
+  Transaction decoded;
+  ASSERT_TRUE(fromBinaryArray(decoded, toBinaryArray(tx)));
+  ASSERT_EQ(getObjectHash(tx), getObjectHash(decoded));
+}
+
 
 //#include <cstring>
 //#include <cstdint>
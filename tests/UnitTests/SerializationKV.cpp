@@ -122,3 +122,68 @@ TEST(KVSerialize, BigCollection) {
   ASSERT_TRUE(cn::loadFromBinaryKeyValue(ts2, buf));
   EXPECT_EQ(ts1, ts2);
 }
+
+namespace {
+
+struct ReorderedElement {
+  std::vector<uint32_t> u32array;
+  std::array<uint8_t, 16> blob;
+  uint32_t nonce;
+  std::string name;
+
+  void serialize(ISerializer& s) {
+    serializeAsBinary(u32array, "u32array", s);
+    s.binary(blob.data(), blob.size(), "blob");
+    s(nonce, "nonce");
+    s(name, "name");
+  }
+};
+
+}
+
+TEST(KVSerialize, ReadsKeysInAnyOrder) {
+  TestElement element;
+  element.name = "reordered";
+  element.nonce = 777;
+  element.blob.fill(0x11);
+  element.u32array = {1, 2, 3};
+
+  ReorderedElement reordered;
+  ASSERT_TRUE(cn::loadFromBinaryKeyValue(reordered, cn::storeToBinaryKeyValue(element)));
+  EXPECT_EQ(element.name, reordered.name);
+  EXPECT_EQ(element.nonce, reordered.nonce);
+  EXPECT_EQ(element.blob, reordered.blob);
+  EXPECT_EQ(element.u32array, reordered.u32array);
+}
+
+TEST(KVSerialize, StreamAndBufferInputsMatch) {
+  TestStruct ts1;
+  ts1.u8 = 1;
+  ts1.u32 = 2;
+  ts1.u64 = 3;
+  ts1.root.name = "root";
+  ts1.vec2.resize(3);
+  ts1.vec2[1].name = "second";
+
+  std::string buf = cn::storeToBinaryKeyValue(ts1);
+  common::MemoryInputStream stream(buf.data(), buf.size());
+  KVBinaryInputStreamSerializer serializer(stream);
+
+  TestStruct ts2;
+  serialize(ts2, serializer);
+  EXPECT_EQ(ts1, ts2);
+}
+
+TEST(KVSerialize, RejectsTruncatedInput) {
+  TestStruct ts;
+  ts.u8 = 1;
+  ts.u32 = 2;
+  ts.u64 = 3;
+  ts.vec1.resize(10);
+
+  std::string buf = cn::storeToBinaryKeyValue(ts);
+  for (size_t size : {size_t(0), size_t(5), buf.size() / 2, buf.size() - 1}) {
+    TestStruct loaded;
+    EXPECT_FALSE(cn::loadFromBinaryKeyValue(loaded, buf.substr(0, size))) << size;
+  }
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+#include "Common/StdInputStream.h"
+#include "Common/StdOutputStream.h"
+#include "CryptoNoteCore/BlockHeaderIndex.h"
+#include "Serialization/BinaryInputStreamSerializer.h"
+#include "Serialization/BinaryOutputStreamSerializer.h"
+
+using namespace cn;
+
+namespace {
+
+Block makeBlock(uint64_t timestamp, uint8_t majorVersion, size_t transactionCount) {
+  Block block;
+  block.timestamp = timestamp;
+  block.majorVersion = majorVersion;
+  block.transactionHashes.resize(transactionCount);
+  return block;
+}
+
+class BlockHeaderIndexTest : public ::testing::Test {
+public:
+  BlockHeaderIndexTest() {
+    index.push(makeBlock(100, 1, 0), 200, 10, 1000);
+    index.push(makeBlock(160, 1, 2), 350, 25, 1900);
+    index.push(makeBlock(220, 2, 5), 800, 45, 2700);
+  }
+
+  BlockHeaderIndex index;
+};
+
+}
+
+TEST_F(BlockHeaderIndexTest, keepsValuesPerHeight) {
+  ASSERT_EQ(3, index.size());
+  EXPECT_EQ(160, index.timestamp(1));
+  EXPECT_EQ(350, index.cumulativeSize(1));
+  EXPECT_EQ(25, index.cumulativeDifficulty(1));
+  EXPECT_EQ(1900, index.generatedCoins(1));
+  EXPECT_EQ(2, index.majorVersion(2));
+  EXPECT_EQ(5, index.transactionCount(2));
+}
+
+TEST_F(BlockHeaderIndexTest, difficultyIsDeltaOfCumulativeDifficulty) {
+  EXPECT_EQ(10, index.difficulty(0));
+  EXPECT_EQ(15, index.difficulty(1));
+  EXPECT_EQ(20, index.difficulty(2));
+}
+
+TEST_F(BlockHeaderIndexTest, popRemovesTopHeight) {
+  index.pop();
+  ASSERT_EQ(2, index.size());
+  EXPECT_EQ(25, index.cumulativeDifficulty(1));
+
+  index.push(makeBlock(300, 2, 1), 400, 30, 2000);
+  EXPECT_EQ(300, index.timestamp(2));
+  EXPECT_EQ(5, index.difficulty(2));
+}
+
+TEST_F(BlockHeaderIndexTest, timestampLowerBoundStartsAtGivenHeight) {
+  EXPECT_EQ(1, index.timestampLowerBound(150, 0));
+  EXPECT_EQ(2, index.timestampLowerBound(150, 2));
+  EXPECT_EQ(0, index.timestampLowerBound(0, 0));
+  EXPECT_EQ(3, index.timestampLowerBound(221, 0));
+  EXPECT_EQ(3, index.timestampLowerBound(0, 3));
+}
+
+TEST_F(BlockHeaderIndexTest, serializationRoundTrip) {
+  std::stringstream stream;
+  {
+    common::StdOutputStream output(stream);
+    BinaryOutputStreamSerializer s(output);
+    s(index, "index");
+  }
+
+  BlockHeaderIndex loaded;
+  {
+    common::StdInputStream input(stream);
+    BinaryInputStreamSerializer s(input);
+    s(loaded, "index");
+  }
+
+  ASSERT_EQ(index.size(), loaded.size());
+  for (uint32_t height = 0; height < index.size(); ++height) {
+    EXPECT_EQ(index.timestamp(height), loaded.timestamp(height));
+    EXPECT_EQ(index.cumulativeSize(height), loaded.cumulativeSize(height));
+    EXPECT_EQ(index.cumulativeDifficulty(height), loaded.cumulativeDifficulty(height));
+    EXPECT_EQ(index.generatedCoins(height), loaded.generatedCoins(height));
+    EXPECT_EQ(index.majorVersion(height), loaded.majorVersion(height));
+    EXPECT_EQ(index.transactionCount(height), loaded.transactionCount(height));
+  }
+}
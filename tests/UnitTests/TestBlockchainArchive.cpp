@@ -0,0 +1,125 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <memory>
+
+#include <boost/filesystem.hpp>
+#include <boost/utility/value_init.hpp>
+
+#include "SecureTempDirectory.h"
+
+#include "CryptoNoteCore/Account.h"
+#include "CryptoNoteCore/BlockchainArchive.h"
+#include "CryptoNoteCore/Core.h"
+#include "CryptoNoteCore/CoreConfig.h"
+#include "CryptoNoteCore/CryptoNoteTools.h"
+#include "CryptoNoteCore/MinerConfig.h"
+#include "Logging/ConsoleLogger.h"
+
+namespace {
+
+class BlockchainArchiveTest : public ::testing::Test {
+protected:
+  BlockchainArchiveTest() : currency(cn::CurrencyBuilder(logger).currency()) {
+  }
+
+  void SetUp() override {
+    ASSERT_NO_THROW(sourceDir = unit_test::createSecureTempDirectory("ccx-archive-source-"));
+    ASSERT_NO_THROW(targetDir = unit_test::createSecureTempDirectory("ccx-archive-target-"));
+    archiveFile = (sourceDir / "chain.bin").string();
+    miner.generate();
+
+    source = createCore(sourceDir);
+    target = createCore(targetDir);
+  }
+
+  void TearDown() override {
+    for (auto node : {source.get(), target.get()}) {
+      if (node) {
+        EXPECT_TRUE(node->deinit());
+      }
+    }
+
+    source.reset();
+    target.reset();
+
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(sourceDir, ec);
+    boost::filesystem::remove_all(targetDir, ec);
+  }
+
+  std::unique_ptr<cn::core> createCore(const boost::filesystem::path& dataDir) {
+    cn::CoreConfig config;
+    config.configFolder = dataDir.string();
+    config.configFolderDefaulted = false;
+    config.testnet = false;
+
+    cn::MinerConfig minerConfig;
+    std::unique_ptr<cn::core> node(new cn::core(currency, nullptr, logger, false, false));
+    EXPECT_TRUE(node->init(config, minerConfig, false));
+    return node;
+  }
+
+  // mainnet difficulty stays at 1 only for the first few blocks
+  void mineBlocks(cn::core& node, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      cn::Block block;
+      cn::difficulty_type difficulty = 0;
+      uint32_t height = 0;
+      ASSERT_TRUE(node.get_block_template(block, miner.getAccountKeys().address, difficulty, height, cn::BinaryArray()));
+
+      cn::block_verification_context bvc = boost::value_initialized<cn::block_verification_context>();
+      ASSERT_TRUE(node.handle_incoming_block_blob(cn::toBinaryArray(block), bvc, false, false));
+      ASSERT_TRUE(bvc.m_added_to_main_chain);
+    }
+  }
+
+  logging::ConsoleLogger logger;
+  cn::Currency currency;
+  boost::filesystem::path sourceDir;
+  boost::filesystem::path targetDir;
+  std::string archiveFile;
+  cn::AccountBase miner;
+  std::unique_ptr<cn::core> source;
+  std::unique_ptr<cn::core> target;
+};
+
+}
+
+TEST_F(BlockchainArchiveTest, ImportReproducesExportedChain) {
+  mineBlocks(*source, 2);
+  ASSERT_TRUE(cn::BlockchainArchive(*source, logger).exportTo(archiveFile));
+
+  ASSERT_TRUE(cn::BlockchainArchive(*target, logger).importFrom(archiveFile, 2));
+  ASSERT_EQ(source->get_current_blockchain_height(), target->get_current_blockchain_height());
+  ASSERT_EQ(source->get_tail_id(), target->get_tail_id());
+}
+
+TEST_F(BlockchainArchiveTest, ImportSkipsBlocksAlreadyInChain) {
+  mineBlocks(*source, 1);
+  ASSERT_TRUE(cn::BlockchainArchive(*source, logger).exportTo(archiveFile));
+  ASSERT_TRUE(cn::BlockchainArchive(*target, logger).importFrom(archiveFile, 1));
+
+  mineBlocks(*source, 1);
+  ASSERT_TRUE(cn::BlockchainArchive(*source, logger).exportTo(archiveFile));
+  ASSERT_TRUE(cn::BlockchainArchive(*target, logger).importFrom(archiveFile, 1));
+  ASSERT_EQ(source->get_tail_id(), target->get_tail_id());
+}
+
+TEST_F(BlockchainArchiveTest, ImportRejectsCorruptedRecord) {
+  mineBlocks(*source, 2);
+  ASSERT_TRUE(cn::BlockchainArchive(*source, logger).exportTo(archiveFile));
+
+  std::fstream file(archiveFile, std::ios::binary | std::ios::in | std::ios::out);
+  file.seekp(40);
+  file.put('\x5a');
+  file.close();
+
+  ASSERT_FALSE(cn::BlockchainArchive(*target, logger).importFrom(archiveFile, 2));
+  ASSERT_EQ(1, target->get_current_blockchain_height());
+}
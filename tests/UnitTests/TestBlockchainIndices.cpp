@@ -0,0 +1,150 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+
+#include <CryptoNoteCore/BlockchainIndices.h>
+#include <Serialization/BinarySerializationTools.h>
+
+using namespace cn;
+
+namespace {
+
+crypto::Hash makeHash(uint64_t value) {
+  crypto::Hash hash = NULL_HASH;
+  std::copy(reinterpret_cast<const uint8_t*>(&value), reinterpret_cast<const uint8_t*>(&value) + sizeof(value), hash.data);
+  hash.data[31] = 1;
+  return hash;
+}
+
+struct PaymentIdIndexHolder {
+  PaymentIdIndex index;
+  void serialize(ISerializer& s) { s(index, "index"); }
+};
+
+struct TimestampIndexHolder {
+  TimestampBlocksIndex index;
+  void serialize(ISerializer& s) { s(index, "index"); }
+};
+
+}
+
+TEST(PaymentIdIndexTest, FindReturnsAllTransactionsWithPaymentId) {
+  PaymentIdIndex index;
+  ASSERT_TRUE(index.add(makeHash(1), makeHash(100)));
+  ASSERT_TRUE(index.add(makeHash(2), makeHash(200)));
+  ASSERT_TRUE(index.add(makeHash(1), makeHash(101)));
+
+  std::vector<crypto::Hash> hashes;
+  ASSERT_TRUE(index.find(makeHash(1), hashes));
+  std::sort(hashes.begin(), hashes.end(), [](const crypto::Hash& a, const crypto::Hash& b) { return memcmp(&a, &b, sizeof(a)) < 0; });
+  ASSERT_EQ(2, hashes.size());
+  ASSERT_EQ(makeHash(100), hashes[0]);
+  ASSERT_EQ(makeHash(101), hashes[1]);
+
+  hashes.clear();
+  ASSERT_FALSE(index.find(makeHash(3), hashes));
+  ASSERT_TRUE(hashes.empty());
+}
+
+TEST(PaymentIdIndexTest, RemoveKeepsOtherEntriesReachable) {
+  PaymentIdIndex index;
+  const uint64_t count = 5000;
+  for (uint64_t i = 0; i < count; ++i) {
+    ASSERT_TRUE(index.add(makeHash(i % 97), makeHash(i + 1000000)));
+  }
+  ASSERT_EQ(count, index.size());
+
+  for (uint64_t i = 0; i < count; i += 2) {
+    ASSERT_TRUE(index.remove(makeHash(i % 97), makeHash(i + 1000000)));
+  }
+  ASSERT_FALSE(index.remove(makeHash(0), makeHash(1000000)));
+  ASSERT_EQ(count / 2, index.size());
+
+  for (uint64_t paymentId = 0; paymentId < 97; ++paymentId) {
+    std::vector<crypto::Hash> hashes;
+    index.find(makeHash(paymentId), hashes);
+    for (uint64_t i = paymentId; i < count; i += 97) {
+      bool present = std::find(hashes.begin(), hashes.end(), makeHash(i + 1000000)) != hashes.end();
+      ASSERT_EQ(i % 2 == 1, present);
+    }
+  }
+}
+
+TEST(PaymentIdIndexTest, SerializationRoundTrip) {
+  PaymentIdIndexHolder original;
+  for (uint64_t i = 0; i < 100; ++i) {
+    original.index.add(makeHash(i % 10), makeHash(i + 1000));
+  }
+
+  PaymentIdIndexHolder loaded;
+  loadFromBinary(loaded, storeToBinary(original));
+  ASSERT_EQ(original.index.size(), loaded.index.size());
+
+  std::vector<crypto::Hash> expected;
+  std::vector<crypto::Hash> actual;
+  original.index.find(makeHash(3), expected);
+  loaded.index.find(makeHash(3), actual);
+  ASSERT_EQ(expected, actual);
+}
+
+TEST(TimestampBlocksIndexTest, FindHandlesOutOfOrderTimestamps) {
+  TimestampBlocksIndex index;
+  index.add(10, makeHash(1));
+  index.add(30, makeHash(3));
+  index.add(20, makeHash(2));
+  index.add(30, makeHash(4));
+
+  std::vector<crypto::Hash> hashes;
+  uint32_t withinTimestamps = 0;
+  ASSERT_TRUE(index.find(15, 30, 10, hashes, withinTimestamps));
+  ASSERT_EQ(3, withinTimestamps);
+  ASSERT_EQ(3, hashes.size());
+  ASSERT_EQ(makeHash(2), hashes[0]);
+
+  hashes.clear();
+  ASSERT_TRUE(index.find(0, 100, 2, hashes, withinTimestamps));
+  ASSERT_EQ(4, withinTimestamps);
+  ASSERT_EQ(2, hashes.size());
+  ASSERT_EQ(makeHash(1), hashes[0]);
+  ASSERT_EQ(makeHash(2), hashes[1]);
+}
+
+TEST(TimestampBlocksIndexTest, RemoveRollsBackTail) {
+  TimestampBlocksIndex index;
+  index.add(10, makeHash(1));
+  index.add(20, makeHash(2));
+  index.add(20, makeHash(3));
+
+  ASSERT_TRUE(index.remove(20, makeHash(3)));
+  ASSERT_FALSE(index.remove(20, makeHash(3)));
+  ASSERT_FALSE(index.remove(30, makeHash(2)));
+
+  std::vector<crypto::Hash> hashes;
+  uint32_t withinTimestamps = 0;
+  ASSERT_TRUE(index.find(0, 100, 10, hashes, withinTimestamps));
+  ASSERT_EQ(2, withinTimestamps);
+  ASSERT_EQ(makeHash(2), hashes.back());
+}
+
+TEST(TimestampBlocksIndexTest, SerializationRoundTrip) {
+  TimestampIndexHolder original;
+  for (uint64_t i = 0; i < 100; ++i) {
+    original.index.add(i * 7 % 50, makeHash(i));
+  }
+
+  TimestampIndexHolder loaded;
+  loadFromBinary(loaded, storeToBinary(original));
+
+  std::vector<crypto::Hash> expected;
+  std::vector<crypto::Hash> actual;
+  uint32_t expectedWithin = 0;
+  uint32_t actualWithin = 0;
+  original.index.find(10, 20, 1000, expected, expectedWithin);
+  loaded.index.find(10, 20, 1000, actual, actualWithin);
+  ASSERT_EQ(expectedWithin, actualWithin);
+  ASSERT_EQ(expected, actual);
+}
@@ -1,6 +1,8 @@
 #include <cstdint>
+#include <cstdio>
 
 #include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
 #include <boost/utility/value_init.hpp>
 
 #include "ChainAudit/ChainAudit.h"
@@ -209,3 +211,55 @@ TEST(ChainAudit, FlagsCheckpointZoneClassicalSpendForReferencePass)
 
   ASSERT_TRUE(sawCheckpointClassical);
 }
+
+TEST(ChainAudit, ProgressCheckpointRoundTrip)
+{
+  cn::chain_audit::AuditProgress progress;
+  progress.network = "testnet";
+  progress.includeInfo = true;
+  progress.startHeight = 100;
+  progress.endHeight = 5000;
+  progress.nextHeight = 2100;
+  progress.scannedBlocks = 2000;
+  progress.scannedTransactions = 2345;
+
+  cn::chain_audit::Finding finding;
+  finding.severity = cn::chain_audit::Severity::Critical;
+  finding.code = "COINBASE_REWARD_OVERCLAIM";
+  finding.height = 1500;
+  finding.txIndex = 0;
+  finding.outputIndex = 0;
+  finding.blockHash = cn::NULL_HASH;
+  finding.blockHash.data[0] = 1;
+  finding.txHash = cn::NULL_HASH;
+  finding.message = "coinbase pays too much";
+  finding.hasAmountDelta = true;
+  finding.actualAmount = 120;
+  finding.expectedAmount = 100;
+  finding.deltaAmount = 20;
+  finding.consensusTolerance = 10;
+  progress.findings.push_back(finding);
+
+  const std::string fileName =
+      (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+  ASSERT_TRUE(cn::chain_audit::saveProgress(fileName, progress));
+
+  cn::chain_audit::AuditProgress loaded;
+  ASSERT_TRUE(cn::chain_audit::loadProgress(fileName, loaded));
+  std::remove(fileName.c_str());
+
+  ASSERT_EQ(progress.network, loaded.network);
+  ASSERT_TRUE(loaded.includeInfo);
+  ASSERT_EQ(progress.startHeight, loaded.startHeight);
+  ASSERT_EQ(progress.endHeight, loaded.endHeight);
+  ASSERT_EQ(progress.nextHeight, loaded.nextHeight);
+  ASSERT_EQ(progress.scannedBlocks, loaded.scannedBlocks);
+  ASSERT_EQ(progress.scannedTransactions, loaded.scannedTransactions);
+  ASSERT_EQ(1, loaded.findings.size());
+  ASSERT_EQ(cn::chain_audit::Severity::Critical, loaded.findings[0].severity);
+  ASSERT_EQ(finding.code, loaded.findings[0].code);
+  ASSERT_EQ(finding.height, loaded.findings[0].height);
+  ASSERT_EQ(finding.blockHash, loaded.findings[0].blockHash);
+  ASSERT_EQ(finding.message, loaded.findings[0].message);
+  ASSERT_EQ(finding.deltaAmount, loaded.findings[0].deltaAmount);
+}
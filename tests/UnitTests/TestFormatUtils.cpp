@@ -143,6 +143,105 @@ TEST(parse_and_validate_tx_extra, fails_on_wrong_size_in_extra_nonce)
   std::vector<cn::TransactionExtraField> tx_extra_fields;
   ASSERT_FALSE(cn::parseTransactionExtra(tx.extra, tx_extra_fields));
 }
+TEST(TransactionExtraReader, reads_all_field_types)
+{
+  crypto::PublicKey publicKey;
+  crypto::Hash paymentId;
+  for (size_t i = 0; i < sizeof(publicKey); ++i) {
+    publicKey.data[i] = static_cast<uint8_t>(i);
+    paymentId.data[i] = static_cast<uint8_t>(i * 3);
+  }
+  cn::TransactionExtraMergeMiningTag mmTag;
+  mmTag.depth = 300;
+  mmTag.merkleRoot = paymentId;
+
+  std::vector<uint8_t> extra;
+  ASSERT_TRUE(cn::addTransactionPublicKeyToExtra(extra, publicKey));
+  cn::BinaryArray nonce;
+  cn::setPaymentIdToTransactionExtraNonce(nonce, paymentId);
+  ASSERT_TRUE(cn::addExtraNonceToTransactionExtra(extra, nonce));
+  ASSERT_TRUE(cn::appendMergeMiningTagToExtra(extra, mmTag));
+  cn::appendTTLToExtra(extra, 1234567890);
+  extra.push_back(TX_EXTRA_TAG_PADDING);
+  extra.push_back(0);
+
+  std::vector<cn::TransactionExtraField> fields;
+  ASSERT_TRUE(cn::parseTransactionExtra(extra, fields));
+  ASSERT_EQ(5, fields.size());
+
+  cn::TransactionExtraReader reader(extra);
+  cn::TransactionExtraFieldView field;
+  ASSERT_TRUE(reader.next(field));
+  ASSERT_EQ(TX_EXTRA_TAG_PUBKEY, field.tag);
+  ASSERT_EQ(0, memcmp(field.data, &publicKey, sizeof(publicKey)));
+  ASSERT_TRUE(reader.next(field));
+  ASSERT_EQ(TX_EXTRA_NONCE, field.tag);
+  ASSERT_EQ(boost::get<cn::TransactionExtraNonce>(fields[1]).nonce, std::vector<uint8_t>(field.data, field.data + field.size));
+  ASSERT_TRUE(reader.next(field));
+  ASSERT_EQ(TX_EXTRA_MERGE_MINING_TAG, field.tag);
+  ASSERT_EQ(300, field.value);
+  ASSERT_EQ(0, memcmp(field.data, &mmTag.merkleRoot, sizeof(mmTag.merkleRoot)));
+  ASSERT_TRUE(reader.next(field));
+  ASSERT_EQ(TX_EXTRA_TTL, field.tag);
+  ASSERT_EQ(1234567890, field.value);
+  ASSERT_TRUE(reader.next(field));
+  ASSERT_EQ(TX_EXTRA_TAG_PADDING, field.tag);
+  ASSERT_EQ(2, field.size);
+  ASSERT_FALSE(reader.next(field));
+  ASSERT_FALSE(reader.failed());
+
+  crypto::Hash foundPaymentId;
+  ASSERT_TRUE(cn::getPaymentIdFromTxExtra(extra, foundPaymentId));
+  ASSERT_EQ(paymentId, foundPaymentId);
+  uint64_t ttl;
+  ASSERT_TRUE(cn::getTTLFromExtra(extra, ttl));
+  ASSERT_EQ(1234567890, ttl);
+  ASSERT_EQ(publicKey, cn::getTransactionPublicKeyFromExtra(extra));
+}
+
+TEST(TransactionExtraReader, fails_where_parse_fails)
+{
+  const std::vector<std::vector<uint8_t>> malformed = {
+    {TX_EXTRA_TAG_PUBKEY, 1, 2, 3},
+    {TX_EXTRA_NONCE},
+    {TX_EXTRA_NONCE, 5, 1, 2},
+    {TX_EXTRA_TAG_PADDING, 0, 1},
+    {TX_EXTRA_MERGE_MINING_TAG, 3, 1, 2, 3},
+    {TX_EXTRA_MESSAGE_TAG, 0x80},
+    {TX_EXTRA_MESSAGE_TAG, 4, 1},
+    {TX_EXTRA_TTL, 1}
+  };
+
+  for (const auto& extra : malformed) {
+    std::vector<cn::TransactionExtraField> fields;
+    ASSERT_FALSE(cn::parseTransactionExtra(extra, fields));
+
+    cn::TransactionExtraReader reader(extra);
+    cn::TransactionExtraFieldView field;
+    while (reader.next(field)) {
+    }
+    ASSERT_TRUE(reader.failed());
+  }
+}
+
+TEST(TransactionExtraReader, keeps_fields_before_malformed_one)
+{
+  crypto::PublicKey publicKey = cn::NULL_PUBLIC_KEY;
+  publicKey.data[0] = 1;
+  std::vector<uint8_t> extra;
+  ASSERT_TRUE(cn::addTransactionPublicKeyToExtra(extra, publicKey));
+  cn::appendTTLToExtra(extra, 100);
+  extra.push_back(TX_EXTRA_NONCE);
+  extra.push_back(10);
+
+  ASSERT_EQ(publicKey, cn::getTransactionPublicKeyFromExtra(extra));
+  uint64_t ttl;
+  ASSERT_TRUE(cn::getTTLFromExtra(extra, ttl));
+  ASSERT_EQ(100, ttl);
+  crypto::Hash paymentId;
+  ASSERT_FALSE(cn::getPaymentIdFromTxExtra(extra, paymentId));
+}
+
 TEST(validate_parse_amount_case, validate_parse_amount)
 {
   logging::LoggerGroup logger;
@@ -188,3 +287,29 @@ TEST(validate_parse_amount_case, validate_parse_amount)
   r = currency.parseAmount("1 00.00 00", res);
   ASSERT_FALSE(r);
 }
+
+TEST(get_block_longhashes, patching_nonce_matches_full_rehash)
+{
+  cn::Block block = boost::value_initialized<cn::Block>();
+  block.majorVersion = cn::BLOCK_MAJOR_VERSION_1;
+  block.timestamp = 1234567;
+  block.transactionHashes.push_back(crypto::cn_fast_hash("tx", 2));
+
+  cn::BinaryArray blob;
+  size_t nonceOffset;
+  ASSERT_TRUE(cn::get_block_hashing_blob(block, blob, nonceOffset));
+
+  const uint32_t nonces[] = {0, 1, 0xdeadbeef};
+  crypto::Hash hashes[3];
+  crypto::cn_context context;
+  crypto::cn_context contexts[3];
+  crypto::cn_context* lanes[] = {&contexts[0], &contexts[1], &contexts[2]};
+  cn::get_block_longhashes(lanes, block.majorVersion, blob, nonceOffset, nonces, 3, hashes);
+
+  for (size_t i = 0; i < 3; ++i) {
+    block.nonce = nonces[i];
+    crypto::Hash expected;
+    ASSERT_TRUE(cn::get_block_longhash(context, block, expected));
+    ASSERT_EQ(expected, hashes[i]);
+  }
+}
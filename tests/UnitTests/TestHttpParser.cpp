@@ -0,0 +1,93 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <system_error>
+
+#include <HTTP/HttpParser.h>
+
+using namespace cn;
+
+TEST(HttpParser, ParsesRequestFedByteByByte) {
+  const std::string message =
+    "POST /json_rpc HTTP/1.1\r\n"
+    "Host: 127.0.0.1\r\n"
+    "Content-Type:application/json \r\n"
+    "Content-Length: 4\r\n"
+    "\r\n"
+    "{}{}";
+
+  HttpParser parser;
+  HttpRequest request;
+  for (size_t size = 1; size < message.size(); ++size) {
+    ASSERT_EQ(0, parser.parseRequest(message.data(), size, request));
+  }
+
+  ASSERT_EQ(message.size(), parser.parseRequest(message.data(), message.size(), request));
+  EXPECT_EQ("POST", request.getMethod());
+  EXPECT_EQ("/json_rpc", request.getUrl());
+  EXPECT_EQ("{}{}", request.getBody());
+  EXPECT_EQ("application/json", request.getHeaders().at("content-type"));
+  EXPECT_EQ("127.0.0.1", request.getHeaders().at("host"));
+}
+
+TEST(HttpParser, ParsesPipelinedRequests) {
+  const std::string first = "GET /getheight HTTP/1.1\r\n\r\n";
+  const std::string second = "POST /getinfo HTTP/1.1\r\nContent-Length: 2\r\n\r\n{}";
+  const std::string buffer = first + second;
+
+  HttpParser parser;
+  HttpRequest request1;
+  ASSERT_EQ(first.size(), parser.parseRequest(buffer.data(), buffer.size(), request1));
+  EXPECT_EQ("/getheight", request1.getUrl());
+  EXPECT_TRUE(request1.getBody().empty());
+
+  HttpRequest request2;
+  ASSERT_EQ(second.size(), parser.parseRequest(buffer.data() + first.size(), second.size(), request2));
+  EXPECT_EQ("/getinfo", request2.getUrl());
+  EXPECT_EQ("{}", request2.getBody());
+}
+
+TEST(HttpParser, ParsesResponse) {
+  const std::string message =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Length: 5\r\n"
+    "Server: test\r\n"
+    "\r\n"
+    "hello";
+
+  HttpParser parser;
+  HttpResponse response;
+  ASSERT_EQ(0, parser.parseResponse(message.data(), message.size() - 1, response));
+  ASSERT_EQ(message.size(), parser.parseResponse(message.data(), message.size(), response));
+  EXPECT_EQ(HttpResponse::STATUS_200, response.getStatus());
+  EXPECT_EQ("hello", response.getBody());
+  EXPECT_EQ("test", response.getHeaders().at("server"));
+}
+
+TEST(HttpParser, RejectsMalformedRequests) {
+  const std::string badLength = "POST / HTTP/1.1\r\nContent-Length: 12x\r\n\r\n";
+  const std::string noColon = "POST / HTTP/1.1\r\nHost\r\n\r\n";
+  const std::string hugeHeader = "POST / HTTP/1.1\r\nX: " + std::string(100 * 1024, 'a');
+
+  HttpRequest request;
+  EXPECT_THROW(HttpParser().parseRequest(badLength.data(), badLength.size(), request), std::system_error);
+  EXPECT_THROW(HttpParser().parseRequest(noColon.data(), noColon.size(), request), std::system_error);
+  EXPECT_THROW(HttpParser().parseRequest(hugeHeader.data(), hugeHeader.size(), request), std::system_error);
+}
+
+TEST(HttpParser, ResponseHeaderBlockRoundTrips) {
+  HttpResponse response;
+  response.addHeader("Content-Type", "application/json");
+  response.setBody("{\"status\":\"OK\"}");
+  const std::string message = response.getHeaderBlock() + response.getBody();
+
+  HttpParser parser;
+  HttpResponse parsed;
+  ASSERT_EQ(message.size(), parser.parseResponse(message.data(), message.size(), parsed));
+  EXPECT_EQ(response.getBody(), parsed.getBody());
+  EXPECT_EQ("application/json", parsed.getHeaders().at("content-type"));
+}
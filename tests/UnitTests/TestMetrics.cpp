@@ -0,0 +1,50 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <Common/Metrics.h>
+
+using namespace common;
+
+TEST(MetricsTest, RegistryReturnsSameMetricForSameNameAndLabels) {
+  MetricsRegistry& registry = MetricsRegistry::instance();
+  MetricCounter& counter = registry.counter("test_metrics_same_total", "test counter", metricLabel("kind", "a"));
+  ASSERT_EQ(&counter, &registry.counter("test_metrics_same_total", "test counter", metricLabel("kind", "a")));
+  ASSERT_NE(&counter, &registry.counter("test_metrics_same_total", "test counter", metricLabel("kind", "b")));
+  ASSERT_THROW(registry.histogram("test_metrics_same_total", "test counter"), std::runtime_error);
+}
+
+TEST(MetricsTest, HistogramCountsObservationsPerBucket) {
+  MetricHistogram histogram;
+  histogram.observe(10);
+  histogram.observe(50);
+  histogram.observe(51);
+  histogram.observe(20000000);
+
+  ASSERT_EQ(2, histogram.bucket(0));
+  ASSERT_EQ(1, histogram.bucket(1));
+  ASSERT_EQ(1, histogram.bucket(MetricHistogram::BUCKET_COUNT));
+  ASSERT_EQ(4, histogram.count());
+  ASSERT_EQ(20000111, histogram.sum());
+}
+
+TEST(MetricsTest, PrometheusOutputHasCumulativeBuckets) {
+  MetricsRegistry& registry = MetricsRegistry::instance();
+  registry.counter("test_metrics_export_total", "exported counter").increment(3);
+  MetricHistogram& histogram = registry.histogram("test_metrics_export_seconds", "exported histogram", metricLabel("route", "/a\"b"));
+  histogram.observe(40);
+  histogram.observe(1500000);
+
+  std::string text = registry.toPrometheus();
+  ASSERT_NE(std::string::npos, text.find("# TYPE test_metrics_export_total counter\ntest_metrics_export_total 3\n"));
+  ASSERT_NE(std::string::npos, text.find("# TYPE test_metrics_export_seconds histogram\n"));
+  ASSERT_NE(std::string::npos, text.find("test_metrics_export_seconds_bucket{route=\"/a\\\"b\",le=\"0.000050\"} 1\n"));
+  ASSERT_NE(std::string::npos, text.find("test_metrics_export_seconds_bucket{route=\"/a\\\"b\",le=\"1.000000\"} 1\n"));
+  ASSERT_NE(std::string::npos, text.find("test_metrics_export_seconds_bucket{route=\"/a\\\"b\",le=\"2.500000\"} 2\n"));
+  ASSERT_NE(std::string::npos, text.find("test_metrics_export_seconds_bucket{route=\"/a\\\"b\",le=\"+Inf\"} 2\n"));
+  ASSERT_NE(std::string::npos, text.find("test_metrics_export_seconds_sum{route=\"/a\\\"b\"} 1.500040\n"));
+  ASSERT_NE(std::string::npos, text.find("test_metrics_export_seconds_count{route=\"/a\\\"b\"} 2\n"));
+}
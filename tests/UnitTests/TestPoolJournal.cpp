@@ -0,0 +1,104 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+
+#include "CryptoNoteCore/PoolJournal.h"
+
+using namespace cn;
+
+namespace {
+
+class PoolJournalTest : public ::testing::Test {
+public:
+  PoolJournalTest() : fileName((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string()) {
+  }
+
+  ~PoolJournalTest() {
+    journal.close();
+    boost::system::error_code ec;
+    boost::filesystem::remove(fileName, ec);
+  }
+
+  std::vector<PoolJournal::Record> replay() {
+    std::vector<PoolJournal::Record> records;
+    PoolJournal reader;
+    EXPECT_TRUE(reader.open(fileName, [&](PoolJournal::RecordType type, const BinaryArray& payload) {
+      records.push_back({type, payload});
+    }));
+
+    return records;
+  }
+
+  const std::string fileName;
+  PoolJournal journal;
+};
+
+void ignoreRecord(PoolJournal::RecordType, const BinaryArray&) {
+}
+
+}
+
+TEST_F(PoolJournalTest, replaysAppendedRecordsInOrder) {
+  ASSERT_TRUE(journal.open(fileName, ignoreRecord));
+  ASSERT_TRUE(journal.append(PoolJournal::ADD, {1, 2, 3}));
+  ASSERT_TRUE(journal.append(PoolJournal::REMOVE, {4}));
+  EXPECT_EQ(2, journal.recordCount());
+  journal.close();
+
+  auto records = replay();
+  ASSERT_EQ(2, records.size());
+  EXPECT_EQ(PoolJournal::ADD, records[0].type);
+  EXPECT_EQ(BinaryArray({1, 2, 3}), records[0].payload);
+  EXPECT_EQ(PoolJournal::REMOVE, records[1].type);
+  EXPECT_EQ(BinaryArray({4}), records[1].payload);
+}
+
+TEST_F(PoolJournalTest, tornTailIsCutOff) {
+  ASSERT_TRUE(journal.open(fileName, ignoreRecord));
+  ASSERT_TRUE(journal.append(PoolJournal::ADD, {1, 2, 3}));
+  ASSERT_TRUE(journal.append(PoolJournal::ADD, {4, 5, 6}));
+  journal.close();
+
+  boost::filesystem::resize_file(fileName, boost::filesystem::file_size(fileName) - 1);
+
+  ASSERT_TRUE(journal.open(fileName, ignoreRecord));
+  EXPECT_EQ(1, journal.recordCount());
+  ASSERT_TRUE(journal.append(PoolJournal::REMOVE, {7}));
+  journal.close();
+
+  auto records = replay();
+  ASSERT_EQ(2, records.size());
+  EXPECT_EQ(BinaryArray({1, 2, 3}), records[0].payload);
+  EXPECT_EQ(PoolJournal::REMOVE, records[1].type);
+}
+
+TEST_F(PoolJournalTest, compactReplacesRecords) {
+  ASSERT_TRUE(journal.open(fileName, ignoreRecord));
+  for (uint8_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(journal.append(PoolJournal::ADD, {i}));
+  }
+
+  ASSERT_TRUE(journal.compact({{PoolJournal::ADD, {9}}}));
+  EXPECT_EQ(1, journal.recordCount());
+  ASSERT_TRUE(journal.append(PoolJournal::REMOVE, {9}));
+  journal.close();
+
+  auto records = replay();
+  ASSERT_EQ(2, records.size());
+  EXPECT_EQ(BinaryArray({9}), records[0].payload);
+  EXPECT_EQ(PoolJournal::REMOVE, records[1].type);
+}
+
+TEST_F(PoolJournalTest, rejectsForeignFile) {
+  {
+    std::ofstream stream(fileName, std::ios::binary);
+    stream << "not a pool journal";
+  }
+
+  EXPECT_FALSE(journal.open(fileName, ignoreRecord));
+}
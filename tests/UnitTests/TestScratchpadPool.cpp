@@ -0,0 +1,52 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "crypto/hash.h"
+
+using namespace crypto;
+
+TEST(ScratchpadPool, ReleasedPadIsReused) {
+  uint8_t* longState;
+  {
+    cn_context context;
+    longState = context.long_state;
+    ASSERT_NE(nullptr, longState);
+    ASSERT_NE(nullptr, context.hash_state);
+  }
+
+  size_t idle = scratchpad_pool::instance().idle_count();
+  ASSERT_GE(idle, 1);
+
+  cn_context context;
+  EXPECT_EQ(longState, context.long_state);
+  EXPECT_EQ(idle - 1, scratchpad_pool::instance().idle_count());
+}
+
+TEST(ScratchpadPool, AlgorithmsShareOnePad) {
+  const std::string data = "This is a test";
+  Hash expectedV0;
+  Hash expectedGpu;
+  {
+    cn_context context;
+    cn_slow_hash_v0(context, data.data(), data.size(), expectedV0);
+  }
+  {
+    cn_context context;
+    cn_gpu_hash_v0(context, data.data(), data.size(), expectedGpu);
+  }
+
+  cn_context context;
+  Hash hash;
+  cn_gpu_hash_v0(context, data.data(), data.size(), hash);
+  EXPECT_EQ(expectedGpu, hash);
+  cn_slow_hash_v0(context, data.data(), data.size(), hash);
+  EXPECT_EQ(expectedV0, hash);
+  cn_gpu_hash_v0(context, data.data(), data.size(), hash);
+  EXPECT_EQ(expectedGpu, hash);
+}
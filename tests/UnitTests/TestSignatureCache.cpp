@@ -0,0 +1,77 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include "CryptoNoteCore/SignatureCache.h"
+
+using namespace cn;
+
+namespace {
+
+struct RingInput {
+  crypto::Hash prefixHash = crypto::rand<crypto::Hash>();
+  crypto::KeyImage keyImage = crypto::rand<crypto::KeyImage>();
+  std::vector<crypto::PublicKey> keys = {crypto::rand<crypto::PublicKey>(), crypto::rand<crypto::PublicKey>()};
+  std::vector<crypto::Signature> signatures = {crypto::rand<crypto::Signature>(), crypto::rand<crypto::Signature>()};
+
+  crypto::Hash key() const {
+    std::vector<const crypto::PublicKey*> keyPointers;
+    for (const auto& key : keys) {
+      keyPointers.push_back(&key);
+    }
+
+    return SignatureCache::makeKey(prefixHash, keyImage, keyPointers, signatures);
+  }
+};
+
+}
+
+TEST(SignatureCache, keyChangesWithResolvedRingMembers) {
+  RingInput input;
+  crypto::Hash key = input.key();
+  EXPECT_EQ(key, input.key());
+
+  input.keys[1] = crypto::rand<crypto::PublicKey>();
+  EXPECT_NE(key, input.key());
+}
+
+TEST(SignatureCache, keyChangesWithSignatures) {
+  RingInput input;
+  crypto::Hash key = input.key();
+
+  input.signatures[0] = crypto::rand<crypto::Signature>();
+  EXPECT_NE(key, input.key());
+}
+
+TEST(SignatureCache, remembersAddedKeys) {
+  SignatureCache cache(4);
+  RingInput input;
+
+  EXPECT_FALSE(cache.contains(input.key()));
+  cache.add(input.key());
+  EXPECT_TRUE(cache.contains(input.key()));
+
+  cache.clear();
+  EXPECT_FALSE(cache.contains(input.key()));
+}
+
+TEST(SignatureCache, evictsOldestWhenFull) {
+  SignatureCache cache(2);
+  crypto::Hash first = crypto::rand<crypto::Hash>();
+  crypto::Hash second = crypto::rand<crypto::Hash>();
+  crypto::Hash third = crypto::rand<crypto::Hash>();
+
+  cache.add(first);
+  cache.add(second);
+  cache.add(second);
+  ASSERT_EQ(2, cache.size());
+
+  cache.add(third);
+  EXPECT_EQ(2, cache.size());
+  EXPECT_FALSE(cache.contains(first));
+  EXPECT_TRUE(cache.contains(second));
+  EXPECT_TRUE(cache.contains(third));
+}
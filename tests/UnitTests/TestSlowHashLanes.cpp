@@ -0,0 +1,61 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "crypto/hash.h"
+
+using namespace crypto;
+
+namespace {
+
+const size_t LANES = 7;
+
+// Lanes are hashed 4 + 2 + 1 at a time and each must match the single hash of its input
+void checkLanes(cn_slow_hash_fn single, cn_slow_hash_multi_fn multi) {
+  std::vector<std::string> inputs;
+  for (size_t i = 0; i < LANES; ++i) {
+    inputs.push_back("Interleaved lane input number " + std::to_string(i) + ", long enough for every variant");
+  }
+
+  cn_context contexts[LANES];
+  cn_context* lanes[LANES];
+  const void* data[LANES];
+  for (size_t i = 0; i < LANES; ++i) {
+    lanes[i] = &contexts[i];
+    data[i] = inputs[i].data();
+  }
+
+  Hash hashes[LANES];
+  multi(lanes, data, inputs[0].size(), hashes, LANES);
+
+  cn_context context;
+  for (size_t i = 0; i < LANES; ++i) {
+    Hash expected;
+    single(context, inputs[i].data(), inputs[i].size(), expected);
+    EXPECT_EQ(expected, hashes[i]) << "lane " << i;
+  }
+}
+
+}
+
+TEST(SlowHashLanes, Cryptonight) {
+  checkLanes(cn_slow_hash_v0, cn_slow_hash_v0_multi);
+}
+
+TEST(SlowHashLanes, CryptonightFastV8) {
+  checkLanes(cn_fast_slow_hash_v1, cn_fast_slow_hash_v1_multi);
+}
+
+TEST(SlowHashLanes, CryptonightConceal) {
+  checkLanes(cn_conceal_slow_hash_v0, cn_conceal_slow_hash_v0_multi);
+}
+
+TEST(SlowHashLanes, CryptonightGpu) {
+  checkLanes(cn_gpu_hash_v0, cn_gpu_hash_v0_multi);
+}
@@ -1350,6 +1350,28 @@ TEST_F(TransfersContainer_getOutputs, filtersByStateAndKeySimultaneously) {
   ASSERT_EQ(AMOUNT_1 + AMOUNT_2, transfers.front().amount);
 }
 
+TEST_F(TransfersContainer_getOutputs, getOutputsByAmountReturnsAscendingAmountsInRange) {
+  for (uint64_t amount : {50, 10, 30, 20}) {
+    addTransaction(TEST_BLOCK_HEIGHT, amount);
+  }
+
+  addTransaction(WALLET_LEGACY_UNCONFIRMED_TRANSACTION_HEIGHT, 25);
+  container.advanceHeight(TEST_CONTAINER_CURRENT_HEIGHT);
+
+  const uint32_t flags = ITransfersContainer::IncludeStateUnlocked | ITransfersContainer::IncludeTypeAll;
+  std::vector<TransactionOutputInformation> transfers;
+  container.getOutputsByAmount(transfers, flags, 15, 40, 10);
+  ASSERT_EQ(2, transfers.size());
+  ASSERT_EQ(20, transfers[0].amount);
+  ASSERT_EQ(30, transfers[1].amount);
+
+  container.getOutputsByAmount(transfers, flags, 0, std::numeric_limits<uint64_t>::max(), 3);
+  ASSERT_EQ(5, transfers.size());
+  ASSERT_EQ(10, transfers[2].amount);
+  ASSERT_EQ(20, transfers[3].amount);
+  ASSERT_EQ(30, transfers[4].amount);
+}
+
 class TransfersContainer_getTransactionInputs : public TransfersContainerTest {
 public:
   const uint64_t AMOUNT_1 = 1000224;
@@ -0,0 +1,137 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+
+#include "crypto/crypto.h"
+#include "Wallet/WalletCacheChunks.h"
+
+#include "SecureTempDirectory.h"
+
+using namespace cn;
+
+namespace {
+
+class WalletCacheChunksTest : public ::testing::Test {
+public:
+  void SetUp() override {
+    m_directory = unit_test::createSecureTempDirectory("walletcachechunks");
+    m_storage.open((m_directory / "container").string(), common::FileMappedVectorOpenMode::CREATE, sizeof(crypto::chacha8_iv));
+    m_key = crypto::rand<crypto::chacha8_key>();
+    *reinterpret_cast<crypto::chacha8_iv*>(m_storage.prefix()) = crypto::rand<crypto::chacha8_iv>();
+  }
+
+  void TearDown() override {
+    m_storage.close();
+    boost::system::error_code ignore;
+    boost::filesystem::remove_all(m_directory, ignore);
+  }
+
+protected:
+  WalletCacheChunks::IvGenerator ivGenerator() {
+    return [this] {
+      auto* iv = reinterpret_cast<uint64_t*>(m_storage.prefix());
+      crypto::chacha8_iv current = *reinterpret_cast<crypto::chacha8_iv*>(iv);
+      ++*iv;
+      return current;
+    };
+  }
+
+  static std::vector<WalletCacheChunk> makeChunks(size_t transactionChunks) {
+    std::vector<WalletCacheChunk> chunks;
+    chunks.push_back({WalletCacheChunkType::STATE, 0, "state"});
+    for (uint32_t i = 0; i < transactionChunks; ++i) {
+      chunks.push_back({WalletCacheChunkType::TRANSACTIONS, i, std::string(1000 + i, static_cast<char>('a' + i))});
+    }
+    return chunks;
+  }
+
+  std::vector<WalletCacheChunk> reload() {
+    WalletCacheChunks loaded;
+    loaded.load(m_storage, m_key);
+
+    std::vector<WalletCacheChunk> chunks(loaded.chunkCount());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      loaded.readChunk(m_storage, m_key, i, chunks[i]);
+    }
+    return chunks;
+  }
+
+  static void expectEqual(const std::vector<WalletCacheChunk>& expected, const std::vector<WalletCacheChunk>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i].type, actual[i].type);
+      EXPECT_EQ(expected[i].index, actual[i].index);
+      EXPECT_EQ(expected[i].data, actual[i].data);
+    }
+  }
+
+  boost::filesystem::path m_directory;
+  ContainerStorage m_storage;
+  crypto::chacha8_key m_key;
+};
+
+}
+
+TEST_F(WalletCacheChunksTest, savedChunksAreLoadedBack) {
+  auto chunks = makeChunks(3);
+  WalletCacheChunks cache;
+  cache.save(m_storage, m_key, ivGenerator(), chunks);
+
+  EXPECT_EQ(chunks.size(), cache.lastWrittenChunks());
+  expectEqual(chunks, reload());
+}
+
+TEST_F(WalletCacheChunksTest, onlyChangedChunksAreWritten) {
+  auto chunks = makeChunks(4);
+  WalletCacheChunks cache;
+  cache.save(m_storage, m_key, ivGenerator(), chunks);
+
+  chunks[2].data += "changed";
+  chunks.push_back({WalletCacheChunkType::TRANSFERS, 0, "transfers"});
+  cache.save(m_storage, m_key, ivGenerator(), chunks);
+  EXPECT_EQ(2, cache.lastWrittenChunks());
+  expectEqual(chunks, reload());
+
+  cache.save(m_storage, m_key, ivGenerator(), chunks);
+  EXPECT_EQ(0, cache.lastWrittenChunks());
+  expectEqual(chunks, reload());
+}
+
+TEST_F(WalletCacheChunksTest, loadedLayoutIsUpdatedIncrementally) {
+  auto chunks = makeChunks(2);
+  {
+    WalletCacheChunks cache;
+    cache.save(m_storage, m_key, ivGenerator(), chunks);
+  }
+
+  WalletCacheChunks cache;
+  cache.load(m_storage, m_key);
+  chunks.pop_back();
+  chunks[0].data = "new state";
+  cache.save(m_storage, m_key, ivGenerator(), chunks);
+
+  EXPECT_EQ(1, cache.lastWrittenChunks());
+  expectEqual(chunks, reload());
+}
+
+TEST_F(WalletCacheChunksTest, corruptedChunkIsDetected) {
+  auto chunks = makeChunks(1);
+  WalletCacheChunks cache;
+  cache.save(m_storage, m_key, ivGenerator(), chunks);
+
+  m_storage.suffix()[m_storage.suffixSize() / 2] ^= 1;
+
+  WalletCacheChunks loaded;
+  WalletCacheChunk chunk;
+  ASSERT_ANY_THROW({
+    loaded.load(m_storage, m_key);
+    for (size_t i = 0; i < loaded.chunkCount(); ++i) {
+      loaded.readChunk(m_storage, m_key, i, chunk);
+    }
+  });
+}
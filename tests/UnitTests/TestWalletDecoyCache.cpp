@@ -0,0 +1,118 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include <set>
+
+#include "crypto/crypto.h"
+#include "Wallet/WalletDecoyCache.h"
+
+using namespace cn;
+
+namespace {
+
+typedef WalletDecoyCache::OutsForAmount OutsForAmount;
+
+const size_t POOL_SIZE = 8;
+const size_t REFILL_THRESHOLD = 2;
+const uint32_t MAX_AGE = 10;
+
+OutsForAmount makeOuts(uint64_t amount, uint64_t firstIndex, size_t count) {
+  OutsForAmount outs;
+  outs.amount = amount;
+  for (size_t i = 0; i < count; ++i) {
+    COMMAND_RPC_GET_RANDOM_OUTPUTS_FOR_AMOUNTS::out_entry entry;
+    entry.global_amount_index = firstIndex + i;
+    entry.out_key = crypto::rand<crypto::PublicKey>();
+    outs.outs.push_back(entry);
+  }
+
+  return outs;
+}
+
+class WalletDecoyCacheTest : public ::testing::Test {
+public:
+  WalletDecoyCacheTest() : m_cache(POOL_SIZE, REFILL_THRESHOLD, MAX_AGE) {
+  }
+
+protected:
+  WalletDecoyCache m_cache;
+};
+
+}
+
+TEST_F(WalletDecoyCacheTest, missingRequestsWhatPoolsLackAndFillsThem) {
+  auto missing = m_cache.missing({10, 20, 10}, 3, 100);
+  ASSERT_EQ(2, missing.size());
+  EXPECT_EQ(10, missing[0].amount);
+  EXPECT_EQ(6 + POOL_SIZE, missing[0].count);
+  EXPECT_EQ(20, missing[1].amount);
+  EXPECT_EQ(3 + POOL_SIZE, missing[1].count);
+
+  m_cache.add({makeOuts(10, 0, 6 + POOL_SIZE), makeOuts(20, 0, 2)}, 100);
+
+  missing = m_cache.missing({10, 20, 10}, 3, 100);
+  ASSERT_EQ(1, missing.size());
+  EXPECT_EQ(20, missing[0].amount);
+  EXPECT_EQ(1 + POOL_SIZE, missing[0].count);
+}
+
+TEST_F(WalletDecoyCacheTest, drawnDecoysAreNotHandedOutAgain) {
+  m_cache.add({makeOuts(10, 0, 10)}, 100);
+  m_cache.add({makeOuts(10, 5, 10)}, 100);
+  ASSERT_EQ(15, m_cache.poolSize(10));
+
+  auto drawn = m_cache.draw({10, 20, 10}, 6, 100);
+  ASSERT_EQ(3, drawn.size());
+  EXPECT_EQ(6, drawn[0].outs.size());
+  EXPECT_EQ(20, drawn[1].amount);
+  EXPECT_TRUE(drawn[1].outs.empty());
+  EXPECT_EQ(6, drawn[2].outs.size());
+
+  std::set<uint64_t> indexes;
+  for (const auto& outs : drawn) {
+    for (const auto& out : outs.outs) {
+      EXPECT_TRUE(indexes.insert(out.global_amount_index).second);
+    }
+  }
+
+  EXPECT_EQ(3, m_cache.poolSize(10));
+  EXPECT_EQ(3, m_cache.draw({10}, 6, 100)[0].outs.size());
+  EXPECT_EQ(0, m_cache.poolSize(10));
+}
+
+TEST_F(WalletDecoyCacheTest, oldDecoysExpire) {
+  m_cache.add({makeOuts(10, 0, 4)}, 100);
+  m_cache.add({makeOuts(10, 4, 4)}, 105);
+
+  auto drawn = m_cache.draw({10}, 8, 100 + MAX_AGE + 1);
+  ASSERT_EQ(4, drawn[0].outs.size());
+  for (const auto& out : drawn[0].outs) {
+    EXPECT_LE(4, out.global_amount_index);
+  }
+}
+
+TEST_F(WalletDecoyCacheTest, refillsAreRequestedBelowThresholdAndDroppedAfterClear) {
+  m_cache.add({makeOuts(10, 0, 1), makeOuts(20, 0, POOL_SIZE)}, 100);
+
+  auto refills = m_cache.refills({10, 20, 10});
+  ASSERT_EQ(1, refills.size());
+  EXPECT_EQ(10, refills[0].amount);
+  EXPECT_EQ(POOL_SIZE - 1, refills[0].count);
+
+  ASSERT_TRUE(m_cache.beginRefill());
+  ASSERT_FALSE(m_cache.beginRefill());
+  uint64_t generation = m_cache.generation();
+
+  m_cache.clear();
+  m_cache.finishRefill(generation, {makeOuts(10, 100, POOL_SIZE)}, 100);
+  EXPECT_EQ(0, m_cache.poolSize(10));
+
+  ASSERT_TRUE(m_cache.beginRefill());
+  m_cache.finishRefill(m_cache.generation(), {makeOuts(10, 100, POOL_SIZE)}, 100);
+  EXPECT_EQ(POOL_SIZE, m_cache.poolSize(10));
+  EXPECT_TRUE(m_cache.beginRefill());
+}
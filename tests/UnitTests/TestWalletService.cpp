@@ -75,6 +75,8 @@ struct IWalletBaseStub : public cn::IWallet, public cn::IFusionManager {
   virtual WalletTransactionWithTransfers getTransaction(const crypto::Hash& transactionHash) const override { return WalletTransactionWithTransfers(); }
   virtual std::vector<TransactionsInBlockInfo> getTransactions(const crypto::Hash& blockHash, size_t count) const override { return {}; }
   virtual std::vector<TransactionsInBlockInfo> getTransactions(uint32_t blockIndex, size_t count) const override { return {}; }
+  virtual std::vector<TransactionsInBlockInfo> getTransactions(const crypto::Hash& blockHash, size_t count, const WalletTransactionFilter& filter, WalletTransactionCursor& cursor) const override { return {}; }
+  virtual std::vector<TransactionsInBlockInfo> getTransactions(uint32_t blockIndex, size_t count, const WalletTransactionFilter& filter, WalletTransactionCursor& cursor) const override { return {}; }
   virtual std::vector<crypto::Hash> getBlockHashes(uint32_t blockIndex, size_t count) const override { return {}; }
   virtual uint32_t getBlockCount() const override { return 0; }
   virtual std::vector<WalletTransactionWithTransfers> getUnconfirmedTransactions() const override { return {}; }
@@ -705,6 +707,88 @@ TEST_F(WalletServiceTest_getTransactions, blockNotFound) {
   ASSERT_EQ(make_error_code(cn::error::WalletServiceErrorCode::OBJECT_NOT_FOUND), ec);
 }
 
+class WalletGetTransactionPageStub : public IWalletBaseStub {
+public:
+  WalletGetTransactionPageStub(platform_system::Dispatcher& d) : IWalletBaseStub(d) {}
+
+  virtual std::vector<TransactionsInBlockInfo> getTransactions(uint32_t blockIndex, size_t count, const WalletTransactionFilter& filter, WalletTransactionCursor& cursor) const override {
+    receivedFilter = filter;
+    receivedCursor = cursor;
+    cursor = nextCursor;
+    return transactions;
+  }
+
+  std::vector<TransactionsInBlockInfo> transactions;
+  WalletTransactionCursor nextCursor;
+  mutable WalletTransactionFilter receivedFilter;
+  mutable WalletTransactionCursor receivedCursor;
+};
+
+TEST_F(WalletServiceTest_getTransactions, pageIsQueriedWithFilterAndCursor) {
+  WalletGetTransactionPageStub wallet(dispatcher);
+  wallet.transactions = testTransactions;
+  wallet.nextCursor.blockIndex = 7;
+  wallet.nextCursor.transactionId = 12;
+
+  auto service = createWalletService(wallet);
+
+  GetTransactions::Request request;
+  request.addresses = {RANDOM_ADDRESS1};
+  request.firstBlockIndex = 0;
+  request.blockCount = 10;
+  request.paymentId = PAYMENT_ID;
+  request.limit = 1;
+  request.cursor = "5:3";
+
+  GetTransactions::Response response;
+  auto ec = service->getTransactions(request, response);
+
+  ASSERT_FALSE(ec);
+  ASSERT_EQ(1, wallet.receivedFilter.limit);
+  ASSERT_EQ(request.addresses, wallet.receivedFilter.addresses);
+  ASSERT_TRUE(static_cast<bool>(wallet.receivedFilter.paymentId));
+  ASSERT_EQ(PAYMENT_ID, common::podToHex(*wallet.receivedFilter.paymentId));
+  ASSERT_EQ(5, wallet.receivedCursor.blockIndex);
+  ASSERT_EQ(3, wallet.receivedCursor.transactionId);
+
+  ASSERT_EQ(1, response.items.size());
+  ASSERT_EQ(common::podToHex(testTransactions[0].transactions[0].transaction.hash), response.items[0].transactions[0].transactionHash);
+  ASSERT_EQ("7:12", response.nextCursor);
+}
+
+TEST_F(WalletServiceTest_getTransactions, shortPageHasNoNextCursor) {
+  WalletGetTransactionPageStub wallet(dispatcher);
+  wallet.transactions = testTransactions;
+
+  auto service = createWalletService(wallet);
+
+  GetTransactionHashes::Request request;
+  request.firstBlockIndex = 0;
+  request.blockCount = 10;
+  request.limit = 2;
+
+  GetTransactionHashes::Response response;
+  auto ec = service->getTransactionHashes(request, response);
+
+  ASSERT_FALSE(ec);
+  ASSERT_EQ(1, response.items.size());
+  ASSERT_TRUE(response.nextCursor.empty());
+}
+
+TEST_F(WalletServiceTest_getTransactions, invalidCursor) {
+  WalletGetTransactionPageStub wallet(dispatcher);
+  auto service = createWalletService(wallet);
+
+  GetTransactions::Request request;
+  request.firstBlockIndex = 0;
+  request.blockCount = 10;
+  request.cursor = "5:";
+
+  GetTransactions::Response response;
+  auto ec = service->getTransactions(request, response);
+  ASSERT_EQ(make_error_code(cn::error::WRONG_PARAMETERS), ec);
+}
+
 class WalletServiceTest_getTransaction : public WalletServiceTest_getTransactions {
 };
 
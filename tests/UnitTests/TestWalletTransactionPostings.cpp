@@ -0,0 +1,86 @@
+// Copyright (c) 2018-2023 Conceal Network & Conceal Devs
+//
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "gtest/gtest.h"
+
+#include "crypto/crypto.h"
+#include "Wallet/WalletTransactionPostings.h"
+
+using namespace cn;
+
+namespace {
+
+typedef WalletTransactionPostings::Position Position;
+
+const uint32_t END = std::numeric_limits<uint32_t>::max();
+
+class WalletTransactionPostingsTest : public ::testing::Test {
+public:
+  void SetUp() override {
+    m_paymentId = crypto::rand<crypto::Hash>();
+
+    m_postings.update(0, 10, {"A", "B"}, nullptr);
+    m_postings.update(1, 5, {"B"}, &m_paymentId);
+    m_postings.update(2, 10, {"C", "A"}, &m_paymentId);
+    m_postings.update(3, 20, {"A"}, nullptr);
+  }
+
+protected:
+  WalletTransactionPostings m_postings;
+  crypto::Hash m_paymentId;
+};
+
+}
+
+TEST_F(WalletTransactionPostingsTest, addressPostingsAreOrderedByBlock) {
+  std::vector<Position> expected = {{5, 1}, {10, 0}, {10, 2}, {20, 3}};
+  ASSERT_EQ(expected, m_postings.find({"B", "A"}, nullptr, Position(0, 0), END));
+
+  expected = {{10, 2}};
+  ASSERT_EQ(expected, m_postings.find({"C", "D"}, nullptr, Position(0, 0), END));
+  ASSERT_TRUE(m_postings.find({"D"}, nullptr, Position(0, 0), END).empty());
+  ASSERT_TRUE(m_postings.find({}, nullptr, Position(0, 0), END).empty());
+}
+
+TEST_F(WalletTransactionPostingsTest, paymentIdFiltersAddresses) {
+  std::vector<Position> expected = {{5, 1}, {10, 2}};
+  ASSERT_EQ(expected, m_postings.find({}, &m_paymentId, Position(0, 0), END));
+
+  expected = {{10, 2}};
+  ASSERT_EQ(expected, m_postings.find({"A"}, &m_paymentId, Position(0, 0), END));
+
+  crypto::Hash otherPaymentId = crypto::rand<crypto::Hash>();
+  ASSERT_TRUE(m_postings.find({"A"}, &otherPaymentId, Position(0, 0), END).empty());
+}
+
+TEST_F(WalletTransactionPostingsTest, pagesResumeFromPosition) {
+  std::vector<Position> expected = {{5, 1}, {10, 0}};
+  ASSERT_EQ(expected, m_postings.find({"A", "B"}, nullptr, Position(0, 0), END, 2));
+
+  expected = {{10, 2}, {20, 3}};
+  ASSERT_EQ(expected, m_postings.find({"A", "B"}, nullptr, Position(10, 1), END, 2));
+
+  expected = {{10, 0}, {10, 2}};
+  ASSERT_EQ(expected, m_postings.find({"A", "B"}, nullptr, Position(6, 0), 20));
+}
+
+TEST_F(WalletTransactionPostingsTest, updateMovesAndRemoveDrops) {
+  m_postings.update(0, 30, {"C"}, &m_paymentId);
+  m_postings.remove(2);
+
+  std::vector<Position> expected = {{20, 3}};
+  ASSERT_EQ(expected, m_postings.find({"A"}, nullptr, Position(0, 0), END));
+
+  expected = {{5, 1}, {30, 0}};
+  ASSERT_EQ(expected, m_postings.find({}, &m_paymentId, Position(0, 0), END));
+
+  expected = {{30, 0}};
+  ASSERT_EQ(expected, m_postings.find({"C"}, nullptr, Position(0, 0), END));
+  ASSERT_EQ(3, m_postings.size());
+
+  m_postings.clear();
+  ASSERT_EQ(0, m_postings.size());
+  ASSERT_TRUE(m_postings.find({"B"}, nullptr, Position(0, 0), END).empty());
+}
@@ -6,6 +6,9 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_set>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -42,6 +45,10 @@ class TransactionValidator : public cn::ITransactionValidator {
   bool checkTransactionSize(size_t blobSize) override {
     return true;
   }
+
+  bool preverifyTransaction(const cn::Transaction& tx) override {
+    return true;
+  }
 };
 
 class FakeTimeProvider : public ITimeProvider {
@@ -686,6 +693,103 @@ TEST_F(tx_pool, TxPoolDoesNotAcceptInvalidFusionTransaction) {
   ASSERT_FALSE(tvc.m_verification_impossible);
 }
 
+TEST_F(tx_pool, concurrentAdmissionReadsAndRemovals) {
+  const size_t writerCount = 4;
+  const size_t txsPerWriter = 12;
+
+  logging::LoggerGroup silentLogger;
+  TransactionValidator validator;
+  FakeTimeProvider timeProvider;
+  tx_memory_pool pool(currency, validator, timeProvider, silentLogger);
+  ASSERT_TRUE(pool.init(m_configDir.string()));
+
+  std::vector<Transaction> txs(writerCount * txsPerWriter);
+  std::vector<crypto::Hash> txHashes;
+  for (auto& tx : txs) {
+    GenerateTransaction(currency, tx, currency.minimumFee(), 1);
+    txHashes.push_back(getObjectHash(tx));
+  }
+
+  std::atomic<size_t> writersDone(0);
+  std::atomic<size_t> failures(0);
+
+  std::vector<std::thread> threads;
+  for (size_t w = 0; w < writerCount; ++w) {
+    threads.emplace_back([&, w] {
+      for (size_t i = w * txsPerWriter; i < (w + 1) * txsPerWriter; ++i) {
+        tx_verification_context tvc = boost::value_initialized<tx_verification_context>();
+        if (!pool.add_tx(txs[i], tvc, false, 0) || !pool.have_tx(txHashes[i])) {
+          ++failures;
+        }
+      }
+
+      ++writersDone;
+    });
+  }
+
+  for (size_t r = 0; r < 2; ++r) {
+    threads.emplace_back([&] {
+      std::unordered_set<crypto::Hash> allHashes(txHashes.begin(), txHashes.end());
+      while (writersDone < writerCount) {
+        std::vector<Transaction> added;
+        std::vector<crypto::Hash> deleted;
+        pool.getPoolChanges(std::vector<crypto::Hash>(), added, deleted);
+        for (const auto& tx : added) {
+          if (allHashes.count(getObjectHash(tx)) == 0) {
+            ++failures;
+          }
+        }
+
+        Block block;
+        size_t totalSize;
+        uint64_t fee;
+        uint32_t height = 0;
+        pool.fill_block_template(block, 1000000, textMaxCumulativeSize, 0, totalSize, fee, height);
+        pool.getMemoryPool();
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(0, failures);
+  ASSERT_EQ(txs.size(), pool.get_transactions_count());
+
+  // remove half of the pool while a reader keeps taking snapshots
+  std::atomic<bool> removing(true);
+  std::thread reader([&] {
+    while (removing) {
+      std::vector<crypto::Hash> newIds;
+      std::vector<crypto::Hash> deletedIds;
+      pool.get_difference(txHashes, newIds, deletedIds);
+      if (!newIds.empty()) {
+        ++failures;
+      }
+    }
+  });
+
+  for (size_t i = 0; i < txs.size(); i += 2) {
+    Transaction tx;
+    size_t blobSize;
+    uint64_t fee;
+    ASSERT_TRUE(pool.take_tx(txHashes[i], tx, blobSize, fee));
+  }
+
+  removing = false;
+  reader.join();
+
+  ASSERT_EQ(0, failures);
+  ASSERT_EQ(txs.size() / 2, pool.get_transactions_count());
+
+  std::vector<crypto::Hash> newIds;
+  std::vector<crypto::Hash> deletedIds;
+  pool.get_difference(txHashes, newIds, deletedIds);
+  ASSERT_TRUE(newIds.empty());
+  ASSERT_EQ(txs.size() / 2, deletedIds.size());
+}
+
 namespace {
 
 const size_t TEST_FUSION_TX_COUNT_PER_BLOCK = 3;